@@ -0,0 +1,74 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+
+#include <vector>
+
+namespace Acts {
+
+class TrackingVolume;
+
+/// @class BoundaryNavigationTable
+///
+/// Precomputed boundary candidates of a TrackingVolume, binned in direction.
+///
+/// The unit sphere of directions is split into the six faces of a cube, each
+/// face into nBins x nBins cells. For every cell the table keeps the boundary
+/// surfaces which a straight line with a direction in this cell can leave the
+/// volume through. A planar boundary is dropped from a cell if no direction
+/// of the cell points out of the volume at this boundary. Since the cells are
+/// bounded by great circles this is decided exactly from the cell corners.
+/// Non-planar boundaries and the boundaries of confined dense volumes are
+/// kept in every cell.
+///
+/// The table depends on the boundary surfaces of the volume, it has to be
+/// rebuilt when they change.
+class BoundaryNavigationTable {
+ public:
+  using BoundarySurface = BoundarySurfaceT<TrackingVolume>;
+  using Candidates = std::vector<const BoundarySurface*>;
+
+  /// Constructor from a volume
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param volume The volume for which the table is built
+  /// @param nBins The number of bins per direction on each cube face
+  BoundaryNavigationTable(const GeometryContext& gctx,
+                          const TrackingVolume& volume, size_t nBins = 4);
+
+  /// The boundary candidates for a direction
+  ///
+  /// @param direction The (signed) direction of the navigation
+  ///
+  /// @return The boundaries which can be crossed in this direction
+  const Candidates& candidates(const Vector3& direction) const {
+    return m_candidates[bin(direction)];
+  }
+
+  /// The number of bins per direction on each cube face
+  size_t nBins() const { return m_nBins; }
+
+ private:
+  /// The cell of a direction
+  ///
+  /// @param direction The direction, does not need to be normalized
+  size_t bin(const Vector3& direction) const;
+
+  /// The number of bins per direction on each cube face
+  size_t m_nBins;
+
+  /// The boundary candidates per cell
+  std::vector<Candidates> m_candidates;
+};
+
+}  // namespace Acts
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/AbstractVolume.hpp"
 #include "Acts/Geometry/ApproachDescriptor.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
@@ -18,6 +19,7 @@
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 
 #include <memory>
@@ -85,6 +87,9 @@ class Layer : public virtual GeometryObject {
   friend class TrackingVolume;
 
  public:
+  /// Axis aligned bounding box of a sensitive surface
+  using SurfaceBoundingBox = AxisAlignedBoundingBox<Surface, ActsScalar, 3>;
+
   /// Default Constructor - deleted
   Layer() = delete;
 
@@ -105,6 +110,25 @@ class Layer : public virtual GeometryObject {
   /// Non-const version
   SurfaceArray* surfaceArray();
 
+  /// Build a bounding volume hierarchy over the sensitive surfaces
+  ///
+  /// If present, the hierarchy replaces the SurfaceArray neighbour lookup
+  /// when searching for compatible surfaces: only surfaces whose bounding
+  /// box is crossed by the straight line along the direction are tested.
+  /// This helps for irregular layouts which are poorly matched by the
+  /// binning of the SurfaceArray.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param maxDepth The maximum depth of the octree
+  /// @param envelope The envelope added to the surface bounding boxes, it
+  ///        has to cover the deviation of the track from a straight line
+  ///        within the layer
+  void createSurfaceHierarchy(const GeometryContext& gctx, size_t maxDepth = 3,
+                              double envelope = 1 * UnitConstants::mm);
+
+  /// Return the top node of the sensitive surface hierarchy, can be nullptr
+  const SurfaceBoundingBox* surfaceHierarchy() const;
+
   /// Transforms the layer into a Surface representation for extrapolation
   /// @note the layer can be hosting many surfaces, but this is the global
   /// one to which one can extrapolate
@@ -171,6 +195,23 @@ class Layer : public virtual GeometryObject {
       const GeometryContext& gctx, const Vector3& position,
       const Vector3& direction, const options_t& options) const;
 
+  /// @brief Decompose Layer into (compatible) surfaces, without sorting
+  ///
+  /// @tparam options_t The navigation options type
+  /// @tparam container_t The container type of the intersections
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position parameter for searching
+  /// @param momentum Momentum parameter for searching
+  /// @param options The templated naivation options
+  /// @param [out] sIntersections The container which is cleared and filled
+  ///        with the unsorted intersections of the surfaces on the layer
+  template <typename options_t, typename container_t>
+  void compatibleSurfaces(const GeometryContext& gctx,
+                          const Vector3& position, const Vector3& direction,
+                          const options_t& options,
+                          container_t& sIntersections) const;
+
   /// Surface seen on approach
   ///
   /// @tparam options_t The navigation options type
@@ -249,6 +290,12 @@ class Layer : public virtual GeometryObject {
   ///
   std::unique_ptr<const SurfaceArray> m_surfaceArray = nullptr;
 
+  /// Bounding boxes of the sensitive surfaces and the hierarchy over them
+  std::vector<std::unique_ptr<SurfaceBoundingBox>> m_surfaceBoxes;
+
+  /// Top node of the sensitive surface hierarchy
+  const SurfaceBoundingBox* m_surfaceHierarchy = nullptr;
+
   /// Thickness of the Layer
   double m_layerThickness = 0.;
 
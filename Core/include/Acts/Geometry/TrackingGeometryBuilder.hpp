@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/ITrackingGeometryBuilder.hpp"
 #include "Acts/Geometry/ITrackingVolumeHelper.hpp"
@@ -48,6 +49,19 @@ class TrackingGeometryBuilder : public ITrackingGeometryBuilder {
 
     /// The optional material decorator for this
     std::shared_ptr<const IMaterialDecorator> materialDecorator = nullptr;
+
+    /// The number of bins per direction on each cube face of the optional
+    /// boundary navigation tables, no tables are built if zero
+    size_t boundaryNavigationTableBins = 0;
+
+    /// Build the sensitive surface hierarchies of the layers
+    bool buildSurfaceHierarchies = false;
+
+    /// The maximum depth of the sensitive surface hierarchies
+    size_t surfaceHierarchyDepth = 3;
+
+    /// The envelope of the surface bounding boxes in the hierarchies
+    double surfaceHierarchyEnvelope = 1 * UnitConstants::mm;
   };
 
   /// Constructor
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/BoundaryNavigationTable.hpp"
 #include "Acts/Geometry/BoundarySurfaceT.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
@@ -27,6 +28,8 @@
 #include <string>
 #include <unordered_map>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Acts {
 
 class GlueVolumesDescriptor;
@@ -179,6 +182,20 @@ class TrackingVolume : public Volume {
       const GeometryContext& gctx, const Vector3& position,
       const Vector3& direction, const NavigationOptions<Layer>& options) const;
 
+  /// @brief Resolves the volume into (compatible) Layers, without sorting
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position for the search
+  /// @param direction Direction for the search
+  /// @param options The templated navigation options
+  /// @param [out] lIntersections The container which is cleared and filled
+  ///        with the unsorted intersections with the layers
+  void compatibleLayers(
+      const GeometryContext& gctx, const Vector3& position,
+      const Vector3& direction, const NavigationOptions<Layer>& options,
+      boost::container::small_vector_base<LayerIntersection>& lIntersections)
+      const;
+
   /// @brief Returns all boundary surfaces sorted by the user.
   ///
   /// @tparam options_t Type of navigation options object for decomposition
@@ -191,11 +208,31 @@ class TrackingVolume : public Volume {
   /// @param sorter Sorter of the boundary surfaces
   ///
   /// @return is the templated boundary intersection
+  ///
+  /// @note If a boundary navigation table was built, only the boundaries
+  /// which are candidates for the direction are intersected. All boundaries
+  /// are tried if none of the candidates is reached.
   std::vector<BoundaryIntersection> compatibleBoundaries(
       const GeometryContext& gctx, const Vector3& position,
       const Vector3& direction, const NavigationOptions<Surface>& options,
       LoggerWrapper logger = getDummyLogger()) const;
 
+  /// @brief Returns all boundary surfaces, without sorting
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position The position for searching
+  /// @param direction The direction for searching
+  /// @param options The templated navigation options
+  /// @param [out] bIntersections The container which is cleared and filled
+  ///        with the unsorted boundary intersections
+  /// @param logger A @c LoggerWrapper instance
+  void compatibleBoundaries(
+      const GeometryContext& gctx, const Vector3& position,
+      const Vector3& direction, const NavigationOptions<Surface>& options,
+      boost::container::small_vector_base<BoundaryIntersection>&
+          bIntersections,
+      LoggerWrapper logger = getDummyLogger()) const;
+
   /// @brief Return surfaces in given direction from bounding volume hierarchy
   /// @tparam options_t Type of navigation options object for decomposition
   ///
@@ -248,6 +285,31 @@ class TrackingVolume : public Volume {
   /// Method to return the BoundarySurfaces
   const TrackingVolumeBoundaries& boundarySurfaces() const;
 
+  /// Build the boundary navigation tables of this volume and of all
+  /// volumes confined in it
+  ///
+  /// This should be done when the volumes are glued, since the tables are
+  /// dropped whenever a boundary surface is replaced.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param nBins The number of bins per direction on each cube face
+  void createBoundaryNavigationTables(const GeometryContext& gctx,
+                                      size_t nBins);
+
+  /// Return the boundary navigation table - if it exists
+  const BoundaryNavigationTable* boundaryNavigationTable() const;
+
+  /// Build the sensitive surface hierarchies of the confined layers, also
+  /// for all volumes confined in this one
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param maxDepth The maximum depth of the octrees
+  /// @param envelope The envelope added to the surface bounding boxes
+  ///
+  /// @see Layer::createSurfaceHierarchy
+  void createSurfaceHierarchies(const GeometryContext& gctx, size_t maxDepth,
+                                double envelope);
+
   /// Return the material of the volume
   const IVolumeMaterial* volumeMaterial() const;
 
@@ -419,6 +481,22 @@ class TrackingVolume : public Volume {
   /// interlink the layers in this TrackingVolume
   void interlinkLayers();
 
+  /// Fill the unsorted layer intersections into any container
+  template <typename container_t>
+  void fillCompatibleLayers(const GeometryContext& gctx,
+                            const Vector3& position, const Vector3& direction,
+                            const NavigationOptions<Layer>& options,
+                            container_t& lIntersections) const;
+
+  /// Fill the unsorted boundary intersections into any container
+  template <typename container_t>
+  void fillCompatibleBoundaries(const GeometryContext& gctx,
+                                const Vector3& position,
+                                const Vector3& direction,
+                                const NavigationOptions<Surface>& options,
+                                container_t& bIntersections,
+                                LoggerWrapper logger) const;
+
   /// The volume based material the TrackingVolume consists of
   std::shared_ptr<const IVolumeMaterial> m_volumeMaterial{nullptr};
 
@@ -451,6 +529,9 @@ class TrackingVolume : public Volume {
   std::vector<std::unique_ptr<const Volume::BoundingBox>> m_boundingBoxes;
   std::vector<std::unique_ptr<const Volume>> m_descendantVolumes;
   const Volume::BoundingBox* m_bvhTop{nullptr};
+
+  /// Optional direction binned boundary candidates
+  std::unique_ptr<const BoundaryNavigationTable> m_boundaryTable = nullptr;
 };
 
 inline const std::string& TrackingVolume::volumeName() const {
@@ -475,6 +556,11 @@ inline const LayerArray* TrackingVolume::confinedLayers() const {
   return m_confinedLayers.get();
 }
 
+inline const BoundaryNavigationTable*
+TrackingVolume::boundaryNavigationTable() const {
+  return m_boundaryTable.get();
+}
+
 inline const MutableTrackingVolumeVector TrackingVolume::denseVolumes() const {
   return m_confinedDenseVolumes;
 }
@@ -6,8 +6,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <limits>
-#include <map>
 
 namespace Acts {
 
@@ -19,6 +19,10 @@ inline SurfaceArray* Layer::surfaceArray() {
   return const_cast<SurfaceArray*>(m_surfaceArray.get());
 }
 
+inline const Layer::SurfaceBoundingBox* Layer::surfaceHierarchy() const {
+  return m_surfaceHierarchy;
+}
+
 inline double Layer::thickness() const {
   return m_layerThickness;
 }
@@ -73,17 +77,33 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     const Vector3& direction, const options_t& options) const {
   // the list of valid intersection
   std::vector<SurfaceIntersection> sIntersections;
-  // remember the surfaces for duplicate removal
-  std::map<const Surface*, bool> accepted;
+  // reserve a few bins
+  sIntersections.reserve(20);
+  compatibleSurfaces(gctx, position, direction, options, sIntersections);
+
+  // sort according to the path length
+  if (options.navDir == forward) {
+    std::sort(sIntersections.begin(), sIntersections.end());
+  } else {
+    std::sort(sIntersections.begin(), sIntersections.end(), std::greater<>());
+  }
+
+  return sIntersections;
+}
+
+template <typename options_t, typename container_t>
+void Layer::compatibleSurfaces(const GeometryContext& gctx,
+                               const Vector3& position,
+                               const Vector3& direction,
+                               const options_t& options,
+                               container_t& sIntersections) const {
+  sIntersections.clear();
 
   // fast exit - there is nothing to
   if (!m_surfaceArray || !m_approachDescriptor || !options.navDir) {
-    return sIntersections;
+    return;
   }
 
-  // reserve a few bins
-  sIntersections.reserve(20);
-
   // (0) End surface check
   // @todo: - we might be able to skip this by use of options.pathLimit
   // check if you have to stop at the endSurface
@@ -101,7 +121,7 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     if (endInter) {
       pathLimit = endInter.intersection.pathLength;
     } else {
-      return sIntersections;
+      return;
     }
   } else {
     // compatibleSurfaces() should only be called when on the layer,
@@ -114,10 +134,11 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   }
 
   // lemma 0 : accept the surface
-  auto acceptSurface = [&options, &accepted](const Surface& sf,
-                                             bool sensitive = false) -> bool {
+  auto acceptSurface = [&options, &sIntersections](
+                           const Surface& sf, bool sensitive = false) -> bool {
     // check for duplicates
-    if (accepted.find(&sf) != accepted.end()) {
+    if (std::any_of(sIntersections.begin(), sIntersections.end(),
+                    [&sf](const auto& sfi) { return sfi.object == &sf; })) {
       return false;
     }
     // surface is sensitive and you're asked to resolve
@@ -160,7 +181,6 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
       // Now put the right sign on it
       sfi.intersection.pathLength *= std::copysign(1., options.navDir);
       sIntersections.push_back(sfi);
-      accepted[&sf] = true;
     }
     return;
   };
@@ -188,14 +208,39 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   // check the sensitive surfaces if you have some
   if (m_surfaceArray && (options.resolveMaterial || options.resolvePassive ||
                          options.resolveSensitive)) {
-    // get the canditates
-    const std::vector<const Surface*>& sensitiveSurfaces =
-        m_surfaceArray->neighbors(position);
-    // loop through and veto
-    // - if the approach surface is the parameter surface
-    // - if the surface is not compatible with the type(s) that are collected
-    for (auto& sSurface : sensitiveSurfaces) {
-      processSurface(*sSurface, true);
+    // the hierarchy only finds surfaces crossed by the straight line, which
+    // is not enough if the boundaries are not checked
+    if (m_surfaceHierarchy != nullptr && options.boundaryCheck &&
+        options.externalSurfaces.empty()) {
+      // start the ray behind the position to allow for overstepping
+      const Vector3 sDirection = options.navDir * direction;
+      const Ray3D ray(position + std::min(overstepLimit, 0.) * sDirection,
+                      sDirection);
+      // walk through the hierarchy, skip the children of missed boxes
+      const SurfaceBoundingBox* node = m_surfaceHierarchy;
+      do {
+        if (node->intersect(ray)) {
+          if (node->hasEntity()) {
+            processSurface(*node->entity(), true);
+            node = node->getSkip();
+          } else {
+            node = node->getLeftChild();
+          }
+        } else {
+          node = node->getSkip();
+        }
+      } while (node != nullptr);
+    } else {
+      // get the canditates
+      const std::vector<const Surface*>& sensitiveSurfaces =
+          m_surfaceArray->neighbors(position);
+      // loop through and veto
+      // - if the approach surface is the parameter surface
+      // - if the surface is not compatible with the type(s) that are
+      //   collected
+      for (auto& sSurface : sensitiveSurfaces) {
+        processSurface(*sSurface, true);
+      }
     }
   }
 
@@ -204,15 +249,6 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   // the layer surface itself is a testSurface
   const Surface* layerSurface = &surfaceRepresentation();
   processSurface(*layerSurface);
-
-  // sort according to the path length
-  if (options.navDir == forward) {
-    std::sort(sIntersections.begin(), sIntersections.end());
-  } else {
-    std::sort(sIntersections.begin(), sIntersections.end(), std::greater<>());
-  }
-
-  return sIntersections;
 }
 
 template <typename options_t>
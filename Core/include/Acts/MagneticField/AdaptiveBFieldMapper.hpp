@@ -0,0 +1,435 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Acts {
+
+/// @brief struct for mapping global 3D positions to field values with a
+/// resolution adapted to the variation of the field
+///
+/// @tparam mapper_t type of the source field map with equidistant axes, e.g.
+///         an InterpolatedBFieldMapper
+///
+/// The source map is divided into blocks of a fixed number of bins along each
+/// axis. Every block stores the field values on a sub-grid of the source grid
+/// points. Its spacing along each axis is a power of two of source bins and is
+/// chosen as large as possible, such that the interpolation in the block
+/// deviates by less than a given tolerance from the source map. Regions with
+/// a nearly uniform field are covered by a few large cells, while the source
+/// resolution is kept where the field varies.
+///
+/// The difference of the interpolations is linear within each source bin,
+/// i.e. the tolerance, which is checked at the source grid points, holds for
+/// every position in the map.
+///
+/// The mapper provides the same field cells as InterpolatedBFieldMapper and
+/// can be used in an InterpolatedBFieldMap, which caches the cells.
+template <typename mapper_t>
+struct AdaptiveBFieldMapper {
+ public:
+  using Source_t = mapper_t;
+  using FieldType = typename Source_t::FieldType;
+  using FieldCell = typename Source_t::FieldCell;
+  static constexpr size_t DIM_POS = Source_t::DIM_POS;
+
+  /// @brief create an adaptive mapper from an existing field map
+  ///
+  /// @param [in] mapper source field map
+  /// @param [in] tolerance maximum deviation of the field from the source map
+  /// @param [in] blockBins number of source bins of a block along each axis,
+  ///             must be a power of two
+  ///
+  /// The tolerance applies to the field values of the source grid, i.e.
+  /// before the transformation into global 3D field values.
+  AdaptiveBFieldMapper(const Source_t& mapper, double tolerance,
+                       size_t blockBins = 8)
+      : m_transformPos(mapper.getTransformPos()),
+        m_transformBField(mapper.getTransformBField()),
+        m_blockBins(blockBins) {
+    if (not(tolerance >= 0.)) {
+      throw std::invalid_argument("Tolerance must not be negative");
+    }
+    if ((blockBins == 0) or ((blockBins & (blockBins - 1)) != 0)) {
+      throw std::invalid_argument("Number of block bins must be a power of 2");
+    }
+    const auto& grid = mapper.getGrid();
+    const auto& storage = mapper.getStorage();
+    size_t nBlocks = 1;
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      const auto* axis = grid.axes()[d];
+      if (not axis->isEquidistant()) {
+        throw std::invalid_argument("Field map axes must be equidistant");
+      }
+      m_min[d] = axis->getMin();
+      m_max[d] = axis->getMax();
+      m_nBins[d] = axis->getNBins();
+      m_binWidth[d] = (m_max[d] - m_min[d]) / m_nBins[d];
+      m_nBlocks[d] = (m_nBins[d] + m_blockBins - 1) / m_blockBins;
+      nBlocks *= m_nBlocks[d];
+    }
+
+    // the value at the lower left edge of each bin is stored in the bin, i.e.
+    // the grid point indices are shifted by the underflow bin
+    auto sourceValue = [&](const Index& point) {
+      typename Source_t::Grid_t::index_t indices;
+      for (size_t d = 0; d < DIM_POS; ++d) {
+        indices[d] = point[d] + 1;
+      }
+      size_t bin = grid.globalBinFromLocalBins(indices);
+      return storage.decode(grid.at(bin), bin);
+    };
+
+    unsigned char maxShift = 0;
+    while ((size_t(1) << maxShift) < m_blockBins) {
+      ++maxShift;
+    }
+    m_blocks.resize(nBlocks);
+    std::vector<FieldType> values;
+    for (size_t b = 0; b < nBlocks; ++b) {
+      Index first = blockFirstBin(b);
+      Index nBlockBins;
+      for (size_t d = 0; d < DIM_POS; ++d) {
+        nBlockBins[d] = std::min(m_nBins[d] - first[d], m_blockBins);
+      }
+      Block block;
+      block.offset = m_values.size();
+      // fill the sub-grid values for the given spacing and check them against
+      // all source grid points in the block
+      auto fits = [&](const Shift& shift, double maxDeviation) {
+        block.shift = shift;
+        values.clear();
+        Index last = block.nPoints(nBlockBins);
+        for (auto& n : last) {
+          n -= 1;
+        }
+        forEachPoint(last, [&](const Index& point) {
+          Index source;
+          for (size_t d = 0; d < DIM_POS; ++d) {
+            source[d] =
+                first[d] + std::min(point[d] << shift[d], nBlockBins[d]);
+          }
+          values.push_back(sourceValue(source));
+        });
+        return forEachPoint(nBlockBins, [&](const Index& offset) {
+          Index source;
+          for (size_t d = 0; d < DIM_POS; ++d) {
+            source[d] = first[d] + offset[d];
+          }
+          FieldType deviation =
+              interpolateBlock(block, nBlockBins, values.data(), offset) -
+              sourceValue(source);
+          return deviation.norm() <= maxDeviation;
+        });
+      };
+
+      // the spacing is first chosen along each axis separately with a share
+      // of the tolerance, and then reduced along the axis with the largest
+      // spacing until the combination is within the tolerance. the sub-grid
+      // with the source spacing contains all source grid points and always
+      // fits.
+      Shift shift{};
+      for (size_t d = 0; d < DIM_POS; ++d) {
+        for (unsigned char s = maxShift; s > 0; --s) {
+          Shift trial{};
+          trial[d] = s;
+          if (fits(trial, tolerance / DIM_POS)) {
+            shift[d] = s;
+            break;
+          }
+        }
+      }
+      while (not fits(shift, tolerance)) {
+        auto coarsest = std::max_element(shift.begin(), shift.end());
+        *coarsest -= 1;
+      }
+      m_values.insert(m_values.end(), values.begin(), values.end());
+      m_blocks[b] = block;
+    }
+    m_values.shrink_to_fit();
+  }
+
+  /// @brief retrieve field at given position
+  ///
+  /// @param [in] position global 3D position
+  /// @return magnetic field value at the given position
+  ///
+  /// @pre The given @c position must lie within the range of the underlying
+  ///      magnetic field map.
+  Vector3 getField(const Vector3& position) const {
+    const auto& gridPosition = m_transformPos(position);
+    std::array<double, DIM_POS> lowerLeft;
+    std::array<double, DIM_POS> upperRight;
+    std::array<FieldType, FieldCell::N> corners;
+    findCell(gridPosition, lowerLeft, upperRight, corners);
+    return m_transformBField(
+        Acts::interpolate(gridPosition, lowerLeft, upperRight, corners),
+        position);
+  }
+
+  /// @brief retrieve field cell for given position
+  ///
+  /// @param [in] position global 3D position
+  /// @return field cell containing the given global position
+  ///
+  /// @pre The given @c position must lie within the range of the underlying
+  ///      magnetic field map.
+  FieldCell getFieldCell(const Vector3& position) const {
+    const auto& gridPosition = m_transformPos(position);
+    std::array<double, DIM_POS> lowerLeft;
+    std::array<double, DIM_POS> upperRight;
+    std::array<FieldType, FieldCell::N> corners;
+    findCell(gridPosition, lowerLeft, upperRight, corners);
+
+    std::array<Vector3, FieldCell::N> neighbors;
+    for (size_t i = 0; i < FieldCell::N; ++i) {
+      neighbors[i] = m_transformBField(corners[i], position);
+    }
+    return FieldCell(m_transformPos, lowerLeft, upperRight,
+                     std::move(neighbors));
+  }
+
+  /// @brief get the number of bins for all axes of the source field map
+  ///
+  /// @return vector returning number of bins for all field map axes
+  std::vector<size_t> getNBins() const {
+    return std::vector<size_t>(m_nBins.begin(), m_nBins.end());
+  }
+
+  /// @brief get the minimum value of all axes of the field map
+  ///
+  /// @return vector returning the minima of all field map axes
+  std::vector<double> getMin() const {
+    return std::vector<double>(m_min.begin(), m_min.end());
+  }
+
+  /// @brief get the maximum value of all axes of the field map
+  ///
+  /// @return vector returning the maxima of all field map axes
+  std::vector<double> getMax() const {
+    return std::vector<double>(m_max.begin(), m_max.end());
+  }
+
+  /// @brief check whether given 3D position is inside look-up domain
+  ///
+  /// @param [in] position global 3D position
+  /// @return @c true if position is inside the defined look-up domain,
+  ///         otherwise @c false
+  bool isInside(const Vector3& position) const {
+    const auto& gridPosition = m_transformPos(position);
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      if (gridPosition[d] < m_min[d] || gridPosition[d] >= m_max[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief get the number of stored field values
+  size_t numValues() const { return m_values.size(); }
+
+  /// @brief get the memory used by the field values and the blocks in bytes
+  size_t memoryUsage() const {
+    return m_values.size() * sizeof(FieldType) +
+           m_blocks.size() * sizeof(Block);
+  }
+
+ private:
+  using Index = std::array<size_t, DIM_POS>;
+  using Shift = std::array<unsigned char, DIM_POS>;
+
+  /// sub-grid of a block
+  struct Block {
+    /// index of the first field value of the block
+    unsigned int offset = 0;
+    /// spacing of the sub-grid points along each axis as the binary
+    /// logarithm of the number of source bins
+    Shift shift{};
+
+    /// @brief number of sub-grid points along each axis
+    Index nPoints(const Index& nBlockBins) const {
+      Index n;
+      for (size_t d = 0; d < DIM_POS; ++d) {
+        n[d] = ((nBlockBins[d] + (size_t(1) << shift[d]) - 1) >> shift[d]) + 1;
+      }
+      return n;
+    }
+  };
+
+  /// @brief call a function for all points of a grid
+  ///
+  /// @param [in] last index of the last point along each axis
+  /// @param [in] func function to call; if it returns a bool, the iteration
+  ///             stops at the first @c false
+  /// @return @c false if the iteration was stopped
+  template <typename func_t>
+  static bool forEachPoint(const Index& last, func_t&& func) {
+    Index point{};
+    while (true) {
+      if constexpr (std::is_same_v<decltype(func(point)), bool>) {
+        if (not func(point)) {
+          return false;
+        }
+      } else {
+        func(point);
+      }
+      // advance with the last axis running fastest
+      size_t d = DIM_POS;
+      while (true) {
+        if (d == 0) {
+          return true;
+        }
+        --d;
+        if (point[d] < last[d]) {
+          ++point[d];
+          break;
+        }
+        point[d] = 0;
+      }
+    }
+  }
+
+  /// @brief local bin indices of the first bin of the given block
+  Index blockFirstBin(size_t block) const {
+    Index first;
+    for (size_t d = DIM_POS; d-- > 0;) {
+      first[d] = (block % m_nBlocks[d]) * m_blockBins;
+      block /= m_nBlocks[d];
+    }
+    return first;
+  }
+
+  /// @brief sub-grid cell containing the given offset in source bins
+  ///
+  /// @param [in] block sub-grid of the block
+  /// @param [in] nBlockBins number of source bins of the block
+  /// @param [in] values field values of the sub-grid
+  /// @param [in] offset position in source bins relative to the block
+  /// @param [out] lower first source bin of the cell relative to the block
+  /// @param [out] upper last source grid point of the cell relative to the
+  ///              block
+  /// @param [out] corners field values at the cell corners
+  void blockCell(const Block& block, const Index& nBlockBins,
+                 const FieldType* values,
+                 const std::array<double, DIM_POS>& offset, Index& lower,
+                 Index& upper,
+                 std::array<FieldType, FieldCell::N>& corners) const {
+    const Index& nPoints = block.nPoints(nBlockBins);
+    Index cell;
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      size_t k = static_cast<size_t>(std::max(offset[d], 0.)) >> block.shift[d];
+      cell[d] = std::min(k, nPoints[d] - 2);
+      lower[d] = cell[d] << block.shift[d];
+      upper[d] = std::min(lower[d] + (size_t(1) << block.shift[d]),
+                          nBlockBins[d]);
+    }
+    // the first dimension corresponds to the most significant bit of the
+    // corner number; see Acts::interpolate for the ordering
+    for (size_t c = 0; c < FieldCell::N; ++c) {
+      size_t index = 0;
+      for (size_t d = 0; d < DIM_POS; ++d) {
+        const bool isUpper = ((c >> (DIM_POS - 1 - d)) & 1u) != 0u;
+        index = index * nPoints[d] + cell[d] + (isUpper ? 1 : 0);
+      }
+      corners[c] = values[index];
+    }
+  }
+
+  /// @brief interpolate the sub-grid of a block at a source grid point
+  FieldType interpolateBlock(const Block& block, const Index& nBlockBins,
+                             const FieldType* values,
+                             const Index& point) const {
+    std::array<double, DIM_POS> offset;
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      offset[d] = point[d];
+    }
+    Index lower;
+    Index upper;
+    std::array<FieldType, FieldCell::N> corners;
+    blockCell(block, nBlockBins, values, offset, lower, upper, corners);
+    std::array<double, DIM_POS> lowerLeft;
+    std::array<double, DIM_POS> upperRight;
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      lowerLeft[d] = lower[d];
+      upperRight[d] = upper[d];
+    }
+    return Acts::interpolate(offset, lowerLeft, upperRight, corners);
+  }
+
+  /// @brief find the cell containing the given grid position
+  ///
+  /// @param [in] gridPosition position in grid space
+  /// @param [out] lowerLeft lower-left corner of the cell
+  /// @param [out] upperRight upper-right corner of the cell
+  /// @param [out] corners field values at the cell corners
+  void findCell(const ActsVector<DIM_POS>& gridPosition,
+                std::array<double, DIM_POS>& lowerLeft,
+                std::array<double, DIM_POS>& upperRight,
+                std::array<FieldType, FieldCell::N>& corners) const {
+    // positions outside of the map are assigned to the closest block
+    size_t b = 0;
+    Index first;
+    Index nBlockBins;
+    std::array<double, DIM_POS> offset;
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      double bins = (gridPosition[d] - m_min[d]) / m_binWidth[d];
+      size_t bin = std::clamp(bins, 0., m_nBins[d] - 1.);
+      size_t blockIndex = bin / m_blockBins;
+      b = b * m_nBlocks[d] + blockIndex;
+      first[d] = blockIndex * m_blockBins;
+      nBlockBins[d] = std::min(m_nBins[d] - first[d], m_blockBins);
+      offset[d] = bins - first[d];
+    }
+    const Block& block = m_blocks[b];
+    Index lower;
+    Index upper;
+    blockCell(block, nBlockBins, &m_values[block.offset], offset, lower, upper,
+              corners);
+    for (size_t d = 0; d < DIM_POS; ++d) {
+      lowerLeft[d] = m_min[d] + (first[d] + lower[d]) * m_binWidth[d];
+      upperRight[d] = m_min[d] + (first[d] + upper[d]) * m_binWidth[d];
+    }
+  }
+
+  /// geometric transformation applied to global 3D positions
+  std::function<ActsVector<DIM_POS>(const Vector3&)> m_transformPos;
+  /// Transformation calculating the global 3D coordinates (cartesian) of the
+  /// magnetic field with the local n dimensional field and the global 3D
+  /// position as input
+  std::function<Vector3(const FieldType&, const Vector3&)> m_transformBField;
+  /// number of source bins of a block along each axis
+  size_t m_blockBins;
+  /// minima of the field map axes
+  std::array<double, DIM_POS> m_min;
+  /// maxima of the field map axes
+  std::array<double, DIM_POS> m_max;
+  /// width of the source bins
+  std::array<double, DIM_POS> m_binWidth;
+  /// number of source bins along each axis
+  Index m_nBins;
+  /// number of blocks along each axis
+  Index m_nBlocks;
+  /// sub-grids of the blocks with the last axis running fastest
+  std::vector<Block> m_blocks;
+  /// field values of all blocks
+  std::vector<FieldType> m_values;
+};
+
+}  // namespace Acts
@@ -0,0 +1,144 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+#include "Acts/Utilities/detail/GridView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Binary field map files that are used directly through a read-only memory
+/// mapping, i.e. without reading and copying the field values. The mapping is
+/// shared between all processes using the same file.
+///
+/// The file consists of a fixed-size header followed by the field values of
+/// all grid points, including the under-/overflow bins, in the order of the
+/// global bin index. Each value is stored as two (r/z maps) or three (x/y/z
+/// maps) double precision components in native byte order. The values start
+/// at an offset aligned to 64 bytes.
+
+namespace Acts {
+
+/// @brief read-only memory mapping of a binary magnetic field map file
+class BFieldMapFile {
+ public:
+  /// coordinate system of the field map
+  enum class Type : uint32_t {
+    /// field (Br, Bz) on a (r, z) grid
+    RZ = 2,
+    /// field (Bx, By, Bz) on a (x, y, z) grid
+    XYZ = 3,
+  };
+
+  /// equidistant axis of the field map grid
+  struct Axis {
+    /// number of bins without under-/overflow bins
+    uint64_t nBins = 0;
+    /// lower edge of the first bin
+    double min = 0;
+    /// upper edge of the last bin
+    double max = 0;
+  };
+
+  /// file format version written by this version
+  static constexpr uint32_t kVersion = 1;
+
+  /// @brief map the given file into memory
+  ///
+  /// @param [in] path path of the field map file
+  /// @throws std::runtime_error if the file can not be mapped or its content
+  ///         is not a valid field map of a compatible version
+  BFieldMapFile(const std::string& path);
+  ~BFieldMapFile();
+
+  BFieldMapFile(const BFieldMapFile&) = delete;
+  BFieldMapFile& operator=(const BFieldMapFile&) = delete;
+
+  /// @brief coordinate system of the field map
+  Type type() const { return m_type; }
+
+  /// @brief axes of the grid, two for r/z maps and three for x/y/z maps
+  const std::vector<Axis>& axes() const { return m_axes; }
+
+  /// @brief field components of all grid points ordered by global bin index
+  const double* values() const { return m_values; }
+
+  /// @brief write a field map file
+  ///
+  /// @param [in] path path of the field map file
+  /// @param [in] type coordinate system of the field map
+  /// @param [in] axes axes of the grid
+  /// @param [in] values field components of all grid points ordered by global
+  ///                    bin index, including the under-/overflow bins
+  /// @throws std::runtime_error if the file can not be written
+  /// @throws std::invalid_argument if the number of values does not match
+  static void write(const std::string& path, Type type,
+                    const std::vector<Axis>& axes,
+                    const std::vector<double>& values);
+
+ private:
+  void* m_data = nullptr;
+  size_t m_size = 0;
+  Type m_type = Type::XYZ;
+  std::vector<Axis> m_axes;
+  const double* m_values = nullptr;
+};
+
+/// field mapper using an r/z field map file
+using MappedBFieldMapperRZ = InterpolatedBFieldMapper<detail::GridView<
+    Vector2, detail::EquidistantAxis, detail::EquidistantAxis>>;
+/// field mapper using an x/y/z field map file
+using MappedBFieldMapperXYZ = InterpolatedBFieldMapper<
+    detail::GridView<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                     detail::EquidistantAxis>>;
+
+/// @brief create a field mapper using the values of an r/z field map file
+///
+/// @param [in] file mapped field map file, kept alive by the mapper
+/// @return mapper with the same transformations as created by fieldMapperRZ
+/// @throws std::invalid_argument if the file does not contain an r/z map
+MappedBFieldMapperRZ mappedFieldMapperRZ(
+    std::shared_ptr<const BFieldMapFile> file);
+
+/// @brief create a field mapper using the values of an x/y/z field map file
+///
+/// @param [in] file mapped field map file, kept alive by the mapper
+/// @return mapper with the same transformations as created by fieldMapperXYZ
+/// @throws std::invalid_argument if the file does not contain an x/y/z map
+MappedBFieldMapperXYZ mappedFieldMapperXYZ(
+    std::shared_ptr<const BFieldMapFile> file);
+
+/// @brief write the grid of an r/z field mapper to a field map file
+///
+/// @param [in] path path of the field map file
+/// @param [in] mapper mapper as created by fieldMapperRZ or solenoidFieldMapper
+void writeBFieldMapFile(
+    const std::string& path,
+    const InterpolatedBFieldMapper<
+        detail::Grid<Vector2, detail::EquidistantAxis,
+                     detail::EquidistantAxis>>& mapper);
+
+/// @brief write the grid of an x/y/z field mapper to a field map file
+///
+/// @param [in] path path of the field map file
+/// @param [in] mapper mapper as created by fieldMapperXYZ
+void writeBFieldMapFile(
+    const std::string& path,
+    const InterpolatedBFieldMapper<
+        detail::Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                     detail::EquidistantAxis>>& mapper);
+
+}  // namespace Acts
@@ -0,0 +1,177 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/// Storage policies for the field values of Acts::InterpolatedBFieldMapper.
+///
+/// A storage policy defines the type of the values stored in the grid
+/// (@c value_type) and how they are decoded into the full precision field
+/// values (@c field_type) used for the interpolation:
+///
+/// @code
+/// field_type decode(const value_type& value, size_t globalBin) const;
+/// @endcode
+///
+/// Policies storing compressed values additionally provide a constructor
+/// from the full precision grid and an @c encode function with the inverse
+/// signature to be used with Acts::compressFieldGrid.
+
+namespace Acts {
+
+/// @brief field values stored as they are
+///
+/// @tparam field_t type of the field values
+template <typename field_t>
+struct DirectBFieldStorage {
+  using value_type = field_t;
+  using field_type = field_t;
+
+  /// @brief decode a stored field value
+  ///
+  /// @param [in] value stored value
+  /// @return the stored value itself
+  const field_type& decode(const value_type& value, size_t /*bin*/) const {
+    return value;
+  }
+};
+
+/// @brief field values stored in single precision
+///
+/// @tparam DIM_BFIELD Dimensionality of the field values
+///
+/// Halves the memory of the field map. The relative precision of the stored
+/// values is about 1e-7, far below the accuracy of any measured field map.
+template <size_t DIM_BFIELD>
+struct FloatBFieldStorage {
+  using value_type = Eigen::Matrix<float, DIM_BFIELD, 1>;
+  using field_type = ActsVector<DIM_BFIELD>;
+
+  FloatBFieldStorage() = default;
+
+  /// @brief create storage for the given full precision field values
+  template <typename grid_t>
+  FloatBFieldStorage(const grid_t& /*grid*/) {}
+
+  /// @brief encode a field value
+  ///
+  /// @param [in] field full precision field value
+  /// @return single precision value
+  value_type encode(const field_type& field, size_t /*bin*/) const {
+    return field.template cast<float>();
+  }
+
+  /// @brief decode a stored field value
+  ///
+  /// @param [in] value single precision value
+  /// @return full precision field value
+  field_type decode(const value_type& value, size_t /*bin*/) const {
+    return value.template cast<ActsScalar>();
+  }
+};
+
+/// @brief field values stored as 16-bit fixed-point numbers
+///
+/// @tparam DIM_BFIELD Dimensionality of the field values
+/// @tparam REGION_SIZE number of consecutive global bins sharing a scale
+///
+/// Reduces the memory of the field map to a quarter. Each region of
+/// consecutive global bins, i.e. along the last axis of the grid, has its own
+/// scale derived from the largest field component within the region. The
+/// absolute precision of the stored values is thus about 1.5e-5 of the
+/// largest field component in the region.
+template <size_t DIM_BFIELD, size_t REGION_SIZE = 64>
+struct FixedPointBFieldStorage {
+  using value_type = std::array<int16_t, DIM_BFIELD>;
+  using field_type = ActsVector<DIM_BFIELD>;
+
+  static_assert(0 < REGION_SIZE, "Regions must not be empty");
+
+  FixedPointBFieldStorage() = default;
+
+  /// @brief create storage for the given full precision field values
+  ///
+  /// @param [in] grid grid with full precision field values
+  template <typename grid_t>
+  FixedPointBFieldStorage(const grid_t& grid)
+      : m_scales((grid.size() + REGION_SIZE - 1) / REGION_SIZE, 0.) {
+    for (size_t bin = 0; bin < grid.size(); ++bin) {
+      ActsScalar& scale = m_scales[bin / REGION_SIZE];
+      scale = std::max(scale, grid.at(bin).cwiseAbs().maxCoeff() / kMaxValue);
+    }
+  }
+
+  /// @brief encode a field value
+  ///
+  /// @param [in] field full precision field value
+  /// @param [in] bin global bin of the value
+  /// @return fixed-point value
+  value_type encode(const field_type& field, size_t bin) const {
+    value_type value{};
+    ActsScalar scale = m_scales.at(bin / REGION_SIZE);
+    if (scale == 0.) {
+      return value;
+    }
+    for (size_t i = 0; i < DIM_BFIELD; ++i) {
+      ActsScalar scaled =
+          std::clamp(std::round(field[i] / scale), -kMaxValue, kMaxValue);
+      value[i] = static_cast<int16_t>(scaled);
+    }
+    return value;
+  }
+
+  /// @brief decode a stored field value
+  ///
+  /// @param [in] value fixed-point value
+  /// @param [in] bin global bin of the value
+  /// @return full precision field value
+  field_type decode(const value_type& value, size_t bin) const {
+    ActsScalar scale = m_scales[bin / REGION_SIZE];
+    field_type field;
+    for (size_t i = 0; i < DIM_BFIELD; ++i) {
+      field[i] = scale * value[i];
+    }
+    return field;
+  }
+
+ private:
+  static constexpr ActsScalar kMaxValue = std::numeric_limits<int16_t>::max();
+
+  /// scale of the fixed-point values in each region
+  std::vector<ActsScalar> m_scales;
+};
+
+/// @brief encode the values of a full precision field grid
+///
+/// @tparam storage_t storage policy of the encoded values
+/// @param [in] grid grid with full precision field values
+/// @return grid with the encoded values and the storage needed to decode them
+template <typename storage_t, typename T, class... Axes>
+std::pair<detail::Grid<typename storage_t::value_type, Axes...>, storage_t>
+compressFieldGrid(const detail::Grid<T, Axes...>& grid) {
+  storage_t storage(grid);
+  detail::Grid<typename storage_t::value_type, Axes...> compressed(
+      grid.axesTuple());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    compressed.at(bin) = storage.encode(grid.at(bin), bin);
+  }
+  return {std::move(compressed), std::move(storage)};
+}
+
+}  // namespace Acts
@@ -11,6 +11,8 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 
+#include <limits>
+
 namespace Acts {
 
 /// @ingroup MagneticField
@@ -56,6 +58,42 @@ class ConstantBField final : public MagneticFieldProvider {
     return m_BField;
   }
 
+  /// @brief retrieve magnetic field value using the concrete cache type
+  ///
+  /// Non-virtual version of the lookup for callers that know the field type.
+  ///
+  /// @note The @p position is ignored and only kept as argument to provide
+  ///       a consistent interface with other magnetic field services.
+  Vector3 getField(const Vector3& /*position*/, Cache& /*cache*/) const {
+    return m_BField;
+  }
+
+  /// @copydoc MagneticFieldProvider::getFieldBatch
+  void getFieldBatch(
+      const Eigen::Ref<const BatchMatrix>& /*positions*/,
+      Eigen::Ref<BatchMatrix> fields,
+      MagneticFieldProvider::Cache& /*cache*/) const override {
+    fields.colwise() = m_BField;
+  }
+
+  /// @copydoc MagneticFieldProvider::homogeneousDistance
+  ///
+  /// @note The field is homogeneous everywhere.
+  double homogeneousDistance(
+      const Vector3& /*position*/,
+      MagneticFieldProvider::Cache& /*cache*/) const override {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  /// @brief distance within which the field is homogeneous using the concrete
+  /// cache type
+  ///
+  /// @note The field is homogeneous everywhere.
+  double homogeneousDistance(const Vector3& /*position*/,
+                             Cache& /*cache*/) const {
+    return std::numeric_limits<double>::infinity();
+  }
+
   /// @copydoc MagneticFieldProvider::getFieldGradient(const
   /// Vector3&,ActsMatrix<3,3>&)
   ///
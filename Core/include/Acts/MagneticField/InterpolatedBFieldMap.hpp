@@ -9,13 +9,17 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
@@ -28,13 +32,25 @@ namespace Acts {
 /// Global 3D positions are transformed into a @c DIM_POS Dimensional
 /// vector which
 /// is used to look up the magnetic field value in the underlying field map.
-template <typename G>
+///
+/// @tparam G grid storing the magnetic field values
+/// @tparam storage_t storage policy of the grid values, see
+///         BFieldMapStorage.hpp. The interpolation is always done with the
+///         decoded full precision field values.
+template <typename G,
+          typename storage_t = DirectBFieldStorage<typename G::value_type>>
 struct InterpolatedBFieldMapper {
  public:
   using Grid_t = G;
-  using FieldType = typename Grid_t::value_type;
+  using Storage_t = storage_t;
+  using FieldType = typename Storage_t::field_type;
   static constexpr size_t DIM_POS = Grid_t::DIM;
 
+  static_assert(
+      std::is_same_v<typename Grid_t::value_type,
+                     typename Storage_t::value_type>,
+      "The grid must store the values of the storage policy");
+
   /// @brief struct representing smallest grid unit in magnetic field grid
   ///
   /// This type encapsulate all required information to perform linear
@@ -82,7 +98,75 @@ struct InterpolatedBFieldMapper {
     /// @return @c true if position is inside the current field cell,
     ///         otherwise @c false
     bool isInside(const Vector3& position) const {
-      const auto& gridCoordinates = m_transformPos(position);
+      return isInsideGrid(m_transformPos(position));
+    }
+
+    /// @brief retrieve field at consecutive positions inside this cell
+    ///
+    /// @param [in] positions global 3D positions, one per column
+    /// @param [in] begin index of the first position to evaluate
+    /// @param [out] fields magnetic field values, one per column
+    /// @return number of evaluated positions starting at @p begin
+    ///
+    /// Evaluates up to kBatchWidth positions and stops at the first position
+    /// outside of this cell, i.e. returns zero if the position at @p begin is
+    /// outside. The interpolation loops always run over the full batch width
+    /// so they can be vectorised by the compiler.
+    size_t getFieldBatch(
+        const Eigen::Ref<const MagneticFieldProvider::BatchMatrix>& positions,
+        size_t begin,
+        Eigen::Ref<MagneticFieldProvider::BatchMatrix> fields) const {
+      // relative position within the cell along each dimension; unused
+      // points are placed at the lower-left corner.
+      std::array<std::array<double, kBatchWidth>, DIM_POS> fractions{};
+      size_t end = std::min<size_t>(positions.cols(), begin + kBatchWidth);
+      size_t n = 0;
+      for (size_t i = begin; i < end; ++i, ++n) {
+        const auto& gridPosition = m_transformPos(positions.col(i));
+        if (not isInsideGrid(gridPosition)) {
+          break;
+        }
+        for (size_t d = 0; d < DIM_POS; ++d) {
+          fractions[d][n] = (gridPosition[d] - m_lowerLeft[d]) /
+                            (m_upperRight[d] - m_lowerLeft[d]);
+        }
+      }
+      if (n == 0) {
+        return 0;
+      }
+
+      // multi-linear interpolation as the weighted sum over all corners. the
+      // first dimension corresponds to the most significant bit of the corner
+      // number; see Acts::interpolate for the ordering.
+      std::array<std::array<double, kBatchWidth>, 3> result{};
+      for (size_t c = 0; c < N; ++c) {
+        std::array<double, kBatchWidth> weight;
+        weight.fill(1.);
+        for (size_t d = 0; d < DIM_POS; ++d) {
+          const bool upper = ((c >> (DIM_POS - 1 - d)) & 1u) != 0u;
+          for (size_t j = 0; j < kBatchWidth; ++j) {
+            weight[j] *= upper ? fractions[d][j] : (1. - fractions[d][j]);
+          }
+        }
+        for (size_t k = 0; k < 3; ++k) {
+          for (size_t j = 0; j < kBatchWidth; ++j) {
+            result[k][j] += weight[j] * m_fieldValues[c][k];
+          }
+        }
+      }
+
+      for (size_t j = 0; j < n; ++j) {
+        fields.col(begin + j) << result[0][j], result[1][j], result[2][j];
+      }
+      return n;
+    }
+
+    /// number of positions interpolated together in getFieldBatch
+    static constexpr size_t kBatchWidth = 8;
+
+   private:
+    /// @brief check whether given grid position is inside this field cell
+    bool isInsideGrid(const ActsVector<DIM_POS>& gridCoordinates) const {
       for (unsigned int i = 0; i < DIM_POS; ++i) {
         if (gridCoordinates[i] < m_lowerLeft.at(i) ||
             gridCoordinates[i] >= m_upperRight.at(i)) {
@@ -92,7 +176,6 @@ struct InterpolatedBFieldMapper {
       return true;
     }
 
-   private:
     /// geometric transformation applied to global 3D positions
     std::function<ActsVector<DIM_POS>(const Vector3&)> m_transformPos;
 
@@ -117,13 +200,33 @@ struct InterpolatedBFieldMapper {
   /// (cartesian) of the magnetic field with the local n dimensional field and
   /// the global 3D position as input
   /// @param [in] grid      grid storing magnetic field values
+  /// @param [in] storage   storage policy to decode the grid values
   InterpolatedBFieldMapper(
       std::function<ActsVector<DIM_POS>(const Vector3&)> transformPos,
       std::function<Vector3(const FieldType&, const Vector3&)> transformBField,
-      Grid_t grid)
+      Grid_t grid, Storage_t storage = Storage_t())
       : m_transformPos(std::move(transformPos)),
         m_transformBField(std::move(transformBField)),
-        m_grid(std::move(grid)) {}
+        m_grid(std::move(grid)),
+        m_storage(std::move(storage)) {}
+
+  /// @brief create a mapper storing the field values with a different policy
+  ///
+  /// @tparam other_storage_t storage policy of the new mapper
+  /// @return mapper with the same transformations and encoded field values
+  ///
+  /// @note Only mappers storing the full precision field values can be
+  ///       compressed.
+  template <typename other_storage_t>
+  auto compress() const {
+    static_assert(
+        std::is_same_v<Storage_t, DirectBFieldStorage<FieldType>>,
+        "Only full precision field values can be compressed");
+    auto [grid, storage] = compressFieldGrid<other_storage_t>(m_grid);
+    return InterpolatedBFieldMapper<decltype(grid), other_storage_t>(
+        m_transformPos, m_transformBField, std::move(grid),
+        std::move(storage));
+  }
 
   /// @brief retrieve field at given position
   ///
@@ -133,8 +236,25 @@ struct InterpolatedBFieldMapper {
   /// @pre The given @c position must lie within the range of the underlying
   ///      magnetic field map.
   Vector3 getField(const Vector3& position) const {
-    return m_transformBField(m_grid.interpolate(m_transformPos(position)),
-                             position);
+    if constexpr (std::is_same_v<Storage_t, DirectBFieldStorage<FieldType>>) {
+      return m_transformBField(m_grid.interpolate(m_transformPos(position)),
+                               position);
+    } else {
+      const auto& gridPosition = m_transformPos(position);
+      const auto& indices = m_grid.localBinsFromPosition(gridPosition);
+
+      constexpr size_t nCorners = 1 << DIM_POS;
+      std::array<FieldType, nCorners> neighbors;
+      size_t i = 0;
+      for (size_t index : m_grid.closestPointsIndicesFromLocalBins(indices)) {
+        neighbors[i++] = m_storage.decode(m_grid.at(index), index);
+      }
+
+      return m_transformBField(
+          interpolate(gridPosition, m_grid.lowerLeftBinEdge(indices),
+                      m_grid.upperRightBinEdge(indices), neighbors),
+          position);
+    }
   }
 
   /// @brief retrieve field cell for given position
@@ -153,11 +273,13 @@ struct InterpolatedBFieldMapper {
     // loop through all corner points
     constexpr size_t nCorners = 1 << DIM_POS;
     std::array<Vector3, nCorners> neighbors;
-    const auto& cornerIndices = m_grid.closestPointsIndices(gridPosition);
+    const auto& cornerIndices =
+        m_grid.closestPointsIndicesFromLocalBins(indices);
 
     size_t i = 0;
     for (size_t index : cornerIndices) {
-      neighbors.at(i++) = m_transformBField(m_grid.at(index), position);
+      neighbors.at(i++) = m_transformBField(
+          m_storage.decode(m_grid.at(index), index), position);
     }
 
     return FieldCell(m_transformPos, lowerLeft, upperRight,
@@ -202,6 +324,24 @@ struct InterpolatedBFieldMapper {
   /// @return grid reference
   const Grid_t& getGrid() const { return m_grid; }
 
+  /// @brief Get a const reference on the storage policy of the grid values
+  ///
+  /// @return storage reference
+  const Storage_t& getStorage() const { return m_storage; }
+
+  /// @brief Get the mapping of global 3D positions onto grid space
+  const std::function<ActsVector<DIM_POS>(const Vector3&)>& getTransformPos()
+      const {
+    return m_transformPos;
+  }
+
+  /// @brief Get the transformation of grid field values into global 3D
+  /// field values
+  const std::function<Vector3(const FieldType&, const Vector3&)>&
+  getTransformBField() const {
+    return m_transformBField;
+  }
+
  private:
   /// geometric transformation applied to global 3D positions
   std::function<ActsVector<DIM_POS>(const Vector3&)> m_transformPos;
@@ -211,6 +351,8 @@ struct InterpolatedBFieldMapper {
   std::function<Vector3(const FieldType&, const Vector3&)> m_transformBField;
   /// grid storing magnetic field values
   Grid_t m_grid;
+  /// decoding of the stored grid values
+  Storage_t m_storage;
 };
 
 /// @ingroup MagneticField
@@ -309,13 +451,53 @@ class InterpolatedBFieldMap final : public MagneticFieldProvider {
   /// Vector3&,MagneticFieldProvider::Cache&)
   Vector3 getField(const Vector3& position,
                    MagneticFieldProvider::Cache& gcache) const override {
-    Cache& cache = gcache.get<Cache>();
+    return getField(position, gcache.get<Cache>());
+  }
+
+  /// @brief retrieve magnetic field value using the concrete cache type
+  ///
+  /// @param [in] position global 3D position
+  /// @param [in,out] cache Cache object. Contains field cell used for
+  ///                       interpolation
+  /// @return magnetic field vector at given position
+  ///
+  /// Non-virtual version of the lookup for callers that know the field type.
+  Vector3 getField(const Vector3& position, Cache& cache) const {
     if (!cache.fieldCell || !(*cache.fieldCell).isInside(position)) {
       cache.fieldCell = getFieldCell(position);
     }
     return (*cache.fieldCell).getField(position);
   }
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch
+  ///
+  /// Consecutive positions within the same field cell are interpolated
+  /// together, i.e. the batch should be ordered by proximity if possible.
+  void getFieldBatch(const Eigen::Ref<const BatchMatrix>& positions,
+                     Eigen::Ref<BatchMatrix> fields,
+                     MagneticFieldProvider::Cache& gcache) const override {
+    Cache& cache = gcache.get<Cache>();
+    size_t n = positions.cols();
+    size_t i = 0;
+    while (i < n) {
+      size_t m = 0;
+      if (cache.fieldCell) {
+        m = (*cache.fieldCell).getFieldBatch(positions, i, fields);
+      }
+      if (m == 0) {
+        cache.fieldCell = getFieldCell(positions.col(i));
+        m = (*cache.fieldCell).getFieldBatch(positions, i, fields);
+      }
+      if (m == 0) {
+        // positions on the upper edge of the map are not inside any cell but
+        // are still interpolated by the single position lookup
+        fields.col(i) = (*cache.fieldCell).getField(positions.col(i));
+        m = 1;
+      }
+      i += m;
+    }
+  }
+
   /// @copydoc MagneticFieldProvider::getFieldGradient(const
   /// Vector3&,ActsMatrix<3,3>&)
   ///
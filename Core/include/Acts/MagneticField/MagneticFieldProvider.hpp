@@ -21,6 +21,8 @@ namespace Acts {
 class MagneticFieldProvider {
  public:
   using Cache = detail::SmallObjectCache;
+  /// Positions or field values of several points, one point per column
+  using BatchMatrix = Eigen::Matrix<ActsScalar, 3, Eigen::Dynamic>;
 
   /// @brief Make an opaque cache for the magnetic field
   ///
@@ -44,6 +46,41 @@ class MagneticFieldProvider {
   /// @return magnetic field vector at given position
   virtual Vector3 getField(const Vector3& position) const = 0;
 
+  /// @brief retrieve magnetic field values at several positions at once
+  ///
+  /// @param [in] positions global 3D positions, one per column
+  /// @param [out] fields magnetic field vectors, one per column; must have
+  ///              the same number of columns as @p positions
+  /// @param [in,out] cache Cache object
+  ///
+  /// The positions are independent of each other, e.g. the positions of
+  /// different tracks, and are evaluated with a single dispatch. Field
+  /// providers can use vectorised kernels; by default, the positions are
+  /// evaluated one after the other.
+  virtual void getFieldBatch(const Eigen::Ref<const BatchMatrix>& positions,
+                             Eigen::Ref<BatchMatrix> fields,
+                             Cache& cache) const {
+    for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+      fields.col(i) = getField(positions.col(i), cache);
+    }
+  }
+
+  /// @brief distance within which the field is homogeneous
+  ///
+  /// @param [in] position global 3D position
+  /// @param [in,out] cache Cache object
+  ///
+  /// Within a sphere of the returned radius around @p position, the field
+  /// is equal to the field at @p position. Steppers can use this to follow
+  /// the analytic solution of the equations of motion. By default, no
+  /// homogeneous region is reported.
+  ///
+  /// @return radius of the homogeneous region, zero if there is none
+  virtual double homogeneousDistance(const Vector3& /*position*/,
+                                     Cache& /*cache*/) const {
+    return 0.;
+  }
+
   /// @brief retrieve magnetic field value & its gradient
   ///
   /// @param [in]  position   global 3D position
@@ -43,6 +43,14 @@ class NullBField final : public MagneticFieldProvider {
     return m_BField;
   }
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch
+  void getFieldBatch(
+      const Eigen::Ref<const BatchMatrix>& /*positions*/,
+      Eigen::Ref<BatchMatrix> fields,
+      MagneticFieldProvider::Cache& /*cache*/) const override {
+    fields.colwise() = m_BField;
+  }
+
   /// @copydoc MagneticFieldProvider::getFieldGradient(const
   /// Vector3&,ActsMatrix<3,3>&)
   ///
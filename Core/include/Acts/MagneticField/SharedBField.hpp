@@ -45,6 +45,13 @@ class SharedBField final : public MagneticFieldProvider {
     return m_bField->getField(position, cache);
   }
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch
+  void getFieldBatch(const Eigen::Ref<const BatchMatrix>& positions,
+                     Eigen::Ref<BatchMatrix> fields,
+                     MagneticFieldProvider::Cache& cache) const override {
+    m_bField->getFieldBatch(positions, fields, cache);
+  }
+
   /// @copydoc MagneticFieldProvider::getFieldGradient(const
   /// Vector3&,ActsMatrix<3,3>&)
   Vector3 getFieldGradient(const Vector3& position,
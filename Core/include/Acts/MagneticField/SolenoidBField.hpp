@@ -9,10 +9,13 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 
 #include <functional>
+#include <memory>
+#include <string>
 
 namespace Acts {
 
@@ -65,6 +68,12 @@ namespace Acts {
 ///  z           4pi    __ |  |           2    |  2          1       |
 ///                   |/Rr |_ \   2r(1 - k )   /                    _|
 ///
+/// Optionally, the field is interpolated in an r/z table instead. The table
+/// is built from the analytic solution on first use, with a resolution chosen
+/// such that the interpolation error stays below a configured tolerance. The
+/// field is singular at the coils, i.e. the error is not controlled close to
+/// them. Outside of the table the field is still evaluated analytically.
+///
 class SolenoidBField final : public MagneticFieldProvider {
  public:
   struct Cache {
@@ -88,11 +97,39 @@ class SolenoidBField final : public MagneticFieldProvider {
     double bMagCenter;
   };
 
+  /// Config struct for the r/z interpolation table
+  struct TableConfig {
+    /// Extent of the table in r, zero selects twice the radius
+    double rMax = 0.;
+    /// Extent of the table in z from -zMax to +zMax, zero selects the length
+    double zMax = 0.;
+    /// Maximum interpolation error relative to the field in the center
+    double tolerance = 1e-3;
+    /// Distance to the coils within which the error is not controlled
+    double coilMargin = 10. * UnitConstants::cm;
+    /// Maximum number of bins along r and along z
+    size_t maxBins = 2048;
+    /// Optional binary field map file to persist the table. An existing file
+    /// is used if its extent matches and its interpolation error is within
+    /// the tolerance, otherwise the table is built and written to the file.
+    /// The file is replaced atomically, so it can be shared between processes.
+    std::string file;
+  };
+
   /// @brief the constructur with a shared pointer
   /// @note since it is a shared field, we enforce it to be const
   /// @tparam bField is the shared BField to be stored
   SolenoidBField(Config config);
 
+  /// @brief constructor for a field interpolated in an r/z table
+  ///
+  /// @param config the solenoid configuration
+  /// @param tableConfig the table configuration
+  ///
+  /// The table is built from the analytic solution on first use, or read from
+  /// the configured file.
+  SolenoidBField(Config config, TableConfig tableConfig);
+
   /// @brief Retrieve magnetic field value in local (r,z) coordinates
   ///
   /// @param [in] position local 2D position
@@ -110,6 +147,27 @@ class SolenoidBField final : public MagneticFieldProvider {
   Vector3 getField(const Vector3& position,
                    MagneticFieldProvider::Cache& /*cache*/) const override;
 
+  /// @brief retrieve magnetic field value using the concrete cache type
+  ///
+  /// Non-virtual version of the lookup for callers that know the field type.
+  ///
+  /// @param [in] position global 3D position
+  Vector3 getField(const Vector3& position, Cache& /*cache*/) const {
+    return getField(position);
+  }
+
+  /// @copydoc MagneticFieldProvider::getFieldBatch
+  ///
+  /// Evaluates several positions together with vectorisable loops. The
+  /// elliptic integrals are computed using the arithmetic-geometric mean
+  /// instead of the generic implementation used for single positions; both
+  /// agree to close to machine precision. If the field is tabulated, the
+  /// positions are looked up in the table one by one.
+  void getFieldBatch(
+      const Eigen::Ref<const BatchMatrix>& positions,
+      Eigen::Ref<BatchMatrix> fields,
+      MagneticFieldProvider::Cache& /*cache*/) const override;
+
   /// @copydoc MagneticFieldProvider::getFieldGradient(const
   /// Vector3&,ActsMatrix<3,3>&)
   ///
@@ -128,10 +186,24 @@ class SolenoidBField final : public MagneticFieldProvider {
       MagneticFieldProvider::Cache& /*cache*/) const override;
 
  private:
+  struct Table;
+
   Config m_cfg;
+  TableConfig m_tableCfg;
   double m_scale;
   double m_dz;
   double m_R2;
+  /// shared by copies, built on first use
+  std::shared_ptr<Table> m_table;
+
+  const Table& table() const;
+
+  void buildTable(Table& table) const;
+
+  bool useTable(const Table& table, double r, double z) const;
+
+  void multiCoilFieldBatch(const Eigen::Ref<const BatchMatrix>& positions,
+                           Eigen::Ref<BatchMatrix> fields) const;
 
   Vector2 multiCoilField(const Vector2& pos, double scale) const;
 
@@ -0,0 +1,127 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Workaround for building on clang+libstdc++
+#include "Acts/Utilities/detail/ReferenceWrapperAnyCompat.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Volume.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/BatchedEigenStepper.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Options for the batched propagation
+struct BatchPropagatorOptions {
+  /// Constructor from the contexts
+  BatchPropagatorOptions(const GeometryContext& gctx,
+                         const MagneticFieldContext& mctx)
+      : geoContext(gctx), magFieldContext(mctx) {}
+
+  /// Mass of the particles
+  double mass = 139.57018 * UnitConstants::MeV;
+
+  /// Maximum number of steps per track
+  unsigned int maxSteps = 1000;
+
+  /// Absolute maximum step size
+  double maxStepSize = std::numeric_limits<double>::max();
+
+  /// Absolute maximum path length
+  double pathLimit = std::numeric_limits<double>::max();
+
+  /// Tracks stop at the first step which leaves this volume, if given
+  const Volume* volume = nullptr;
+
+  /// Tolerance for the error of the integration
+  double tolerance = 1e-4;
+
+  /// Cut-off value for the step size
+  double stepSizeCutOff = 0.;
+
+  /// Cut-off value for the number of trials of a Runge-Kutta step
+  unsigned int maxRungeKuttaStepTrials = 10000;
+
+  /// The context object for the geometry
+  std::reference_wrapper<const GeometryContext> geoContext;
+
+  /// The context object for the magnetic field
+  std::reference_wrapper<const MagneticFieldContext> magFieldContext;
+};
+
+/// @brief Result of the batched propagation of a single track
+struct BatchPropagatorResult {
+  /// Final track parameters
+  std::unique_ptr<const CurvilinearTrackParameters> endParameters = nullptr;
+
+  /// Full transport jacobian, if the covariance was transported
+  std::unique_ptr<const BoundMatrix> transportJacobian = nullptr;
+
+  /// Number of propagation steps that were carried out
+  unsigned int steps = 0;
+
+  /// Distance over which the parameters were propagated
+  double pathLength = 0.;
+
+  /// Whether the track stopped because it left the volume
+  bool leftVolume = false;
+};
+
+/// @brief Propagation of many independent tracks in lockstep
+///
+/// The tracks are propagated forward through the magnetic field without
+/// navigation, W at a time with the BatchedEigenStepper. A track stops when
+/// it reaches the path limit, when it leaves the volume given in the
+/// options or when it fails. Its lane is then refilled with the next track
+/// such that all lanes stay busy. This is meant for large productions of
+/// independent particles, e.g. for propagation tests or the simulation of
+/// the particle transport to the detector.
+///
+/// @tparam W The number of tracks propagated in lockstep
+template <unsigned int W>
+class BatchPropagator {
+ public:
+  using Stepper = BatchedEigenStepper<W>;
+
+  /// Constructor from the stepper
+  ///
+  /// @param [in] stepper The batched stepper
+  explicit BatchPropagator(Stepper stepper) : m_stepper(std::move(stepper)) {}
+
+  /// Propagate a set of tracks
+  ///
+  /// @tparam parameters_t Type of the start parameters
+  ///
+  /// @param [in] start The start parameters of the tracks
+  /// @param [in] options The propagation options
+  ///
+  /// @return One result per track, in the order of @p start
+  template <typename parameters_t>
+  std::vector<Result<BatchPropagatorResult>> propagate(
+      const std::vector<parameters_t>& start,
+      const BatchPropagatorOptions& options) const;
+
+ private:
+  /// The batched stepper
+  Stepper m_stepper;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/BatchPropagator.ipp"
@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cmath>
+
+template <unsigned int W>
+template <typename parameters_t>
+auto Acts::BatchPropagator<W>::propagate(
+    const std::vector<parameters_t>& start,
+    const BatchPropagatorOptions& options) const
+    -> std::vector<Result<BatchPropagatorResult>> {
+  std::vector<Result<BatchPropagatorResult>> results;
+  results.reserve(start.size());
+  for (size_t i = 0; i < start.size(); ++i) {
+    results.emplace_back(PropagatorError::Failure);
+  }
+
+  auto state = m_stepper.makeState(options.geoContext, options.magFieldContext);
+  const double pathLimit = std::abs(options.pathLimit);
+  const double maxStepSize = std::abs(options.maxStepSize);
+
+  // The track and the number of steps of every lane
+  std::array<size_t, W> tracks{};
+  std::array<unsigned int, W> steps{};
+  size_t nextTrack = 0;
+
+  // Fill a lane with the next track, it stays inactive if there is none
+  auto fillLane = [&](unsigned int lane) {
+    if (nextTrack < start.size()) {
+      m_stepper.loadTrack(state, lane, start[nextTrack]);
+      tracks[lane] = nextTrack++;
+      steps[lane] = 0;
+    }
+  };
+  // Store the result of a lane and refill it
+  auto finishLane = [&](unsigned int lane, bool leftVolume) {
+    BatchPropagatorResult result;
+    auto [parameters, jacobian, pathLength] =
+        m_stepper.curvilinearState(state, lane);
+    result.endParameters = std::make_unique<const CurvilinearTrackParameters>(
+        std::move(parameters));
+    if (state.covTransport[lane]) {
+      result.transportJacobian = std::make_unique<const BoundMatrix>(jacobian);
+    }
+    result.steps = steps[lane];
+    result.pathLength = pathLength;
+    result.leftVolume = leftVolume;
+    results[tracks[lane]] = std::move(result);
+    state.active[lane] = false;
+    fillLane(lane);
+  };
+
+  for (unsigned int lane = 0; lane < W; ++lane) {
+    fillLane(lane);
+  }
+
+  while (state.active.any()) {
+    // The remaining path limits the step
+    state.stepLimit = (pathLimit - state.pathAccumulated).min(maxStepSize);
+    const auto stepped = state.active;
+    m_stepper.step(state, options);
+
+    for (unsigned int lane = 0; lane < W; ++lane) {
+      if (!stepped[lane]) {
+        continue;
+      }
+      if (state.error[lane]) {
+        results[tracks[lane]] = state.error[lane];
+        fillLane(lane);
+        continue;
+      }
+      ++steps[lane];
+      if (options.volume != nullptr &&
+          !options.volume->inside(
+              state.pos.row(lane).transpose().matrix().eval())) {
+        finishLane(lane, true);
+      } else if (pathLimit - state.pathAccumulated[lane] <
+                 s_onSurfaceTolerance) {
+        finishLane(lane, false);
+      } else if (steps[lane] >= options.maxSteps) {
+        results[tracks[lane]] = PropagatorError::StepCountLimitReached;
+        state.active[lane] = false;
+        fillLane(lane);
+      }
+    }
+  }
+  return results;
+}
@@ -0,0 +1,228 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Workaround for building on clang+libstdc++
+#include "Acts/Utilities/detail/ReferenceWrapperAnyCompat.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <tuple>
+
+namespace Acts {
+
+/// @brief Runge-Kutta-Nystroem stepper advancing several tracks in lockstep
+///
+/// The stepper solves the same equations of motion with the same step size
+/// control as the EigenStepper, but for @p W independent tracks at once. The
+/// tracks are stored as structure of arrays, i.e. every quantity is an array
+/// over the W lanes, such that the Runge-Kutta stages and the update of the
+/// 8x8 transport Jacobians are vectorised across the tracks. W should be a
+/// multiple of the SIMD width of the target.
+///
+/// Lanes are masked by the @c active flags of the state: inactive lanes are
+/// advanced with a zero step and do not change. Rejected steps are retried
+/// only for the affected lanes, the magnetic field is evaluated with a single
+/// MagneticFieldProvider::getFieldBatch call for the lanes which need it.
+///
+/// There are no extensions and no navigation, the stepper is driven by the
+/// BatchPropagator.
+///
+/// @tparam W The number of tracks propagated in lockstep
+template <unsigned int W>
+class BatchedEigenStepper {
+ public:
+  /// One value per lane
+  using Lanes = Eigen::Array<double, W, 1>;
+  /// One flag per lane
+  using Mask = Eigen::Array<bool, W, 1>;
+  /// One 3D vector per lane, the components are stored as columns
+  using Vector3Lanes = Eigen::Array<double, W, 3>;
+  /// One free matrix per lane, the column-major matrix elements are stored as
+  /// columns
+  using FreeMatrixLanes = Eigen::Array<double, W, eFreeSize * eFreeSize>;
+  /// One free vector per lane
+  using FreeVectorLanes = Eigen::Array<double, W, eFreeSize>;
+
+  using Jacobian = BoundMatrix;
+  using Covariance = BoundSymMatrix;
+  using CurvilinearState =
+      std::tuple<CurvilinearTrackParameters, Jacobian, double>;
+
+  /// @brief State of the W tracks
+  struct State {
+    State() = delete;
+
+    /// Constructor with all lanes inactive
+    ///
+    /// @param [in] gctx is the context object for the geometry
+    /// @param [in] fieldCacheIn is the magnetic field cache
+    State(const GeometryContext& gctx,
+          MagneticFieldProvider::Cache fieldCacheIn)
+        : fieldCache(std::move(fieldCacheIn)), geoContext(gctx) {
+      // inactive lanes have to stay finite with a zero step
+      dir.col(0).setOnes();
+      jacTransport.setZero();
+      for (unsigned int i = 0; i < eFreeSize; ++i) {
+        jacTransport.col(i * eFreeSize + i).setOnes();
+      }
+    }
+
+    /// Global positions
+    Vector3Lanes pos = Vector3Lanes::Zero();
+
+    /// Normalised momentum directions
+    Vector3Lanes dir = Vector3Lanes::Zero();
+
+    /// Charge over momentum, or 1/p for neutral particles
+    Lanes qop = Lanes::Ones();
+
+    /// The charges
+    Lanes q = Lanes::Zero();
+
+    /// The times
+    Lanes time = Lanes::Zero();
+
+    /// Accumulated path lengths
+    Lanes pathAccumulated = Lanes::Zero();
+
+    /// Adaptive step sizes of the runge-kutta integration
+    Lanes stepSize = Lanes::Constant(std::numeric_limits<double>::max());
+
+    /// Limits of the next step, e.g. from the remaining path
+    Lanes stepLimit = Lanes::Constant(std::numeric_limits<double>::max());
+
+    /// Lanes which are propagated
+    Mask active = Mask::Constant(false);
+
+    /// Lanes which transport a covariance
+    Mask covTransport = Mask::Constant(false);
+
+    /// Errors of the last step, lanes which fail are deactivated
+    std::array<std::error_code, W> error;
+
+    /// Pure transport jacobians from runge kutta integration
+    FreeMatrixLanes jacTransport;
+
+    /// The propagation derivatives
+    FreeVectorLanes derivative = FreeVectorLanes::Zero();
+
+    /// Covariance matrices associated with the initial error
+    std::array<Covariance, W> cov;
+
+    /// Jacobians from local to the global frame
+    std::array<BoundToFreeMatrix, W> jacToGlobal;
+
+    /// The magnetic field cache
+    MagneticFieldProvider::Cache fieldCache;
+
+    /// The geometry context
+    std::reference_wrapper<const GeometryContext> geoContext;
+
+    /// @brief Storage of magnetic field and the sub steps during a RKN4 step
+    struct {
+      /// Magnetic field evaulations
+      Vector3Lanes B_first, B_middle, B_last;
+      /// k_i of the RKN4 algorithm
+      Vector3Lanes k1, k2, k3, k4;
+    } stepData;
+  };
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  BatchedEigenStepper(std::shared_ptr<const MagneticFieldProvider> bField)
+      : m_bField(std::move(bField)) {}
+
+  /// Create a state with all lanes inactive
+  ///
+  /// @param [in] gctx is the context object for the geometry
+  /// @param [in] mctx is the context object for the magnetic field
+  State makeState(std::reference_wrapper<const GeometryContext> gctx,
+                  std::reference_wrapper<const MagneticFieldContext> mctx)
+      const {
+    return State{gctx, m_bField->makeCache(mctx)};
+  }
+
+  /// Load a track into a lane and activate it
+  ///
+  /// @tparam charge_t Type of the bound parameter charge
+  ///
+  /// @param [in,out] state is the state of the tracks
+  /// @param [in] lane is the lane to be filled
+  /// @param [in] par are the track parameters at start
+  /// @param [in] ssize is the maximum step size
+  template <typename charge_t>
+  void loadTrack(State& state, unsigned int lane,
+                 const SingleBoundTrackParameters<charge_t>& par,
+                 double ssize = std::numeric_limits<double>::max()) const;
+
+  /// Create the curvilinear state of a lane at the current position
+  ///
+  /// @param [in,out] state is the state of the tracks
+  /// @param [in] lane is the lane to be presented
+  ///
+  /// @return A curvilinear state:
+  ///   - the curvilinear parameters at given position
+  ///   - the stepweise jacobian towards it (from the start)
+  ///   - and the path length (from start - for ordering)
+  CurvilinearState curvilinearState(State& state, unsigned int lane) const;
+
+  /// Perform a Runge-Kutta step for all active lanes
+  ///
+  /// The step size of every lane is the smaller one of its adaptive step
+  /// size and its step limit. Lanes which fail are deactivated and the error
+  /// is recorded in the state.
+  ///
+  /// @tparam options_t Type of the options, with the members mass,
+  ///                   tolerance, stepSizeCutOff and maxRungeKuttaStepTrials
+  ///
+  /// @param [in,out] state is the state of the tracks
+  /// @param [in] options are the propagation options
+  ///
+  /// @return the performed step sizes, zero for inactive lanes
+  template <typename options_t>
+  Lanes step(State& state, const options_t& options) const;
+
+ private:
+  /// Evaluate the magnetic field for the selected lanes
+  ///
+  /// @param [in,out] state is the state of the tracks
+  /// @param [in] pos are the positions of the lanes
+  /// @param [in] mask selects the lanes to be evaluated
+  /// @param [in,out] field are the field values, unchanged for other lanes
+  void getField(State& state, const Vector3Lanes& pos, const Mask& mask,
+                Vector3Lanes& field) const;
+
+  /// Update the transport jacobians with the last step
+  ///
+  /// @param [in,out] state is the state of the tracks
+  /// @param [in] h are the step sizes
+  /// @param [in] mass is the particle mass
+  void transportJacobians(State& state, const Lanes& h, double mass) const;
+
+  /// Lane-wise cross product
+  static Vector3Lanes cross(const Vector3Lanes& a, const Vector3Lanes& b);
+
+  /// Magnetic field inside of the detector
+  std::shared_ptr<const MagneticFieldProvider> m_bField;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/BatchedEigenStepper.ipp"
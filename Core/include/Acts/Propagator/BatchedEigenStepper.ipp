@@ -0,0 +1,283 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+
+#include <cmath>
+
+template <unsigned int W>
+template <typename charge_t>
+void Acts::BatchedEigenStepper<W>::loadTrack(
+    State& state, unsigned int lane,
+    const SingleBoundTrackParameters<charge_t>& par, double ssize) const {
+  const Vector3 pos = par.position(state.geoContext);
+  const Vector3 dir = par.unitDirection();
+  for (unsigned int i = 0; i < 3; ++i) {
+    state.pos(lane, i) = pos[i];
+    state.dir(lane, i) = dir[i];
+  }
+  state.qop[lane] = par.parameters()[eBoundQOverP];
+  state.q[lane] = par.charge();
+  state.time[lane] = par.time();
+  state.pathAccumulated[lane] = 0.;
+  state.stepSize[lane] = std::abs(ssize);
+  state.stepLimit[lane] = std::numeric_limits<double>::max();
+  state.active[lane] = true;
+  state.error[lane] = std::error_code();
+
+  // Reinitialize the stepping jacobian
+  for (unsigned int i = 0; i < eFreeSize * eFreeSize; ++i) {
+    state.jacTransport(lane, i) = (i % (eFreeSize + 1) == 0) ? 1. : 0.;
+  }
+  state.derivative.row(lane).setZero();
+  state.covTransport[lane] = par.covariance().has_value();
+  if (par.covariance()) {
+    state.cov[lane] = *par.covariance();
+    state.jacToGlobal[lane] = par.referenceSurface().jacobianLocalToGlobal(
+        state.geoContext, par.parameters());
+  } else {
+    state.cov[lane] = Covariance::Zero();
+    state.jacToGlobal[lane] = BoundToFreeMatrix::Zero();
+  }
+}
+
+template <unsigned int W>
+auto Acts::BatchedEigenStepper<W>::curvilinearState(State& state,
+                                                   unsigned int lane) const
+    -> CurvilinearState {
+  FreeVector pars;
+  pars.template segment<3>(eFreePos0) = state.pos.row(lane).transpose();
+  pars[eFreeTime] = state.time[lane];
+  pars.template segment<3>(eFreeDir0) = state.dir.row(lane).transpose();
+  pars[eFreeQOverP] = state.qop[lane];
+
+  Jacobian jacobian = Jacobian::Identity();
+  FreeMatrix jacTransport =
+      Eigen::Map<const FreeMatrix>(state.jacTransport.row(lane).eval().data());
+  FreeVector derivative = state.derivative.row(lane).transpose();
+  return detail::curvilinearState(state.cov[lane], jacobian, jacTransport,
+                                  derivative, state.jacToGlobal[lane], pars,
+                                  state.covTransport[lane],
+                                  state.pathAccumulated[lane]);
+}
+
+template <unsigned int W>
+template <typename options_t>
+auto Acts::BatchedEigenStepper<W>::step(State& state,
+                                        const options_t& options) const
+    -> Lanes {
+  auto& sd = state.stepData;
+  const auto& pos = state.pos;
+  const auto& dir = state.dir;
+  // Neutral particles are not deflected
+  const Lanes qop = (state.q == 0.).select(0., state.qop);
+
+  // Inactive lanes are advanced with a zero step
+  Lanes h = state.active.select(state.stepSize.min(state.stepLimit), 0.);
+  if (!state.active.any()) {
+    return h;
+  }
+  Lanes h2 = Lanes::Zero();
+  Lanes half_h = Lanes::Zero();
+
+  // First Runge-Kutta point (at current position)
+  getField(state, pos, state.active, sd.B_first);
+  sd.k1 = cross(dir, sd.B_first).colwise() * qop;
+
+  // The stages are evaluated for all lanes, lanes with an accepted step are
+  // evaluated again with the same step and give the same result. Only the
+  // field is evaluated for the pending lanes.
+  Mask pending = state.active;
+  Lanes errorEstimate;
+  unsigned int nStepTrials = 0;
+  while (pending.any()) {
+    // State the square and half of the step size
+    h2 = h * h;
+    half_h = h * 0.5;
+
+    // Second Runge-Kutta point
+    const Vector3Lanes pos1 = pos + dir.colwise() * half_h +
+                              sd.k1.colwise() * (h2 * 0.125);
+    getField(state, pos1, pending, sd.B_middle);
+    sd.k2 = cross(dir + sd.k1.colwise() * half_h, sd.B_middle).colwise() * qop;
+
+    // Third Runge-Kutta point
+    sd.k3 = cross(dir + sd.k2.colwise() * half_h, sd.B_middle).colwise() * qop;
+
+    // Last Runge-Kutta point
+    const Vector3Lanes pos2 =
+        pos + dir.colwise() * h + sd.k3.colwise() * (h2 * 0.5);
+    getField(state, pos2, pending, sd.B_last);
+    sd.k4 = cross(dir + sd.k3.colwise() * h, sd.B_last).colwise() * qop;
+
+    // Compute and check the local integration error estimate
+    errorEstimate =
+        (h2 * (sd.k1 - sd.k2 - sd.k3 + sd.k4).abs().rowwise().sum()).max(1e-20);
+    pending = pending && (errorEstimate > options.tolerance);
+    if (!pending.any()) {
+      break;
+    }
+
+    // Reduce the step size of the rejected lanes as given in
+    // ATL-SOFT-PUB-2009-001
+    const Lanes stepSizeScaling =
+        (options.tolerance / (2. * errorEstimate)).pow(0.25).max(0.25).min(4.);
+    h = pending.select(h * stepSizeScaling, h);
+    state.stepSize = pending.select(h, state.stepSize);
+
+    for (unsigned int lane = 0; lane < W; ++lane) {
+      if (!pending[lane]) {
+        continue;
+      }
+      // If step size becomes too small the particle remains at the initial
+      // place, if there are too many trials the step size is not appropriate
+      if (std::abs(h[lane]) < std::abs(options.stepSizeCutOff)) {
+        state.error[lane] = EigenStepperError::StepSizeStalled;
+      } else if (nStepTrials > options.maxRungeKuttaStepTrials) {
+        state.error[lane] = EigenStepperError::StepSizeAdjustmentFailed;
+      } else {
+        continue;
+      }
+      pending[lane] = false;
+      state.active[lane] = false;
+      h[lane] = 0.;
+    }
+    nStepTrials++;
+  }
+  // Lanes dropped in the last trial have a zero step and must not move
+  h2 = h * h;
+
+  // When doing error propagation, update the associated Jacobian matrices
+  if ((state.active && state.covTransport).any()) {
+    transportJacobians(state, h, options.mass);
+  }
+
+  // The time is propagated with dt/ds = sqrt(m^2/p^2 + c^{-2})
+  const Lanes p = ((state.q == 0.).select(1., state.q) / state.qop).abs();
+  const Lanes dtds = (1. + (options.mass / p).square()).sqrt();
+  state.time += h * dtds;
+
+  // Update the track parameters according to the equations of motion
+  state.pos += dir.colwise() * h +
+               (sd.k1 + sd.k2 + sd.k3).colwise() * (h2 / 6.);
+  state.dir += (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4).colwise() * (h / 6.);
+  state.dir.colwise() /= state.dir.square().rowwise().sum().sqrt();
+
+  state.derivative.template leftCols<3>() = state.dir;
+  state.derivative.col(eFreeTime) = dtds;
+  state.derivative.template middleCols<3>(eFreeDir0) = sd.k4;
+  state.pathAccumulated += h;
+  return h;
+}
+
+template <unsigned int W>
+void Acts::BatchedEigenStepper<W>::getField(State& state,
+                                            const Vector3Lanes& pos,
+                                            const Mask& mask,
+                                            Vector3Lanes& field) const {
+  // Gather the positions of the selected lanes for a single field call
+  Eigen::Matrix<double, 3, W> positions;
+  Eigen::Matrix<double, 3, W> fields;
+  std::array<unsigned int, W> lanes;
+  Eigen::Index n = 0;
+  for (unsigned int lane = 0; lane < W; ++lane) {
+    if (mask[lane]) {
+      positions.col(n) = pos.row(lane).transpose();
+      lanes[n++] = lane;
+    }
+  }
+  if (n == 0) {
+    return;
+  }
+  m_bField->getFieldBatch(positions.leftCols(n), fields.leftCols(n),
+                          state.fieldCache);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    field.row(lanes[i]) = fields.col(i).transpose();
+  }
+}
+
+template <unsigned int W>
+void Acts::BatchedEigenStepper<W>::transportJacobians(State& state,
+                                                      const Lanes& h,
+                                                      double mass) const {
+  // This is the transport matrix of the GenericDefaultExtension, evaluated
+  // for all lanes at once. The 3x3 blocks are stored column by column.
+  const auto& sd = state.stepData;
+  const auto& dir = state.dir;
+  const Lanes qop = (state.q == 0.).select(0., state.qop);
+  const Lanes half_h = h * 0.5;
+
+  // Derivatives of the k_i w.r.t. lambda = q/p
+  const Vector3Lanes dk1dL = cross(dir, sd.B_first);
+  const Vector3Lanes dk2dL =
+      cross(dir + sd.k1.colwise() * half_h, sd.B_middle) +
+      cross(dk1dL, sd.B_middle).colwise() * (qop * half_h);
+  const Vector3Lanes dk3dL =
+      cross(dir + sd.k2.colwise() * half_h, sd.B_middle) +
+      cross(dk2dL, sd.B_middle).colwise() * (qop * half_h);
+  const Vector3Lanes dk4dL = cross(dir + sd.k3.colwise() * h, sd.B_last) +
+                             cross(dk3dL, sd.B_last).colwise() * (qop * h);
+  const Vector3Lanes dFdL =
+      (dk1dL + dk2dL + dk3dL).colwise() * (h * h / 6.);
+  const Vector3Lanes dGdL =
+      (dk1dL + 2. * (dk2dL + dk3dL) + dk4dL).colwise() * (h / 6.);
+
+  // Derivatives of the k_i w.r.t. the direction, column by column
+  std::array<Vector3Lanes, 3> dFdT, dGdT;
+  for (unsigned int j = 0; j < 3; ++j) {
+    Vector3Lanes unit = Vector3Lanes::Zero();
+    unit.col(j).setOnes();
+    const Vector3Lanes dk1dT = cross(unit, sd.B_first).colwise() * qop;
+    const Vector3Lanes dk2dT =
+        cross(unit + dk1dT.colwise() * half_h, sd.B_middle).colwise() * qop;
+    const Vector3Lanes dk3dT =
+        cross(unit + dk2dT.colwise() * half_h, sd.B_middle).colwise() * qop;
+    const Vector3Lanes dk4dT =
+        cross(unit + dk3dT.colwise() * h, sd.B_last).colwise() * qop;
+    dFdT[j] = (unit + (dk1dT + dk2dT + dk3dT).colwise() * (h / 6.))
+                  .colwise() *
+              h;
+    dGdT[j] =
+        unit + (dk1dT + 2. * (dk2dT + dk3dT) + dk4dT).colwise() * (h / 6.);
+  }
+
+  // Derivative of the time w.r.t. lambda
+  const Lanes p = ((state.q == 0.).select(1., state.q) / state.qop).abs();
+  const Lanes dtdL = h * mass * mass * state.q /
+                     (p * (1. + (mass / p).square()).sqrt());
+
+  // Multiply the transport matrix from the left, column by column
+  auto& J = state.jacTransport;
+  for (unsigned int c = 0; c < eFreeSize; ++c) {
+    const unsigned int o = c * eFreeSize;
+    const Lanes jT0 = J.col(o + eFreeDir0);
+    const Lanes jT1 = J.col(o + eFreeDir1);
+    const Lanes jT2 = J.col(o + eFreeDir2);
+    const Lanes jL = J.col(o + eFreeQOverP);
+    for (unsigned int r = 0; r < 3; ++r) {
+      J.col(o + eFreePos0 + r) += dFdT[0].col(r) * jT0 +
+                                  dFdT[1].col(r) * jT1 +
+                                  dFdT[2].col(r) * jT2 + dFdL.col(r) * jL;
+      J.col(o + eFreeDir0 + r) = dGdT[0].col(r) * jT0 +
+                                 dGdT[1].col(r) * jT1 +
+                                 dGdT[2].col(r) * jT2 + dGdL.col(r) * jL;
+    }
+    J.col(o + eFreeTime) += dtdL * jL;
+  }
+}
+
+template <unsigned int W>
+auto Acts::BatchedEigenStepper<W>::cross(const Vector3Lanes& a,
+                                         const Vector3Lanes& b)
+    -> Vector3Lanes {
+  Vector3Lanes c;
+  c.col(0) = a.col(1) * b.col(2) - a.col(2) * b.col(1);
+  c.col(1) = a.col(2) * b.col(0) - a.col(0) * b.col(2);
+  c.col(2) = a.col(0) * b.col(1) - a.col(1) * b.col(0);
+  return c;
+}
@@ -0,0 +1,420 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Workaround for building on clang+libstdc++
+#include "Acts/Utilities/detail/ReferenceWrapperAnyCompat.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/detail/SteppingHelper.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace Acts {
+
+using namespace Acts::UnitLiterals;
+
+/// @brief Embedded Runge-Kutta stepper of Dormand-Prince type for the
+/// following ODE:
+///
+/// r = (x,y,z)    ... global position
+/// T = (Ax,Ay,Az) ... momentum direction (normalized)
+///
+/// dr/ds = T
+/// dT/ds = q/p * (T x B)
+///
+/// with s being the arc length of the track, q the charge of the particle,
+/// p the momentum magnitude and B the magnetic field
+///
+/// Each step is performed with the 5th order Dormand-Prince scheme (DOPRI5),
+/// the embedded 4th order solution provides the local error estimate. The
+/// last stage is evaluated at the end point of the step, its magnetic field
+/// is reused as the first stage of the next step (first same as last). A
+/// step therefore requires six field evaluations, in exchange it is much
+/// longer than a step of the EigenStepper at the same accuracy.
+///
+/// The local error is compared to the tolerance of the propagator options
+/// and the step size is adapted with a proportional-integral controller, i.e.
+/// the step size also grows again once the field becomes more homogeneous.
+///
+/// The stepper integrates in vacuum only, it does not provide the extension
+/// mechanism of the EigenStepper. As for the EigenStepper, a concrete field
+/// type can be given as @p bfield_t to resolve the field lookup at compile
+/// time.
+///
+template <typename bfield_t = MagneticFieldProvider>
+class DormandPrinceStepper {
+ public:
+  /// Type of the magnetic field
+  using BField = bfield_t;
+  /// Type of the magnetic field cache
+  using BFieldCache = typename bfield_t::Cache;
+
+  /// Jacobian, Covariance and State defintions
+  using Jacobian = BoundMatrix;
+  using Covariance = BoundSymMatrix;
+  using BoundState = std::tuple<BoundTrackParameters, Jacobian, double>;
+  using CurvilinearState =
+      std::tuple<CurvilinearTrackParameters, Jacobian, double>;
+
+  /// Number of stages of the scheme
+  static constexpr unsigned int s_stages = 7;
+
+  /// @brief State for track parameter propagation
+  ///
+  /// It contains the stepping information and is provided thread local
+  /// by the propagator
+  struct State {
+    State() = delete;
+
+    /// Constructor from the initial bound track parameters
+    ///
+    /// @tparam charge_t Type of the bound parameter charge
+    ///
+    /// @param [in] gctx is the context object for the geometry
+    /// @param [in] fieldCacheIn is the cache object for the magnetic field
+    /// @param [in] par The track parameters at start
+    /// @param [in] ndir The navigation direciton w.r.t momentum
+    /// @param [in] ssize is the maximum step size
+    /// @param [in] stolerance is the stepping tolerance
+    ///
+    /// @note the covariance matrix is copied when needed
+    template <typename charge_t>
+    explicit State(const GeometryContext& gctx, BFieldCache fieldCacheIn,
+                   const SingleBoundTrackParameters<charge_t>& par,
+                   NavigationDirection ndir = forward,
+                   double ssize = std::numeric_limits<double>::max(),
+                   double stolerance = s_onSurfaceTolerance)
+        : q(par.charge()),
+          navDir(ndir),
+          stepSize(ndir * std::abs(ssize)),
+          tolerance(stolerance),
+          fieldCache(std::move(fieldCacheIn)),
+          geoContext(gctx) {
+      pars.template segment<3>(eFreePos0) = par.position(gctx);
+      pars.template segment<3>(eFreeDir0) = par.unitDirection();
+      pars[eFreeTime] = par.time();
+      pars[eFreeQOverP] = par.parameters()[eBoundQOverP];
+
+      // Init the jacobian matrix if needed
+      if (par.covariance()) {
+        // Get the reference surface for navigation
+        const auto& surface = par.referenceSurface();
+        // set the covariance transport flag to true and copy
+        covTransport = true;
+        cov = BoundSymMatrix(*par.covariance());
+        jacToGlobal = surface.jacobianLocalToGlobal(gctx, par.parameters());
+      }
+    }
+
+    /// Internal free vector parameters
+    FreeVector pars = FreeVector::Zero();
+
+    /// The charge as the free vector can be 1/p or q/p
+    double q = 1.;
+
+    /// Covariance matrix (and indicator)
+    /// associated with the initial error on track parameters
+    bool covTransport = false;
+    Covariance cov = Covariance::Zero();
+
+    /// Navigation direction, this is needed for searching
+    NavigationDirection navDir;
+
+    /// The full jacobian of the transport entire transport
+    Jacobian jacobian = Jacobian::Identity();
+
+    /// Jacobian from local to the global frame
+    BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+
+    /// Pure transport jacobian part from runge kutta integration
+    FreeMatrix jacTransport = FreeMatrix::Identity();
+
+    /// The propagation derivative
+    FreeVector derivative = FreeVector::Zero();
+
+    /// Accummulated path length state
+    double pathAccumulated = 0.;
+
+    /// Adaptive step size of the runge-kutta integration
+    ConstrainedStep stepSize{std::numeric_limits<double>::max()};
+
+    /// Last performed step (for overstep limit calculation)
+    double previousStepSize = 0.;
+
+    /// The tolerance for the stepping
+    double tolerance = s_onSurfaceTolerance;
+
+    /// Relative error of the last accepted step for the step size controller
+    double previousError = 1e-4;
+
+    /// This caches the current magnetic field cell and stays
+    /// (and interpolates) within it as long as this is valid.
+    /// See step() code for details.
+    BFieldCache fieldCache;
+
+    /// The geometry context
+    std::reference_wrapper<const GeometryContext> geoContext;
+
+    /// @brief Storage of the stages during a step
+    struct {
+      /// Magnetic field at the stages
+      std::array<Vector3, s_stages> B;
+      /// Directions at the stages
+      std::array<Vector3, s_stages> T;
+      /// Derivatives of the direction at the stages
+      std::array<Vector3, s_stages> k;
+      /// Position of the last stage of the previous step
+      Vector3 lastPosition = Vector3::Zero();
+      /// Flag if the field of the last stage can be reused
+      bool lastValid = false;
+    } stepData;
+  };
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  DormandPrinceStepper(std::shared_ptr<const bfield_t> bField);
+
+  template <typename charge_t>
+  State makeState(std::reference_wrapper<const GeometryContext> gctx,
+                  std::reference_wrapper<const MagneticFieldContext> mctx,
+                  const SingleBoundTrackParameters<charge_t>& par,
+                  NavigationDirection ndir = forward,
+                  double ssize = std::numeric_limits<double>::max(),
+                  double stolerance = s_onSurfaceTolerance) const;
+
+  /// @brief Resets the state
+  ///
+  /// @param [in, out] state State of the stepper
+  /// @param [in] boundParams Parameters in bound parametrisation
+  /// @param [in] cov Covariance matrix
+  /// @param [in] surface The reference surface of the bound parameters
+  /// @param [in] navDir Navigation direction
+  /// @param [in] stepSize Step size
+  void resetState(
+      State& state, const BoundVector& boundParams, const BoundSymMatrix& cov,
+      const Surface& surface, const NavigationDirection navDir = forward,
+      const double stepSize = std::numeric_limits<double>::max()) const;
+
+  /// Get the field for the stepping, it checks first if the access is still
+  /// within the Cell, and updates the cell if necessary.
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  ///                 the magnetic field cell is used (and potentially updated)
+  /// @param [in] pos is the field position
+  Vector3 getField(State& state, const Vector3& pos) const {
+    // get the field from the cell
+    return m_bField->getField(pos, state.fieldCache);
+  }
+
+  /// Global particle position accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  Vector3 position(const State& state) const {
+    return state.pars.template segment<3>(eFreePos0);
+  }
+
+  /// Momentum direction accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  Vector3 direction(const State& state) const {
+    return state.pars.template segment<3>(eFreeDir0);
+  }
+
+  /// Absolute momentum accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double momentum(const State& state) const {
+    return std::abs((state.q == 0. ? 1. : state.q) / state.pars[eFreeQOverP]);
+  }
+
+  /// Charge access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double charge(const State& state) const { return state.q; }
+
+  /// Time access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double time(const State& state) const { return state.pars[eFreeTime]; }
+
+  /// Update surface status
+  ///
+  /// It checks the status to the reference surface & updates
+  /// the step size accordingly
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param surface [in] The surface provided
+  /// @param bcheck [in] The boundary check for this status update
+  Intersection3D::Status updateSurfaceStatus(
+      State& state, const Surface& surface, const BoundaryCheck& bcheck) const {
+    return detail::updateSingleSurfaceStatus<DormandPrinceStepper>(
+        *this, state, surface, bcheck);
+  }
+
+  /// Update step size
+  ///
+  /// This method intersects the provided surface and update the navigation
+  /// step estimation accordingly (hence it changes the state). It also
+  /// returns the status of the intersection to trigger onSurface in case
+  /// the surface is reached.
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param oIntersection [in] The ObjectIntersection to layer, boundary, etc
+  /// @param release [in] boolean to trigger step size release
+  template <typename object_intersection_t>
+  void updateStepSize(State& state, const object_intersection_t& oIntersection,
+                      bool release = true) const {
+    detail::updateSingleStepSize<DormandPrinceStepper>(state, oIntersection,
+                                                       release);
+  }
+
+  /// Set Step size - explicitely with a double
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param stepSize [in] The step size value
+  /// @param stype [in] The step size type to be set
+  void setStepSize(State& state, double stepSize,
+                   ConstrainedStep::Type stype = ConstrainedStep::actor) const {
+    state.previousStepSize = state.stepSize;
+    state.stepSize.update(stepSize, stype, true);
+  }
+
+  /// Release the Step size
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  void releaseStepSize(State& state) const {
+    state.stepSize.release(ConstrainedStep::actor);
+  }
+
+  /// Output the Step Size - single component
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  std::string outputStepSize(const State& state) const {
+    return state.stepSize.toString();
+  }
+
+  /// Overstep limit
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double overstepLimit(const State& /*state*/) const {
+    // A dynamic overstep limit could sit here
+    return -m_overstepLimit;
+  }
+
+  /// Create and return the bound state at the current position
+  ///
+  /// @brief This transports (if necessary) the covariance
+  /// to the surface and creates a bound state. It does not check
+  /// if the transported state is at the surface, this needs to
+  /// be guaranteed by the propagator
+  ///
+  /// @param [in] state State that will be presented as @c BoundState
+  /// @param [in] surface The surface to which we bind the state
+  /// @param [in] transportCov Flag steering covariance transport
+  ///
+  /// @return A bound state:
+  ///   - the parameters at the surface
+  ///   - the stepwise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  Result<BoundState> boundState(State& state, const Surface& surface,
+                                bool transportCov = true) const;
+
+  /// Create and return a curvilinear state at the current position
+  ///
+  /// @brief This transports (if necessary) the covariance
+  /// to the current position and creates a curvilinear state.
+  ///
+  /// @param [in] state State that will be presented as @c CurvilinearState
+  /// @param [in] transportCov Flag steering covariance transport
+  ///
+  /// @return A curvilinear state:
+  ///   - the curvilinear parameters at given position
+  ///   - the stepweise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  CurvilinearState curvilinearState(State& state,
+                                    bool transportCov = true) const;
+
+  /// Method to update a stepper state to the some parameters
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] pars Parameters that will be written into @p state
+  void update(State& state, const FreeVector& parameters,
+              const Covariance& covariance) const;
+
+  /// Method to update momentum, direction and p
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] uposition the updated position
+  /// @param [in] udirection the updated direction
+  /// @param [in] up the updated momentum value
+  void update(State& state, const Vector3& uposition, const Vector3& udirection,
+              double up, double time) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current  position,
+  /// or direction of the state
+  ///
+  /// @param [in,out] state State of the stepper
+  ///
+  /// @return the full transport jacobian
+  void covarianceTransport(State& state) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current position,
+  /// or direction of the state
+  ///
+  /// @tparam surface_t the Surface type
+  ///
+  /// @param [in,out] state State of the stepper
+  /// @param [in] surface is the surface to which the covariance is forwarded to
+  /// @note no check is done if the position is actually on the surface
+  void covarianceTransport(State& state, const Surface& surface) const;
+
+  /// Perform a Dormand-Prince track parameter propagation step
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///
+  ///                      the state contains the desired step size.
+  ///                      It can be negative during backwards track
+  ///                      propagation,
+  ///                      and since we're using an adaptive algorithm, it can
+  ///                      be modified by the stepper class during propagation.
+  template <typename propagator_state_t>
+  Result<double> step(propagator_state_t& state) const;
+
+ private:
+  /// Calculate the transport matrix of an accepted step
+  ///
+  /// @param [in] state is the stepping state holding the stages of the step
+  /// @param [in] qop is the charge over momentum of the step
+  /// @param [in] h is the step size
+  /// @param [out] D is the transport matrix
+  void transportMatrix(const State& state, double qop, double h,
+                       FreeMatrix& D) const;
+
+  /// Magnetic field inside of the detector
+  std::shared_ptr<const bfield_t> m_bField;
+
+  /// Overstep limit: could/should be dynamic
+  double m_overstepLimit = 100_um;
+};
+}  // namespace Acts
+
+#include "Acts/Propagator/DormandPrinceStepper.ipp"
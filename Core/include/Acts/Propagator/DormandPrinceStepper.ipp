@@ -0,0 +1,321 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/detail/TransformationBoundToFree.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <algorithm>
+
+namespace Acts {
+namespace detail {
+
+/// @brief Coefficients of the DOPRI5 scheme and of the step size controller
+///
+/// The coefficients are taken from J. R. Dormand and P. J. Prince, A family
+/// of embedded Runge-Kutta formulae, J. Comp. Appl. Math. 6 (1980) 19-26,
+/// the controller follows E. Hairer, S. P. Norsett and G. Wanner, Solving
+/// Ordinary Differential Equations I, Springer (1993), section II.4.
+struct DormandPrinceTableau {
+  /// Coefficients of the stages, the last row holds the weights of the
+  /// 5th order solution, i.e. the last stage is evaluated at the end point
+  static constexpr double a[7][6] = {
+      {0., 0., 0., 0., 0., 0.},
+      {1. / 5., 0., 0., 0., 0., 0.},
+      {3. / 40., 9. / 40., 0., 0., 0., 0.},
+      {44. / 45., -56. / 15., 32. / 9., 0., 0., 0.},
+      {19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0., 0.},
+      {9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176.,
+       -5103. / 18656., 0.},
+      {35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784.,
+       11. / 84.}};
+
+  /// Difference of the weights of the 5th and the 4th order solution
+  static constexpr double e[7] = {
+      71. / 57600.,  0.,           -71. / 16695., 71. / 1920.,
+      -17253. / 339200., 22. / 525., -1. / 40.};
+
+  /// Safety factor of the step size prediction
+  static constexpr double safety = 0.9;
+  /// Exponents of the current and the previous error
+  static constexpr double alpha = 0.17;
+  static constexpr double beta = 0.04;
+  /// Limits of the step size change per step
+  static constexpr double minScale = 0.2;
+  static constexpr double maxScale = 10.;
+};
+
+}  // namespace detail
+}  // namespace Acts
+
+template <typename B>
+Acts::DormandPrinceStepper<B>::DormandPrinceStepper(
+    std::shared_ptr<const B> bField)
+    : m_bField(std::move(bField)) {}
+
+template <typename B>
+template <typename charge_t>
+auto Acts::DormandPrinceStepper<B>::makeState(
+    std::reference_wrapper<const GeometryContext> gctx,
+    std::reference_wrapper<const MagneticFieldContext> mctx,
+    const SingleBoundTrackParameters<charge_t>& par, NavigationDirection ndir,
+    double ssize, double stolerance) const -> State {
+  if constexpr (std::is_same_v<B, MagneticFieldProvider>) {
+    return State{gctx, m_bField->makeCache(mctx), par, ndir, ssize,
+                 stolerance};
+  } else {
+    return State{gctx, BFieldCache(mctx), par, ndir, ssize, stolerance};
+  }
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::resetState(
+    State& state, const BoundVector& boundParams, const BoundSymMatrix& cov,
+    const Surface& surface, const NavigationDirection navDir,
+    const double stepSize) const {
+  // Update the stepping state
+  update(state,
+         detail::transformBoundToFreeParameters(surface, state.geoContext,
+                                                boundParams),
+         cov);
+  state.navDir = navDir;
+  state.stepSize = ConstrainedStep(stepSize);
+  state.pathAccumulated = 0.;
+  state.previousError = 1e-4;
+
+  // Reinitialize the stepping jacobian
+  state.jacToGlobal =
+      surface.jacobianLocalToGlobal(state.geoContext, boundParams);
+  state.jacobian = BoundMatrix::Identity();
+  state.jacTransport = FreeMatrix::Identity();
+  state.derivative = FreeVector::Zero();
+}
+
+template <typename B>
+auto Acts::DormandPrinceStepper<B>::boundState(State& state,
+                                               const Surface& surface,
+                                               bool transportCov) const
+    -> Result<BoundState> {
+  return detail::boundState(
+      state.geoContext, state.cov, state.jacobian, state.jacTransport,
+      state.derivative, state.jacToGlobal, state.pars,
+      state.covTransport && transportCov, state.pathAccumulated, surface);
+}
+
+template <typename B>
+auto Acts::DormandPrinceStepper<B>::curvilinearState(State& state,
+                                                     bool transportCov) const
+    -> CurvilinearState {
+  return detail::curvilinearState(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, state.pars, state.covTransport && transportCov,
+      state.pathAccumulated);
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::update(State& state,
+                                           const FreeVector& parameters,
+                                           const Covariance& covariance) const {
+  state.pars = parameters;
+  state.cov = covariance;
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::update(State& state,
+                                           const Vector3& uposition,
+                                           const Vector3& udirection,
+                                           double up, double time) const {
+  state.pars.template segment<3>(eFreePos0) = uposition;
+  state.pars.template segment<3>(eFreeDir0) = udirection;
+  state.pars[eFreeTime] = time;
+  state.pars[eFreeQOverP] = (state.q != 0. ? state.q / up : 1. / up);
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::covarianceTransport(State& state) const {
+  detail::covarianceTransport(state.cov, state.jacobian, state.jacTransport,
+                              state.derivative, state.jacToGlobal,
+                              direction(state));
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::covarianceTransport(
+    State& state, const Surface& surface) const {
+  detail::covarianceTransport(state.geoContext.get(), state.cov, state.jacobian,
+                              state.jacTransport, state.derivative,
+                              state.jacToGlobal, state.pars, surface);
+}
+
+template <typename B>
+template <typename propagator_state_t>
+Acts::Result<double> Acts::DormandPrinceStepper<B>::step(
+    propagator_state_t& state) const {
+  using Tableau = detail::DormandPrinceTableau;
+
+  auto& sd = state.stepping.stepData;
+  const Vector3 pos = position(state.stepping);
+  const Vector3 dir = direction(state.stepping);
+  const double qop = charge(state.stepping) / momentum(state.stepping);
+
+  // First stage, the field of the last stage of the previous step is reused
+  // as long as the position was not changed in between
+  if (sd.lastValid && sd.lastPosition == pos) {
+    sd.B[0] = sd.B[s_stages - 1];
+  } else {
+    sd.B[0] = getField(state.stepping, pos);
+  }
+  sd.T[0] = dir;
+  sd.k[0] = qop * dir.cross(sd.B[0]);
+
+  // The following functor performs all remaining stages of a step of a
+  // certain size and compares the local error estimate to the tolerance
+  Vector3 endPosition = pos;
+  double error = 0.;
+  const auto tryStep = [&](const double h) -> bool {
+    for (unsigned int i = 1; i < s_stages; ++i) {
+      Vector3 dr = Vector3::Zero();
+      Vector3 dT = Vector3::Zero();
+      for (unsigned int j = 0; j < i; ++j) {
+        dr += Tableau::a[i][j] * sd.T[j];
+        dT += Tableau::a[i][j] * sd.k[j];
+      }
+      endPosition = pos + h * dr;
+      sd.T[i] = dir + h * dT;
+      sd.B[i] = getField(state.stepping, endPosition);
+      sd.k[i] = qop * sd.T[i].cross(sd.B[i]);
+    }
+
+    // Local error of the position and of the direction along the step,
+    // relative to the tolerance
+    Vector3 er = Vector3::Zero();
+    Vector3 ek = Vector3::Zero();
+    for (unsigned int i = 0; i < s_stages; ++i) {
+      er += Tableau::e[i] * sd.T[i];
+      ek += Tableau::e[i] * sd.k[i];
+    }
+    error = std::max(std::abs(h) * (er.template lpNorm<1>() +
+                                    std::abs(h) * ek.template lpNorm<1>()),
+                     1e-20) /
+            state.options.tolerance;
+    return (error <= 1.);
+  };
+
+  double h = state.stepping.stepSize;
+  size_t nStepTrials = 0;
+  while (!tryStep(h)) {
+    // After a rejection only the current error is used
+    const double stepSizeScaling = std::max(
+        Tableau::minScale, Tableau::safety * std::pow(error, -Tableau::alpha));
+    state.stepping.stepSize = h * stepSizeScaling;
+    h = state.stepping.stepSize;
+
+    // If step size becomes too small the particle remains at the initial
+    // place
+    if (std::abs(h) < std::abs(state.options.stepSizeCutOff)) {
+      // Not moving due to too low momentum needs an aborter
+      return EigenStepperError::StepSizeStalled;
+    }
+
+    // If the parameter is off track too much or given stepSize is not
+    // appropriate
+    if (nStepTrials > state.options.maxRungeKuttaStepTrials) {
+      // Too many trials, have to abort
+      return EigenStepperError::StepSizeAdjustmentFailed;
+    }
+    nStepTrials++;
+  }
+
+  // Proportional-integral control of the next step size, it is not increased
+  // directly after a rejection. The accuracy constraint is only decreased if
+  // it was limiting this step.
+  const double stepSizeScaling = std::clamp(
+      Tableau::safety * std::pow(error, -Tableau::alpha) *
+          std::pow(state.stepping.previousError, Tableau::beta),
+      Tableau::minScale, nStepTrials > 0 ? 1. : Tableau::maxScale);
+  state.stepping.previousError = std::max(error, 1e-4);
+  const double nextStepSize = h * stepSizeScaling;
+  if (state.stepping.stepSize.currentType() == ConstrainedStep::accuracy ||
+      std::abs(nextStepSize) >
+          std::abs(state.stepping.stepSize.value(ConstrainedStep::accuracy))) {
+    state.stepping.stepSize = nextStepSize;
+  }
+
+  // The time is propagated with dt/ds = sqrt(m^2/p^2 + c^{-2})
+  const double dtds =
+      std::hypot(1., state.options.mass / momentum(state.stepping));
+  state.stepping.pars[eFreeTime] += h * dtds;
+
+  // When doing error propagation, update the associated Jacobian matrix
+  if (state.stepping.covTransport) {
+    // The step transport matrix in global coordinates
+    FreeMatrix D;
+    transportMatrix(state.stepping, qop, h, D);
+    D(3, 7) = h * state.options.mass * state.options.mass *
+              charge(state.stepping) / (momentum(state.stepping) * dtds);
+
+    // for moment, only update the transport part
+    state.stepping.jacTransport = D * state.stepping.jacTransport;
+  }
+
+  // Update the track parameters to the 5th order solution
+  state.stepping.pars.template segment<3>(eFreePos0) = endPosition;
+  state.stepping.pars.template segment<3>(eFreeDir0) =
+      sd.T[s_stages - 1].normalized();
+  sd.lastPosition = endPosition;
+  sd.lastValid = true;
+
+  if (state.stepping.covTransport) {
+    state.stepping.derivative.template head<3>() =
+        state.stepping.pars.template segment<3>(eFreeDir0);
+    state.stepping.derivative(3) = dtds;
+    state.stepping.derivative.template segment<3>(4) = sd.k[s_stages - 1];
+  }
+  state.stepping.pathAccumulated += h;
+  return h;
+}
+
+template <typename B>
+void Acts::DormandPrinceStepper<B>::transportMatrix(const State& state,
+                                                    double qop, double h,
+                                                    FreeMatrix& D) const {
+  /// The derivatives of the stages w.r.t. the initial direction T and
+  /// lambda = q/p are propagated through the scheme as for the RKN4 in
+  /// ATL-SOFT-PUB-2009-002, the field gradient is neglected. The last stage
+  /// has zero weight in the 5th order solution and does not contribute.
+  using Tableau = detail::DormandPrinceTableau;
+  const auto& sd = state.stepData;
+  const auto& b = Tableau::a[s_stages - 1];
+
+  D = FreeMatrix::Identity();
+
+  // This sets the reference to the sub matrices
+  // dFdx is already initialised as (3x3) idendity
+  auto dFdT = D.block<3, 3>(0, 4);
+  auto dFdL = D.block<3, 1>(0, 7);
+  // dGdx is already initialised as (3x3) zero
+  auto dGdT = D.block<3, 3>(4, 4);
+  auto dGdL = D.block<3, 1>(4, 7);
+
+  std::array<ActsMatrix<3, 3>, s_stages - 1> dkdT;
+  std::array<Vector3, s_stages - 1> dkdL;
+  for (unsigned int i = 0; i < s_stages - 1; ++i) {
+    ActsMatrix<3, 3> dTdT = ActsMatrix<3, 3>::Identity();
+    Vector3 dTdL = Vector3::Zero();
+    for (unsigned int j = 0; j < i; ++j) {
+      dTdT += h * Tableau::a[i][j] * dkdT[j];
+      dTdL += h * Tableau::a[i][j] * dkdL[j];
+    }
+    dkdT[i] = qop * VectorHelpers::cross(dTdT, sd.B[i]);
+    dkdL[i] = sd.T[i].cross(sd.B[i]) + qop * dTdL.cross(sd.B[i]);
+
+    dFdT += h * b[i] * dTdT;
+    dFdL += h * b[i] * dTdL;
+    dGdT += h * b[i] * dkdT[i];
+    dGdL += h * b[i] * dkdL[i];
+  }
+}
@@ -16,15 +16,18 @@
 #include "Acts/Propagator/DefaultExtension.hpp"
 #include "Acts/Propagator/DenseEnvironmentExtension.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/NavigationProfile.hpp"
 #include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Propagator/detail/Auctioneer.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
+#include "Acts/Propagator/detail/TransportJacobians.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Result.hpp"
 
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <type_traits>
 
 namespace Acts {
 
@@ -42,10 +45,29 @@ using namespace Acts::UnitLiterals;
 /// with s being the arc length of the track, q the charge of the particle,
 /// p the momentum magnitude and B the magnetic field
 ///
+/// By default the magnetic field is accessed through the virtual
+/// MagneticFieldProvider interface. A concrete field type, e.g.
+/// ConstantBField, InterpolatedBFieldMap or SolenoidBField, can be given as
+/// @p bfield_t instead to resolve the field lookup and the field cache type at
+/// compile time.
+///
+/// With @p covariance_transport set to false the stepper never transports a
+/// covariance: the state carries no Jacobians, the transport matrix is not
+/// computed and the covariance of the start parameters is ignored. This is
+/// meant for propagation without errors, e.g. navigation checks or truth
+/// extrapolation.
+///
 template <typename extensionlist_t = StepperExtensionList<DefaultExtension>,
-          typename auctioneer_t = detail::VoidAuctioneer>
+          typename auctioneer_t = detail::VoidAuctioneer,
+          typename bfield_t = MagneticFieldProvider,
+          bool covariance_transport = true>
 class EigenStepper {
  public:
+  /// Type of the magnetic field
+  using BField = bfield_t;
+  /// Type of the magnetic field cache
+  using BFieldCache = typename bfield_t::Cache;
+
   /// Jacobian, Covariance and State defintions
   using Jacobian = BoundMatrix;
   using Covariance = BoundSymMatrix;
@@ -57,7 +79,7 @@ class EigenStepper {
   ///
   /// It contains the stepping information and is provided thread local
   /// by the propagator
-  struct State {
+  struct State : public detail::TransportJacobians<covariance_transport> {
     State() = delete;
 
     /// Constructor from the initial bound track parameters
@@ -73,8 +95,7 @@ class EigenStepper {
     ///
     /// @note the covariance matrix is copied when needed
     template <typename charge_t>
-    explicit State(const GeometryContext& gctx,
-                   MagneticFieldProvider::Cache fieldCacheIn,
+    explicit State(const GeometryContext& gctx, BFieldCache fieldCacheIn,
                    const SingleBoundTrackParameters<charge_t>& par,
                    NavigationDirection ndir = forward,
                    double ssize = std::numeric_limits<double>::max(),
@@ -91,13 +112,16 @@ class EigenStepper {
       pars[eFreeQOverP] = par.parameters()[eBoundQOverP];
 
       // Init the jacobian matrix if needed
-      if (par.covariance()) {
-        // Get the reference surface for navigation
-        const auto& surface = par.referenceSurface();
-        // set the covariance transport flag to true and copy
-        covTransport = true;
-        cov = BoundSymMatrix(*par.covariance());
-        jacToGlobal = surface.jacobianLocalToGlobal(gctx, par.parameters());
+      if constexpr (covariance_transport) {
+        if (par.covariance()) {
+          // Get the reference surface for navigation
+          const auto& surface = par.referenceSurface();
+          // set the covariance transport flag to true and copy
+          covTransport = true;
+          cov = BoundSymMatrix(*par.covariance());
+          this->jacToGlobal =
+              surface.jacobianLocalToGlobal(gctx, par.parameters());
+        }
       }
     }
 
@@ -115,18 +139,6 @@ class EigenStepper {
     /// Navigation direction, this is needed for searching
     NavigationDirection navDir;
 
-    /// The full jacobian of the transport entire transport
-    Jacobian jacobian = Jacobian::Identity();
-
-    /// Jacobian from local to the global frame
-    BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
-
-    /// Pure transport jacobian part from runge kutta integration
-    FreeMatrix jacTransport = FreeMatrix::Identity();
-
-    /// The propagation derivative
-    FreeVector derivative = FreeVector::Zero();
-
     /// Accummulated path length state
     double pathAccumulated = 0.;
 
@@ -136,13 +148,16 @@ class EigenStepper {
     /// Last performed step (for overstep limit calculation)
     double previousStepSize = 0.;
 
+    /// Navigation profile counters, empty if not compiled in
+    NavigationCountersStorage counters;
+
     /// The tolerance for the stepping
     double tolerance = s_onSurfaceTolerance;
 
     /// This caches the current magnetic field cell and stays
     /// (and interpolates) within it as long as this is valid.
     /// See step() code for details.
-    MagneticFieldProvider::Cache fieldCache;
+    BFieldCache fieldCache;
 
     /// The geometry context
     std::reference_wrapper<const GeometryContext> geoContext;
@@ -165,7 +180,7 @@ class EigenStepper {
   };
 
   /// Constructor requires knowledge of the detector's magnetic field
-  EigenStepper(std::shared_ptr<const MagneticFieldProvider> bField);
+  EigenStepper(std::shared_ptr<const bfield_t> bField);
 
   template <typename charge_t>
   State makeState(std::reference_wrapper<const GeometryContext> gctx,
@@ -377,7 +392,7 @@ class EigenStepper {
 
  private:
   /// Magnetic field inside of the detector
-  std::shared_ptr<const MagneticFieldProvider> m_bField;
+  std::shared_ptr<const bfield_t> m_bField;
 
   /// Overstep limit: could/should be dynamic
   double m_overstepLimit = 100_um;
@@ -9,28 +9,30 @@
 #include "Acts/EventData/detail/TransformationBoundToFree.hpp"
 #include "Acts/Propagator/detail/CovarianceEngine.hpp"
 
-template <typename E, typename A>
-Acts::EigenStepper<E, A>::EigenStepper(
-    std::shared_ptr<const MagneticFieldProvider> bField)
+template <typename E, typename A, typename B, bool C>
+Acts::EigenStepper<E, A, B, C>::EigenStepper(std::shared_ptr<const B> bField)
     : m_bField(std::move(bField)) {}
 
-template <typename E, typename A>
+template <typename E, typename A, typename B, bool C>
 template <typename charge_t>
-auto Acts::EigenStepper<E, A>::makeState(
+auto Acts::EigenStepper<E, A, B, C>::makeState(
     std::reference_wrapper<const GeometryContext> gctx,
     std::reference_wrapper<const MagneticFieldContext> mctx,
     const SingleBoundTrackParameters<charge_t>& par, NavigationDirection ndir,
     double ssize, double stolerance) const -> State {
-  return State{gctx, m_bField->makeCache(mctx), par, ndir, ssize, stolerance};
+  if constexpr (std::is_same_v<B, MagneticFieldProvider>) {
+    return State{gctx, m_bField->makeCache(mctx), par, ndir, ssize,
+                 stolerance};
+  } else {
+    return State{gctx, BFieldCache(mctx), par, ndir, ssize, stolerance};
+  }
 }
 
-template <typename E, typename A>
-void Acts::EigenStepper<E, A>::resetState(State& state,
-                                          const BoundVector& boundParams,
-                                          const BoundSymMatrix& cov,
-                                          const Surface& surface,
-                                          const NavigationDirection navDir,
-                                          const double stepSize) const {
+template <typename E, typename A, typename B, bool C>
+void Acts::EigenStepper<E, A, B, C>::resetState(
+    State& state, const BoundVector& boundParams, const BoundSymMatrix& cov,
+    const Surface& surface, const NavigationDirection navDir,
+    const double stepSize) const {
   // Update the stepping state
   update(state,
          detail::transformBoundToFreeParameters(surface, state.geoContext,
@@ -41,69 +43,87 @@ void Acts::EigenStepper<E, A>::resetState(State& state,
   state.pathAccumulated = 0.;
 
   // Reinitialize the stepping jacobian
-  state.jacToGlobal =
-      surface.jacobianLocalToGlobal(state.geoContext, boundParams);
-  state.jacobian = BoundMatrix::Identity();
-  state.jacTransport = FreeMatrix::Identity();
-  state.derivative = FreeVector::Zero();
+  if constexpr (C) {
+    state.jacToGlobal =
+        surface.jacobianLocalToGlobal(state.geoContext, boundParams);
+    state.jacobian = BoundMatrix::Identity();
+    state.jacTransport = FreeMatrix::Identity();
+    state.derivative = FreeVector::Zero();
+  }
 }
 
-template <typename E, typename A>
-auto Acts::EigenStepper<E, A>::boundState(State& state, const Surface& surface,
-                                          bool transportCov) const
+template <typename E, typename A, typename B, bool C>
+auto Acts::EigenStepper<E, A, B, C>::boundState(State& state,
+                                                const Surface& surface,
+                                                bool transportCov) const
     -> Result<BoundState> {
-  return detail::boundState(
-      state.geoContext, state.cov, state.jacobian, state.jacTransport,
-      state.derivative, state.jacToGlobal, state.pars,
-      state.covTransport && transportCov, state.pathAccumulated, surface);
+  if constexpr (C) {
+    return detail::boundState(
+        state.geoContext, state.cov, state.jacobian, state.jacTransport,
+        state.derivative, state.jacToGlobal, state.pars,
+        state.covTransport && transportCov, state.pathAccumulated, surface);
+  } else {
+    return detail::boundState(state.geoContext, state.pars,
+                              state.pathAccumulated, surface);
+  }
 }
 
-template <typename E, typename A>
-auto Acts::EigenStepper<E, A>::curvilinearState(State& state,
-                                                bool transportCov) const
+template <typename E, typename A, typename B, bool C>
+auto Acts::EigenStepper<E, A, B, C>::curvilinearState(State& state,
+                                                      bool transportCov) const
     -> CurvilinearState {
-  return detail::curvilinearState(
-      state.cov, state.jacobian, state.jacTransport, state.derivative,
-      state.jacToGlobal, state.pars, state.covTransport && transportCov,
-      state.pathAccumulated);
+  if constexpr (C) {
+    return detail::curvilinearState(
+        state.cov, state.jacobian, state.jacTransport, state.derivative,
+        state.jacToGlobal, state.pars, state.covTransport && transportCov,
+        state.pathAccumulated);
+  } else {
+    return detail::curvilinearState(state.pars, state.pathAccumulated);
+  }
 }
 
-template <typename E, typename A>
-void Acts::EigenStepper<E, A>::update(State& state,
-                                      const FreeVector& parameters,
-                                      const Covariance& covariance) const {
+template <typename E, typename A, typename B, bool C>
+void Acts::EigenStepper<E, A, B, C>::update(
+    State& state, const FreeVector& parameters,
+    const Covariance& covariance) const {
   state.pars = parameters;
   state.cov = covariance;
 }
 
-template <typename E, typename A>
-void Acts::EigenStepper<E, A>::update(State& state, const Vector3& uposition,
-                                      const Vector3& udirection, double up,
-                                      double time) const {
+template <typename E, typename A, typename B, bool C>
+void Acts::EigenStepper<E, A, B, C>::update(State& state,
+                                            const Vector3& uposition,
+                                            const Vector3& udirection,
+                                            double up, double time) const {
   state.pars.template segment<3>(eFreePos0) = uposition;
   state.pars.template segment<3>(eFreeDir0) = udirection;
   state.pars[eFreeTime] = time;
   state.pars[eFreeQOverP] = (state.q != 0. ? state.q / up : 1. / up);
 }
 
-template <typename E, typename A>
-void Acts::EigenStepper<E, A>::covarianceTransport(State& state) const {
-  detail::covarianceTransport(state.cov, state.jacobian, state.jacTransport,
-                              state.derivative, state.jacToGlobal,
-                              direction(state));
+template <typename E, typename A, typename B, bool C>
+void Acts::EigenStepper<E, A, B, C>::covarianceTransport(State& state) const {
+  if constexpr (C) {
+    detail::covarianceTransport(state.cov, state.jacobian, state.jacTransport,
+                                state.derivative, state.jacToGlobal,
+                                direction(state));
+  }
 }
 
-template <typename E, typename A>
-void Acts::EigenStepper<E, A>::covarianceTransport(
+template <typename E, typename A, typename B, bool C>
+void Acts::EigenStepper<E, A, B, C>::covarianceTransport(
     State& state, const Surface& surface) const {
-  detail::covarianceTransport(state.geoContext.get(), state.cov, state.jacobian,
-                              state.jacTransport, state.derivative,
-                              state.jacToGlobal, state.pars, surface);
+  if constexpr (C) {
+    detail::covarianceTransport(state.geoContext.get(), state.cov,
+                                state.jacobian, state.jacTransport,
+                                state.derivative, state.jacToGlobal,
+                                state.pars, surface);
+  }
 }
 
-template <typename E, typename A>
+template <typename E, typename A, typename B, bool C>
 template <typename propagator_state_t>
-Acts::Result<double> Acts::EigenStepper<E, A>::step(
+Acts::Result<double> Acts::EigenStepper<E, A, B, C>::step(
     propagator_state_t& state) const {
   using namespace UnitLiterals;
 
@@ -161,11 +181,20 @@ Acts::Result<double> Acts::EigenStepper<E, A>::step(
     return (error_estimate <= state.options.tolerance);
   };
 
+  if constexpr (s_navigationProfile) {
+    if (state.stepping.stepSize.currentType() != ConstrainedStep::accuracy) {
+      ++state.stepping.counters.stepSizeClamps;
+    }
+  }
+
   double stepSizeScaling = 1.;
   size_t nStepTrials = 0;
   // Select and adjust the appropriate Runge-Kutta step size as given
   // ATL-SOFT-PUB-2009-001
   while (!tryRungeKuttaStep(state.stepping.stepSize)) {
+    if constexpr (s_navigationProfile) {
+      ++state.stepping.counters.stepTrialsRejected;
+    }
     stepSizeScaling =
         std::min(std::max(0.25, std::pow((state.options.tolerance /
                                           std::abs(2. * error_estimate)),
@@ -193,22 +222,29 @@ Acts::Result<double> Acts::EigenStepper<E, A>::step(
 
   // use the adjusted step size
   const double h = state.stepping.stepSize;
+  if constexpr (s_navigationProfile) {
+    ++state.stepping.counters.steps;
+  }
 
   // When doing error propagation, update the associated Jacobian matrix
-  if (state.stepping.covTransport) {
-    // The step transport matrix in global coordinates
-    FreeMatrix D;
-    if (!state.stepping.extension.finalize(state, *this, h, D)) {
-      return EigenStepperError::StepInvalid;
-    }
+  // (without covariance transport support this is removed at compile time)
+  bool finalized = false;
+  if constexpr (C) {
+    if (state.stepping.covTransport) {
+      // The step transport matrix in global coordinates
+      FreeMatrix D;
+      if (!state.stepping.extension.finalize(state, *this, h, D)) {
+        return EigenStepperError::StepInvalid;
+      }
 
-    // for moment, only update the transport part
-    state.stepping.jacTransport = D * state.stepping.jacTransport;
-  } else {
-    if (!state.stepping.extension.finalize(state, *this, h)) {
-      return EigenStepperError::StepInvalid;
+      // for moment, only update the transport part
+      state.stepping.jacTransport = D * state.stepping.jacTransport;
+      finalized = true;
     }
   }
+  if (!finalized && !state.stepping.extension.finalize(state, *this, h)) {
+    return EigenStepperError::StepInvalid;
+  }
 
   // Update the track parameters according to the equations of motion
   state.stepping.pars.template segment<3>(eFreePos0) +=
@@ -217,10 +253,12 @@ Acts::Result<double> Acts::EigenStepper<E, A>::step(
       h / 6. * (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4);
   (state.stepping.pars.template segment<3>(eFreeDir0)).normalize();
 
-  if (state.stepping.covTransport) {
-    state.stepping.derivative.template head<3>() =
-        state.stepping.pars.template segment<3>(eFreeDir0);
-    state.stepping.derivative.template segment<3>(4) = sd.k4;
+  if constexpr (C) {
+    if (state.stepping.covTransport) {
+      state.stepping.derivative.template head<3>() =
+          state.stepping.pars.template segment<3>(eFreeDir0);
+      state.stepping.derivative.template segment<3>(4) = sd.k4;
+    }
   }
   state.stepping.pathAccumulated += h;
   return h;
@@ -0,0 +1,230 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/DefaultExtension.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/StepperExtensionList.hpp"
+#include "Acts/Propagator/detail/Auctioneer.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Acts {
+
+namespace detail {
+template <typename bfield_t>
+using homogeneous_distance_t =
+    decltype(std::declval<const bfield_t&>().homogeneousDistance(
+        std::declval<const Vector3&>(),
+        std::declval<typename bfield_t::Cache&>()));
+}  // namespace detail
+
+/// @brief Stepper following the analytic helix in homogeneous fields
+///
+/// In a homogeneous magnetic field the equations of motion
+///
+/// dr/ds = T
+/// dT/ds = q/p * (T x B)
+///
+/// are solved by a helix around the field direction. The stepper advances
+/// the parameters and the transport Jacobian along this helix, a single
+/// field evaluation is needed per step and the step size is not limited by
+/// the integration accuracy.
+///
+/// The region in which the field is homogeneous is taken from
+/// MagneticFieldProvider::homogeneousDistance. A helix step is limited to
+/// this distance, if it is shorter than the minimum helix step the step is
+/// handed over to the numerical integration of the EigenStepper. Both share
+/// the stepping state, the stepper can thus be used with any field, e.g. a
+/// field which is constant in the barrel and interpolated outside.
+///
+/// With a concrete field type, the homogeneous region is only used if the
+/// field provides a homogeneousDistance overload for its own cache type, as
+/// e.g. ConstantBField does. Otherwise all steps are numerical.
+///
+template <typename bfield_t = MagneticFieldProvider>
+class HelixStepper {
+ public:
+  /// The numerical stepper used outside of homogeneous regions
+  using NumericalStepper = EigenStepper<StepperExtensionList<DefaultExtension>,
+                                        detail::VoidAuctioneer, bfield_t>;
+
+  /// Jacobian, Covariance and State defintions
+  using Jacobian = typename NumericalStepper::Jacobian;
+  using Covariance = typename NumericalStepper::Covariance;
+  using BoundState = typename NumericalStepper::BoundState;
+  using CurvilinearState = typename NumericalStepper::CurvilinearState;
+  using State = typename NumericalStepper::State;
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  ///
+  /// @param bField The magnetic field
+  /// @param minHelixStep The minimum helix step before handing over to the
+  ///                     numerical integration at the end of a homogeneous
+  ///                     region
+  HelixStepper(std::shared_ptr<const bfield_t> bField,
+               double minHelixStep = 1_mm)
+      : m_numericalStepper(bField),
+        m_bField(std::move(bField)),
+        m_minHelixStep(minHelixStep) {}
+
+  /// @copydoc EigenStepper::makeState
+  template <typename charge_t>
+  State makeState(std::reference_wrapper<const GeometryContext> gctx,
+                  std::reference_wrapper<const MagneticFieldContext> mctx,
+                  const SingleBoundTrackParameters<charge_t>& par,
+                  NavigationDirection ndir = forward,
+                  double ssize = std::numeric_limits<double>::max(),
+                  double stolerance = s_onSurfaceTolerance) const {
+    return m_numericalStepper.makeState(gctx, mctx, par, ndir, ssize,
+                                        stolerance);
+  }
+
+  /// @copydoc EigenStepper::resetState
+  void resetState(
+      State& state, const BoundVector& boundParams, const BoundSymMatrix& cov,
+      const Surface& surface, const NavigationDirection navDir = forward,
+      const double stepSize = std::numeric_limits<double>::max()) const {
+    m_numericalStepper.resetState(state, boundParams, cov, surface, navDir,
+                                  stepSize);
+  }
+
+  /// @copydoc EigenStepper::getField
+  Vector3 getField(State& state, const Vector3& pos) const {
+    return m_numericalStepper.getField(state, pos);
+  }
+
+  /// @copydoc EigenStepper::position
+  Vector3 position(const State& state) const {
+    return m_numericalStepper.position(state);
+  }
+
+  /// @copydoc EigenStepper::direction
+  Vector3 direction(const State& state) const {
+    return m_numericalStepper.direction(state);
+  }
+
+  /// @copydoc EigenStepper::momentum
+  double momentum(const State& state) const {
+    return m_numericalStepper.momentum(state);
+  }
+
+  /// @copydoc EigenStepper::charge
+  double charge(const State& state) const {
+    return m_numericalStepper.charge(state);
+  }
+
+  /// @copydoc EigenStepper::time
+  double time(const State& state) const {
+    return m_numericalStepper.time(state);
+  }
+
+  /// @copydoc EigenStepper::updateSurfaceStatus
+  Intersection3D::Status updateSurfaceStatus(
+      State& state, const Surface& surface, const BoundaryCheck& bcheck) const {
+    return m_numericalStepper.updateSurfaceStatus(state, surface, bcheck);
+  }
+
+  /// @copydoc EigenStepper::updateStepSize
+  template <typename object_intersection_t>
+  void updateStepSize(State& state, const object_intersection_t& oIntersection,
+                      bool release = true) const {
+    m_numericalStepper.updateStepSize(state, oIntersection, release);
+  }
+
+  /// @copydoc EigenStepper::setStepSize
+  void setStepSize(State& state, double stepSize,
+                   ConstrainedStep::Type stype = ConstrainedStep::actor) const {
+    m_numericalStepper.setStepSize(state, stepSize, stype);
+  }
+
+  /// @copydoc EigenStepper::releaseStepSize
+  void releaseStepSize(State& state) const {
+    m_numericalStepper.releaseStepSize(state);
+  }
+
+  /// @copydoc EigenStepper::outputStepSize
+  std::string outputStepSize(const State& state) const {
+    return m_numericalStepper.outputStepSize(state);
+  }
+
+  /// @copydoc EigenStepper::overstepLimit
+  double overstepLimit(const State& state) const {
+    return m_numericalStepper.overstepLimit(state);
+  }
+
+  /// @copydoc EigenStepper::boundState
+  Result<BoundState> boundState(State& state, const Surface& surface,
+                                bool transportCov = true) const {
+    return m_numericalStepper.boundState(state, surface, transportCov);
+  }
+
+  /// @copydoc EigenStepper::curvilinearState
+  CurvilinearState curvilinearState(State& state,
+                                    bool transportCov = true) const {
+    return m_numericalStepper.curvilinearState(state, transportCov);
+  }
+
+  /// @copydoc EigenStepper::update(State&,const FreeVector&,const Covariance&)
+  void update(State& state, const FreeVector& parameters,
+              const Covariance& covariance) const {
+    m_numericalStepper.update(state, parameters, covariance);
+  }
+
+  /// @copydoc EigenStepper::update(State&,const
+  /// Vector3&,const Vector3&,double,double)
+  void update(State& state, const Vector3& uposition, const Vector3& udirection,
+              double up, double time) const {
+    m_numericalStepper.update(state, uposition, udirection, up, time);
+  }
+
+  /// @copydoc EigenStepper::covarianceTransport(State&)
+  void covarianceTransport(State& state) const {
+    m_numericalStepper.covarianceTransport(state);
+  }
+
+  /// @copydoc EigenStepper::covarianceTransport(State&,const Surface&)
+  void covarianceTransport(State& state, const Surface& surface) const {
+    m_numericalStepper.covarianceTransport(state, surface);
+  }
+
+  /// Perform a helix step, or a Runge-Kutta step outside of homogeneous
+  /// field regions
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///
+  ///                      the state contains the desired step size.
+  ///                      It can be negative during backwards track
+  ///                      propagation.
+  template <typename propagator_state_t>
+  Result<double> step(propagator_state_t& state) const;
+
+ private:
+  /// Numerical integration outside of homogeneous regions
+  NumericalStepper m_numericalStepper;
+
+  /// Magnetic field inside of the detector
+  std::shared_ptr<const bfield_t> m_bField;
+
+  /// Minimum helix step at the end of a homogeneous region
+  double m_minHelixStep;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/HelixStepper.ipp"
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cmath>
+
+template <typename B>
+template <typename propagator_state_t>
+Acts::Result<double> Acts::HelixStepper<B>::step(
+    propagator_state_t& state) const {
+  auto& stepping = state.stepping;
+  const Vector3 pos = position(stepping);
+
+  // The helix step is limited to the homogeneous region, close to its end
+  // the track is handed over to the numerical integration
+  double distance = 0.;
+  if constexpr (Concepts::exists<detail::homogeneous_distance_t, B>) {
+    distance = m_bField->homogeneousDistance(pos, stepping.fieldCache);
+  }
+  double h = stepping.stepSize;
+  if (std::abs(h) > distance) {
+    if (distance < m_minHelixStep) {
+      return m_numericalStepper.step(state);
+    }
+    h = std::copysign(distance, h);
+  }
+
+  const Vector3 dir = direction(stepping);
+  const double p = momentum(stepping);
+  const double qop = charge(stepping) / p;
+  const Vector3 field = getField(stepping, pos);
+
+  // Decompose the direction w.r.t. the field direction, the direction
+  // rotates around it with the angle psi = -q/p * |B| * s
+  const double bAbs = field.norm();
+  const Vector3 bHat = bAbs > 0. ? Vector3(field / bAbs) : Vector3::UnitZ();
+  const Vector3 dirPar = bHat.dot(dir) * bHat;
+  const Vector3 dirPerp = dir - dirPar;
+  const Vector3 bCrossDir = bHat.cross(dir);
+  const double psi = -qop * bAbs * h;
+  const double cosPsi = std::cos(psi);
+  const double sinPsi = std::sin(psi);
+
+  // Transverse displacements h * sin(psi) / psi and h * (1 - cos(psi)) / psi
+  // and their derivatives w.r.t. the rotation per path length, expanded for
+  // small angles to avoid cancellations
+  double f1 = 0., f2 = 0., g1 = 0., g2 = 0.;
+  if (std::abs(psi) < 1e-3) {
+    const double psi2 = psi * psi;
+    f1 = h * (1. - psi2 / 6.);
+    f2 = h * psi * (0.5 - psi2 / 24.);
+    g1 = h * h * psi * (-1. / 3. + psi2 / 30.);
+    g2 = h * h * (0.5 - psi2 / 8.);
+  } else {
+    f1 = h * sinPsi / psi;
+    f2 = h * (1. - cosPsi) / psi;
+    g1 = h * h * (psi * cosPsi - sinPsi) / (psi * psi);
+    g2 = h * h * (psi * sinPsi - (1. - cosPsi)) / (psi * psi);
+  }
+
+  // The time is propagated with dt/ds = sqrt(m^2/p^2 + c^{-2})
+  const double dtds = std::hypot(1., state.options.mass / p);
+
+  // When doing error propagation, update the associated Jacobian matrix
+  if (stepping.covTransport) {
+    const ActsMatrix<3, 3> par = bHat * bHat.transpose();
+    const ActsMatrix<3, 3> perp = ActsMatrix<3, 3>::Identity() - par;
+    ActsMatrix<3, 3> cross;
+    cross << 0., -bHat.z(), bHat.y(), bHat.z(), 0., -bHat.x(), -bHat.y(),
+        bHat.x(), 0.;
+
+    // The step transport matrix in global coordinates
+    FreeMatrix D = FreeMatrix::Identity();
+    D.template block<3, 3>(0, 4) = h * par + f1 * perp + f2 * cross;
+    D.template block<3, 1>(0, 7) = -bAbs * (g1 * dirPerp + g2 * bCrossDir);
+    D.template block<3, 3>(4, 4) = par + cosPsi * perp + sinPsi * cross;
+    D.template block<3, 1>(4, 7) =
+        -bAbs * h * (cosPsi * bCrossDir - sinPsi * dirPerp);
+    D(3, 7) = h * state.options.mass * state.options.mass *
+              charge(stepping) / (p * dtds);
+
+    // for moment, only update the transport part
+    stepping.jacTransport = D * stepping.jacTransport;
+  }
+
+  // Update the track parameters along the helix
+  stepping.pars.template segment<3>(eFreePos0) =
+      pos + h * dirPar + f1 * dirPerp + f2 * bCrossDir;
+  stepping.pars.template segment<3>(eFreeDir0) =
+      dirPar + cosPsi * dirPerp + sinPsi * bCrossDir;
+  stepping.pars[eFreeTime] += h * dtds;
+
+  if (stepping.covTransport) {
+    const Vector3 newDir = direction(stepping);
+    stepping.derivative.template head<3>() = newDir;
+    stepping.derivative(3) = dtds;
+    stepping.derivative.template segment<3>(4) = qop * newDir.cross(field);
+  }
+  stepping.pathAccumulated += h;
+  return h;
+}
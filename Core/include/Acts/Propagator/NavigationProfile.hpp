@@ -0,0 +1,158 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace Acts {
+
+/// Whether the navigation profile counters are compiled in, steered by the
+/// ACTS_ENABLE_NAVIGATION_PROFILE build option
+#ifdef ACTS_ENABLE_NAVIGATION_PROFILE
+constexpr bool s_navigationProfile = true;
+#else
+constexpr bool s_navigationProfile = false;
+#endif
+
+/// @brief Counters of the navigation and stepping hot paths
+struct NavigationCounters {
+  /// Accepted steps of the stepper
+  size_t steps = 0;
+  /// Step trials rejected by the adaptive step size control
+  size_t stepTrialsRejected = 0;
+  /// Steps limited by a navigation, abort or user constraint rather than
+  /// by the accuracy
+  size_t stepSizeClamps = 0;
+  /// Surface intersections tried for the surface status
+  size_t intersectionsTried = 0;
+  /// Tried intersections which were neither reachable nor on surface
+  size_t intersectionsRejected = 0;
+  /// Surface status updates replayed from the previous update instead of
+  /// being intersected again
+  size_t intersectionsReused = 0;
+  /// (Re-)resolutions of the boundary candidates of a volume
+  size_t boundaryResolutions = 0;
+
+  NavigationCounters& operator+=(const NavigationCounters& other);
+  NavigationCounters& operator-=(const NavigationCounters& other);
+};
+
+namespace detail {
+
+/// Empty stand-in for the counters if the profile is compiled out
+struct NoNavigationCounters {};
+
+/// Whether a navigator or stepper state carries navigation counters
+template <typename state_t, typename = void>
+struct hasNavigationCounters : std::false_type {};
+
+template <typename state_t>
+struct hasNavigationCounters<
+    state_t, std::enable_if_t<std::is_same_v<
+                 decltype(std::declval<state_t&>().counters),
+                 NavigationCounters>>> : std::true_type {};
+
+}  // namespace detail
+
+/// The counters as they are kept in the navigator and stepper states, they
+/// take no space if the profile is compiled out
+using NavigationCountersStorage =
+    std::conditional_t<s_navigationProfile, NavigationCounters,
+                       detail::NoNavigationCounters>;
+
+/// @brief Navigation counters accumulated per tracking volume
+struct NavigationProfile {
+  /// The counters per volume identifier
+  std::map<GeometryIdentifier, NavigationCounters> volumes;
+
+  /// Add the counters of another profile, e.g. of another track
+  ///
+  /// @param other The profile to be added
+  void merge(const NavigationProfile& other);
+
+  /// The sum of the counters of all volumes
+  NavigationCounters total() const;
+
+  /// Write the profile as a table with comma separated values, with one
+  /// line per volume
+  ///
+  /// @param os The output stream
+  void writeCsv(std::ostream& os) const;
+};
+
+/// @brief Actor which builds the navigation profile of a propagation
+///
+/// The counters of the navigator and the stepper state, which are only
+/// filled if the profile is compiled in, are attributed to the volume in
+/// which the step started. Without the ACTS_ENABLE_NAVIGATION_PROFILE build
+/// option the profile stays empty.
+struct NavigationProfiler {
+  struct this_result {
+    /// The profile of the propagation
+    NavigationProfile profile;
+    /// The totals which are already attributed
+    NavigationCounters attributed;
+    /// The volume of the last call, if there was one
+    std::optional<GeometryIdentifier> volume;
+  };
+
+  using result_type = this_result;
+
+  /// NavigationProfiler action for the ActionList of the Propagator
+  ///
+  /// @tparam propagator_state_t is the type of Propagator state
+  /// @tparam stepper_t is the type of the Stepper
+  ///
+  /// @param [in] state is the propagator state object
+  /// @param [in,out] result is the mutable result object
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& state, const stepper_t& /*stepper*/,
+                  result_type& result) const {
+    if constexpr (s_navigationProfile) {
+      // The current totals of the propagation
+      NavigationCounters totals;
+      if constexpr (detail::hasNavigationCounters<
+                        decltype(state.navigation)>::value) {
+        totals += state.navigation.counters;
+      }
+      if constexpr (detail::hasNavigationCounters<
+                        decltype(state.stepping)>::value) {
+        totals += state.stepping.counters;
+      }
+      // The volume in which the last step started, outside of the world
+      // the counters stay with the last volume
+      if (not result.volume and state.navigation.currentVolume) {
+        result.volume = state.navigation.currentVolume->geometryId();
+      }
+      NavigationCounters delta = totals;
+      delta -= result.attributed;
+      result.profile.volumes[result.volume.value_or(GeometryIdentifier())] +=
+          delta;
+      result.attributed = totals;
+      if (state.navigation.currentVolume) {
+        result.volume = state.navigation.currentVolume->geometryId();
+      }
+    }
+  }
+
+  /// Pure observer interface
+  /// - this does not apply to the profiler
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& /*unused*/,
+                  const stepper_t& /*unused*/) const {}
+};
+
+}  // namespace Acts
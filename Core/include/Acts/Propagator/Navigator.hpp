@@ -15,12 +15,16 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/NavigationProfile.hpp"
+#include "Acts/Propagator/NavigatorPolicies.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
+#include <map>
 #include <sstream>
 #include <string>
 
@@ -114,19 +118,26 @@ struct NavigationOptions {
 /// the state is not on surface, it also  re-computes the step size, to make
 /// sure we end up at the desired surface.
 ///
-class Navigator {
+/// The navigator policy defines how the candidates are stored and ordered,
+/// see the VectorNavigatorPolicy and the SmallBufferNavigatorPolicy.
+///
+/// @tparam navigator_policy_t The candidate storage and ordering policy
+template <typename navigator_policy_t = VectorNavigatorPolicy>
+class NavigatorT {
  public:
+  using Policy = navigator_policy_t;
+
   using Surfaces = std::vector<const Surface*>;
   using SurfaceIter = std::vector<const Surface*>::iterator;
 
-  using NavigationSurfaces = std::vector<SurfaceIntersection>;
-  using NavigationSurfaceIter = NavigationSurfaces::iterator;
+  using NavigationSurfaces = typename Policy::NavigationSurfaces;
+  using NavigationSurfaceIter = typename NavigationSurfaces::iterator;
 
-  using NavigationLayers = std::vector<LayerIntersection>;
-  using NavigationLayerIter = NavigationLayers::iterator;
+  using NavigationLayers = typename Policy::NavigationLayers;
+  using NavigationLayerIter = typename NavigationLayers::iterator;
 
-  using NavigationBoundaries = std::vector<BoundaryIntersection>;
-  using NavigationBoundaryIter = NavigationBoundaries::iterator;
+  using NavigationBoundaries = typename Policy::NavigationBoundaries;
+  using NavigationBoundaryIter = typename NavigationBoundaries::iterator;
 
   using ExternalSurfaces = std::multimap<uint64_t, GeometryIdentifier>;
 
@@ -141,7 +152,7 @@ class Navigator {
   /// Constructor with shared tracking geometry
   ///
   /// @param tGeometry The tracking geometry for the navigator
-  Navigator(std::shared_ptr<const TrackingGeometry> tGeometry = nullptr)
+  NavigatorT(std::shared_ptr<const TrackingGeometry> tGeometry = nullptr)
       : trackingGeometry(std::move(tGeometry)) {}
 
   /// Tracking Geometry for this Navigator
@@ -158,6 +169,36 @@ class Navigator {
   /// stop at every surface regardless what it is
   bool resolvePassive = false;
 
+  /// @brief Outcome of the last full surface status update
+  ///
+  /// The status() call and the target() call which follows it usually
+  /// update the same candidate from the same position. The outcome only
+  /// depends on the surface, the boundary check, the position, the direction
+  /// and the step size limits, so the second update can be taken from here.
+  /// Resolving the surfaces of a layer seeds it with the intersection of the
+  /// first surface candidate.
+  struct SurfaceStatusCache {
+    /// The updated surface, nullptr if nothing is cached
+    const Surface* surface = nullptr;
+    /// Whether the boundaries were checked
+    bool boundaryCheck = true;
+    /// The navigation direction of the update
+    NavigationDirection navDir = forward;
+    /// The position of the update
+    Vector3 position = Vector3::Zero();
+    /// The direction of the update
+    Vector3 direction = Vector3::Zero();
+    /// The path limit given by the aborters
+    double pathLimit = 0.;
+    /// The overstep limit of the stepper
+    double overstepLimit = 0.;
+    /// The resulting surface status
+    Intersection3D::Status status = Intersection3D::Status::missed;
+    /// The resulting actor step size, if the surface is reachable it is the
+    /// signed path length to the surface
+    double stepSize = 0.;
+  };
+
   /// Nested State struct
   ///
   /// It acts as an internal state which is
@@ -216,6 +257,13 @@ class Navigator {
     bool navigationBreak = false;
     // The navigation stage (@todo: integrate break, target)
     Stage navigationStage = Stage::undefined;
+
+    /// The last full surface status update, which is replayed if the same
+    /// surface is updated again with unchanged input
+    SurfaceStatusCache surfaceStatusCache;
+
+    /// Navigation profile counters, empty if not compiled in
+    NavigationCountersStorage counters;
   };
 
   /// @brief Navigator status call, will be called in two modes
@@ -270,11 +318,14 @@ class Navigator {
       if (state.navigation.currentSurface) {
         ACTS_VERBOSE(volInfo(state)
                      << "On surface: switch forward or release.");
-        if (++state.navigation.navSurfaceIter ==
+        nextCandidate(state, state.navigation.navSurfaces,
+                      state.navigation.navSurfaceIter);
+        if (state.navigation.navSurfaceIter ==
             state.navigation.navSurfaces.end()) {
           // this was the last surface, check if we have layers
           if (!state.navigation.navLayers.empty()) {
-            ++state.navigation.navLayerIter;
+            nextCandidate(state, state.navigation.navLayers,
+                          state.navigation.navLayerIter);
           } else {
             // no layers, go to boundary
             state.navigation.navigationStage = Stage::boundaryTarget;
@@ -527,8 +578,7 @@ class Navigator {
     // Check if we are at a surface
     // If we are on the surface pointed at by the iterator, we can make
     // it the current one to pass it to the other actors
-    auto surfaceStatus =
-        stepper.updateSurfaceStatus(state.stepping, *surface, true);
+    auto surfaceStatus = updateSurfaceStatus(state, stepper, *surface, true);
     if (surfaceStatus == Intersection3D::Status::onSurface) {
       ACTS_VERBOSE(volInfo(state)
                    << "Status Surface successfully hit, storing it.");
@@ -621,14 +671,15 @@ class Navigator {
         }
       }
       auto surfaceStatus =
-          stepper.updateSurfaceStatus(state.stepping, *surface, boundaryCheck);
+          updateSurfaceStatus(state, stepper, *surface, boundaryCheck);
       if (surfaceStatus == Intersection3D::Status::reachable) {
         ACTS_VERBOSE(volInfo(state)
                      << "Surface reachable, step size updated to "
                      << stepper.outputStepSize(state.stepping));
         return true;
       }
-      ++state.navigation.navSurfaceIter;
+      nextCandidate(state, state.navigation.navSurfaces,
+                    state.navigation.navSurfaceIter);
       continue;
     }
 
@@ -642,7 +693,8 @@ class Navigator {
         ACTS_VERBOSE(volInfo(state)
                      << "Last surface on layer reached, switching layer.");
         // now switch to the next layer
-        ++state.navigation.navLayerIter;
+        nextCandidate(state, state.navigation.navLayers,
+                      state.navigation.navLayerIter);
       } else {
         ACTS_VERBOSE(volInfo(state)
                      << "Last surface on layer reached, and no layer.");
@@ -739,7 +791,8 @@ class Navigator {
                state.navigation.navSurfaces.empty()) ||
               protoNavSurfaces.front().intersection.pathLength > 1_um) {
             // we are not, go on
-            state.navigation.navSurfaces = std::move(protoNavSurfaces);
+            state.navigation.navSurfaces.assign(protoNavSurfaces.begin(),
+                                                protoNavSurfaces.end());
 
             state.navigation.navSurfaceIter =
                 state.navigation.navSurfaces.begin();
@@ -773,13 +826,14 @@ class Navigator {
           return true;
         } else {
           // Try the next one
-          ++state.navigation.navLayerIter;
+          nextCandidate(state, state.navigation.navLayers,
+                        state.navigation.navLayerIter);
           continue;
         }
       }
       // Try to step towards it
       auto layerStatus =
-          stepper.updateSurfaceStatus(state.stepping, *layerSurface, true);
+          updateSurfaceStatus(state, stepper, *layerSurface, true);
       if (layerStatus == Intersection3D::Status::reachable) {
         ACTS_VERBOSE(volInfo(state) << "Layer reachable, step size updated to "
                                     << stepper.outputStepSize(state.stepping));
@@ -787,7 +841,8 @@ class Navigator {
       }
       ACTS_VERBOSE(volInfo(state)
                    << "Layer intersection not valid, skipping it.");
-      ++state.navigation.navLayerIter;
+      nextCandidate(state, state.navigation.navLayers,
+                    state.navigation.navLayerIter);
     }
 
     // Re-initialize target at last layer, only in case it is the target volume
@@ -882,11 +937,13 @@ class Navigator {
                    << stepper.direction(state.stepping).transpose());
 
       // Evaluate the boundary surfaces
-      state.navigation.navBoundaries =
-          state.navigation.currentVolume->compatibleBoundaries(
-              state.geoContext, stepper.position(state.stepping),
-              stepper.direction(state.stepping), navOpts,
-              LoggerWrapper{logger()});
+      if constexpr (s_navigationProfile) {
+        ++state.navigation.counters.boundaryResolutions;
+      }
+      Policy::compatibleBoundaries(
+          *state.navigation.currentVolume, state.geoContext,
+          stepper.position(state.stepping), stepper.direction(state.stepping),
+          navOpts, state.navigation.navBoundaries, LoggerWrapper{logger()});
       // The number of boundary candidates
       if (logger().doPrint(Logging::VERBOSE)) {
         std::ostringstream os;
@@ -898,7 +955,8 @@ class Navigator {
         logger.log(Logging::VERBOSE, os.str());
       }
       // Set the begin iterator
-      state.navigation.navBoundaryIter = state.navigation.navBoundaries.begin();
+      firstCandidate(state, state.navigation.navBoundaries,
+                     state.navigation.navBoundaryIter);
       if (not state.navigation.navBoundaries.empty()) {
         // Set to the first and return to the stepper
         stepper.updateStepSize(state.stepping,
@@ -922,7 +980,7 @@ class Navigator {
       auto boundarySurface = state.navigation.navBoundaryIter->representation;
       // Step towards the boundary surfrace
       auto boundaryStatus =
-          stepper.updateSurfaceStatus(state.stepping, *boundarySurface, true);
+          updateSurfaceStatus(state, stepper, *boundarySurface, true);
       if (boundaryStatus == Intersection3D::Status::reachable) {
         ACTS_VERBOSE(volInfo(state)
                      << "Boundary reachable, step size updated to "
@@ -940,7 +998,8 @@ class Navigator {
         }
       }
       // Increase the iterator to the next one
-      ++state.navigation.navBoundaryIter;
+      nextCandidate(state, state.navigation.navBoundaries,
+                    state.navigation.navBoundaryIter);
     }
     // We have to leave the volume somehow, so try again
     state.navigation.navBoundaries.clear();
@@ -1078,9 +1137,10 @@ class Navigator {
                                 : stepper.overstepLimit(state.stepping);
 
     // get the surfaces
-    state.navigation.navSurfaces = navLayer->compatibleSurfaces(
-        state.geoContext, stepper.position(state.stepping),
-        stepper.direction(state.stepping), navOpts);
+    Policy::compatibleSurfaces(*navLayer, state.geoContext,
+                               stepper.position(state.stepping),
+                               stepper.direction(state.stepping), navOpts,
+                               state.navigation.navSurfaces);
     // the number of layer candidates
     if (!state.navigation.navSurfaces.empty()) {
       if (logger.doPrint(Logging::VERBOSE)) {
@@ -1094,12 +1154,22 @@ class Navigator {
       }
 
       // set the iterator
-      state.navigation.navSurfaceIter = state.navigation.navSurfaces.begin();
+      firstCandidate(state, state.navigation.navSurfaces,
+                     state.navigation.navSurfaceIter);
       // The stepper updates the step size ( single / multi component)
       stepper.updateStepSize(state.stepping, *state.navigation.navSurfaceIter,
                              true);
       ACTS_VERBOSE(volInfo(state) << "Navigation stepSize updated to "
                                   << stepper.outputStepSize(state.stepping));
+      // The first candidate is targeted next from this position, its
+      // status can be taken from the intersection found here
+      const auto& candidate = *state.navigation.navSurfaceIter;
+      bool boundaryCheck =
+          std::find(navOpts.externalSurfaces.begin(),
+                    navOpts.externalSurfaces.end(),
+                    candidate.object->geometryId()) ==
+          navOpts.externalSurfaces.end();
+      seedSurfaceStatus(state, stepper, candidate, boundaryCheck);
       return true;
     }
     state.navigation.navSurfaceIter = state.navigation.navSurfaces.end();
@@ -1143,10 +1213,10 @@ class Navigator {
     navOpts.pathLimit = state.stepping.stepSize.value(ConstrainedStep::aborter);
     navOpts.overstepLimit = stepper.overstepLimit(state.stepping);
     // Request the compatible layers
-    state.navigation.navLayers =
-        state.navigation.currentVolume->compatibleLayers(
-            state.geoContext, stepper.position(state.stepping),
-            stepper.direction(state.stepping), navOpts);
+    Policy::compatibleLayers(*state.navigation.currentVolume, state.geoContext,
+                             stepper.position(state.stepping),
+                             stepper.direction(state.stepping), navOpts,
+                             state.navigation.navLayers);
 
     // Layer candidates have been found
     if (!state.navigation.navLayers.empty()) {
@@ -1161,7 +1231,8 @@ class Navigator {
         logger.log(Logging::VERBOSE, os.str());
       }
       // Set the iterator to the first
-      state.navigation.navLayerIter = state.navigation.navLayers.begin();
+      firstCandidate(state, state.navigation.navLayers,
+                     state.navigation.navLayerIter);
       // Setting the step size towards first
       if (state.navigation.startLayer &&
           state.navigation.navLayerIter->object !=
@@ -1223,8 +1294,8 @@ class Navigator {
       if (state.navigation.targetReached || !state.navigation.targetSurface) {
         return true;
       }
-      auto targetStatus = stepper.updateSurfaceStatus(
-          state.stepping, *state.navigation.targetSurface, true);
+      auto targetStatus = updateSurfaceStatus(
+          state, stepper, *state.navigation.targetSurface, true);
       // the only advance could have been to the target
       if (targetStatus == Intersection3D::Status::onSurface) {
         // set the target surface
@@ -1240,6 +1311,123 @@ class Navigator {
   }
 
  private:
+  /// Update the surface status through the stepper, or replay the last
+  /// update if it was done for the same surface with unchanged input
+  ///
+  /// @tparam propagator_state_t The state type of the propagagor
+  /// @tparam stepper_t The type of stepper used for the propagation
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper Stepper in use
+  /// @param [in] surface The surface to be updated
+  /// @param [in] boundaryCheck Whether the boundaries are checked
+  ///
+  /// @return The surface status
+  template <typename propagator_state_t, typename stepper_t>
+  Intersection3D::Status updateSurfaceStatus(propagator_state_t& state,
+                                             const stepper_t& stepper,
+                                             const Surface& surface,
+                                             bool boundaryCheck) const {
+    auto& cache = state.navigation.surfaceStatusCache;
+    const NavigationDirection navDir = state.stepping.navDir;
+    const Vector3 position = stepper.position(state.stepping);
+    const Vector3 direction = stepper.direction(state.stepping);
+    const double pathLimit =
+        state.stepping.stepSize.value(ConstrainedStep::aborter);
+    const double overstepLimit = stepper.overstepLimit(state.stepping);
+
+    // A path limit which shrank since the last update, e.g. by the path
+    // limit aborter, can only turn a reachable surface unreachable
+    if (cache.surface == &surface and cache.boundaryCheck == boundaryCheck and
+        cache.navDir == navDir and cache.position == position and
+        cache.direction == direction and
+        cache.overstepLimit == overstepLimit and
+        pathLimit * pathLimit <= cache.pathLimit * cache.pathLimit and
+        (cache.status != Intersection3D::Status::reachable or
+         cache.stepSize * cache.stepSize < pathLimit * pathLimit)) {
+      if (cache.status == Intersection3D::Status::onSurface) {
+        stepper.releaseStepSize(state.stepping);
+      } else if (cache.status == Intersection3D::Status::reachable) {
+        stepper.setStepSize(state.stepping, cache.stepSize);
+      }
+      if constexpr (s_navigationProfile) {
+        ++state.navigation.counters.intersectionsReused;
+      }
+      return cache.status;
+    }
+
+    auto surfaceStatus =
+        stepper.updateSurfaceStatus(state.stepping, surface, boundaryCheck);
+    countIntersection(state, surfaceStatus);
+    cache.surface = &surface;
+    cache.boundaryCheck = boundaryCheck;
+    cache.navDir = navDir;
+    cache.position = position;
+    cache.direction = direction;
+    cache.pathLimit = pathLimit;
+    cache.overstepLimit = overstepLimit;
+    cache.status = surfaceStatus;
+    cache.stepSize = state.stepping.stepSize.value(ConstrainedStep::actor);
+    return surfaceStatus;
+  }
+
+  /// Seed the cached surface status from a surface candidate
+  ///
+  /// The candidate was intersected from the current position with the given
+  /// boundary check, which is what the stepper repeats in the next status
+  /// update of the surface. The status is only seeded if the stepper would
+  /// accept this intersection with the current step size limits.
+  ///
+  /// @tparam propagator_state_t The state type of the propagagor
+  /// @tparam stepper_t The type of stepper used for the propagation
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper Stepper in use
+  /// @param [in] candidate The surface candidate with its intersection
+  /// @param [in] boundaryCheck Whether the boundaries were checked
+  template <typename propagator_state_t, typename stepper_t>
+  void seedSurfaceStatus(propagator_state_t& state, const stepper_t& stepper,
+                         const SurfaceIntersection& candidate,
+                         bool boundaryCheck) const {
+    const NavigationDirection navDir = state.stepping.navDir;
+    const double pathLimit =
+        state.stepping.stepSize.value(ConstrainedStep::aborter);
+    const double overstepLimit = stepper.overstepLimit(state.stepping);
+    // The candidate path length is signed with the navigation direction
+    const double pathLength = navDir * candidate.intersection.pathLength;
+    if (candidate.intersection.status != Intersection3D::Status::reachable or
+        pathLength <= overstepLimit or
+        pathLimit * pathLimit <= pathLength * pathLength) {
+      return;
+    }
+    auto& cache = state.navigation.surfaceStatusCache;
+    cache.surface = candidate.object;
+    cache.boundaryCheck = boundaryCheck;
+    cache.navDir = navDir;
+    cache.position = stepper.position(state.stepping);
+    cache.direction = stepper.direction(state.stepping);
+    cache.pathLimit = pathLimit;
+    cache.overstepLimit = overstepLimit;
+    cache.status = Intersection3D::Status::reachable;
+    cache.stepSize = navDir * pathLength;
+  }
+
+  /// Count a tried intersection for the navigation profile
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] status is the resulting surface status
+  template <typename propagator_state_t>
+  void countIntersection(propagator_state_t& state,
+                         Intersection3D::Status status) const {
+    if constexpr (s_navigationProfile) {
+      ++state.navigation.counters.intersectionsTried;
+      if (status != Intersection3D::Status::reachable and
+          status != Intersection3D::Status::onSurface) {
+        ++state.navigation.counters.intersectionsRejected;
+      }
+    }
+  }
+
   template <typename propagator_state_t>
   std::string volInfo(const propagator_state_t& state) const {
     return (state.navigation.currentVolume
@@ -1247,6 +1435,37 @@ class Navigator {
                 : "No Volume") +
            " | ";
   }
+
+  /// Point to the first candidate, which the policy selects
+  ///
+  /// @param [in] state is the propagation state object
+  /// @param [in,out] candidates The navigation candidates
+  /// @param [out] iter The iterator to the current candidate
+  template <typename propagator_state_t, typename candidates_t>
+  void firstCandidate(const propagator_state_t& state,
+                      candidates_t& candidates,
+                      typename candidates_t::iterator& iter) const {
+    iter = candidates.begin();
+    Policy::select(iter, candidates.end(), state.stepping.navDir);
+  }
+
+  /// Move to the next candidate, which the policy selects
+  ///
+  /// @param [in] state is the propagation state object
+  /// @param [in,out] candidates The navigation candidates
+  /// @param [in,out] iter The iterator to the current candidate
+  template <typename propagator_state_t, typename candidates_t>
+  void nextCandidate(const propagator_state_t& state,
+                     candidates_t& candidates,
+                     typename candidates_t::iterator& iter) const {
+    if (iter != candidates.end()) {
+      ++iter;
+      Policy::select(iter, candidates.end(), state.stepping.navDir);
+    }
+  }
 };
 
+/// The default Navigator, which keeps the candidates in std::vectors
+using Navigator = NavigatorT<>;
+
 }  // namespace Acts
@@ -0,0 +1,151 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Common.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+/// @brief Navigator policy which keeps the candidates in std::vectors
+///
+/// The candidates are requested from the geometry fully sorted, which is the
+/// original behaviour of the Navigator.
+struct VectorNavigatorPolicy {
+  using NavigationSurfaces = std::vector<SurfaceIntersection>;
+  using NavigationLayers = std::vector<LayerIntersection>;
+  using NavigationBoundaries = std::vector<BoundaryIntersection>;
+
+  /// Fill the sorted surface candidates of a layer
+  template <typename options_t>
+  static void compatibleSurfaces(const Layer& layer,
+                                 const GeometryContext& gctx,
+                                 const Vector3& position,
+                                 const Vector3& direction,
+                                 const options_t& options,
+                                 NavigationSurfaces& candidates) {
+    candidates = layer.compatibleSurfaces(gctx, position, direction, options);
+  }
+
+  /// Fill the sorted layer candidates of a volume
+  template <typename options_t>
+  static void compatibleLayers(const TrackingVolume& volume,
+                               const GeometryContext& gctx,
+                               const Vector3& position,
+                               const Vector3& direction,
+                               const options_t& options,
+                               NavigationLayers& candidates) {
+    candidates = volume.compatibleLayers(gctx, position, direction, options);
+  }
+
+  /// Fill the sorted boundary candidates of a volume
+  template <typename options_t>
+  static void compatibleBoundaries(const TrackingVolume& volume,
+                                   const GeometryContext& gctx,
+                                   const Vector3& position,
+                                   const Vector3& direction,
+                                   const options_t& options,
+                                   NavigationBoundaries& candidates,
+                                   LoggerWrapper logger) {
+    candidates = volume.compatibleBoundaries(gctx, position, direction,
+                                             options, logger);
+  }
+
+  /// Bring the closest of the remaining candidates to the front, nothing to
+  /// do since they are sorted already
+  template <typename iterator_t>
+  static void select(iterator_t /*begin*/, iterator_t /*end*/,
+                     NavigationDirection /*navDir*/) {}
+};
+
+/// @brief Navigator policy which avoids heap allocations and full sorting
+///
+/// The candidates are stored in containers with inline capacity, which fall
+/// back to heap memory only if the capacity is exceeded. They are requested
+/// unsorted from the geometry, and only the candidate which is targeted next
+/// is selected. Since the Navigator usually reaches only the first few
+/// candidates, this avoids most of the sorting work.
+///
+/// @tparam kSurfaces Inline capacity for the surface candidates
+/// @tparam kLayers Inline capacity for the layer candidates
+/// @tparam kBoundaries Inline capacity for the boundary candidates
+template <size_t kSurfaces = 16, size_t kLayers = 16, size_t kBoundaries = 8>
+struct SmallBufferNavigatorPolicy {
+  using NavigationSurfaces =
+      boost::container::small_vector<SurfaceIntersection, kSurfaces>;
+  using NavigationLayers =
+      boost::container::small_vector<LayerIntersection, kLayers>;
+  using NavigationBoundaries =
+      boost::container::small_vector<BoundaryIntersection, kBoundaries>;
+
+  /// Fill the unsorted surface candidates of a layer
+  template <typename options_t>
+  static void compatibleSurfaces(const Layer& layer,
+                                 const GeometryContext& gctx,
+                                 const Vector3& position,
+                                 const Vector3& direction,
+                                 const options_t& options,
+                                 NavigationSurfaces& candidates) {
+    layer.compatibleSurfaces(gctx, position, direction, options, candidates);
+  }
+
+  /// Fill the unsorted layer candidates of a volume
+  template <typename options_t>
+  static void compatibleLayers(const TrackingVolume& volume,
+                               const GeometryContext& gctx,
+                               const Vector3& position,
+                               const Vector3& direction,
+                               const options_t& options,
+                               NavigationLayers& candidates) {
+    volume.compatibleLayers(gctx, position, direction, options, candidates);
+  }
+
+  /// Fill the unsorted boundary candidates of a volume
+  template <typename options_t>
+  static void compatibleBoundaries(const TrackingVolume& volume,
+                                   const GeometryContext& gctx,
+                                   const Vector3& position,
+                                   const Vector3& direction,
+                                   const options_t& options,
+                                   NavigationBoundaries& candidates,
+                                   LoggerWrapper logger) {
+    volume.compatibleBoundaries(gctx, position, direction, options,
+                                candidates, logger);
+  }
+
+  /// Bring the closest of the remaining candidates to the front
+  ///
+  /// @param begin The next candidate to be targeted
+  /// @param end The end of the candidates
+  /// @param navDir The navigation direction, which defines the order
+  template <typename iterator_t>
+  static void select(iterator_t begin, iterator_t end,
+                     NavigationDirection navDir) {
+    if (begin == end) {
+      return;
+    }
+    auto closest = (navDir == forward)
+                       ? std::min_element(begin, end)
+                       : std::min_element(begin, end, std::greater<>());
+    std::iter_swap(begin, closest);
+  }
+};
+
+}  // namespace Acts
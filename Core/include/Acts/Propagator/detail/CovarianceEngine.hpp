@@ -59,6 +59,25 @@ Result<std::tuple<BoundTrackParameters, BoundMatrix, double>> boundState(
     const FreeVector& parameters, bool covTransport, double accumulatedPath,
     const Surface& surface);
 
+/// Create and return the bound state at the current position without
+/// covariance
+///
+/// @brief It does not check if the transported state is at the surface, this
+/// needs to be guaranteed by the propagator
+///
+/// @param [in] geoContext The geometry context
+/// @param [in] parameters Free, nominal parametrisation
+/// @param [in] accumulatedPath Propagated distance
+/// @param [in] surface Target surface on which the state is represented
+///
+/// @return A bound state:
+///   - the parameters at the surface
+///   - an identity jacobian
+///   - and the path length (from start - for ordering)
+Result<std::tuple<BoundTrackParameters, BoundMatrix, double>> boundState(
+    const GeometryContext& geoContext, const FreeVector& parameters,
+    double accumulatedPath, const Surface& surface);
+
 /// Create and return a curvilinear state at the current position
 ///
 /// @brief This creates a curvilinear state.
@@ -85,6 +104,19 @@ std::tuple<CurvilinearTrackParameters, BoundMatrix, double> curvilinearState(
     BoundToFreeMatrix& jacToGlobal, const FreeVector& parameters,
     bool covTransport, double accumulatedPath);
 
+/// Create and return a curvilinear state at the current position without
+/// covariance
+///
+/// @param [in] parameters Free, nominal parametrisation
+/// @param [in] accumulatedPath Propagated distance
+///
+/// @return A curvilinear state:
+///   - the curvilinear parameters at given position
+///   - an identity jacobian
+///   - and the path length (from start - for ordering)
+std::tuple<CurvilinearTrackParameters, BoundMatrix, double> curvilinearState(
+    const FreeVector& parameters, double accumulatedPath);
+
 /// @brief Method for on-demand transport of the covariance to a new frame at
 /// current position in parameter space
 ///
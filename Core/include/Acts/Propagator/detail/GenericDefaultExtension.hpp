@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Propagator/detail/TransportJacobians.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <array>
@@ -121,8 +122,10 @@ struct GenericDefaultExtension {
     auto derivative =
         hypot(1, state.options.mass / stepper.momentum(state.stepping));
     state.stepping.pars[eFreeTime] += h * derivative;
-    if (state.stepping.covTransport) {
-      state.stepping.derivative(3) = derivative;
+    if constexpr (hasTransportJacobians<decltype(state.stepping)>) {
+      if (state.stepping.covTransport) {
+        state.stepping.derivative(3) = derivative;
+      }
     }
   }
 
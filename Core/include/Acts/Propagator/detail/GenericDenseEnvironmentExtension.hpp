@@ -15,6 +15,7 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Material/Interactions.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/TransportJacobians.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <array>
@@ -167,19 +168,21 @@ struct GenericDenseEnvironmentExtension {
       return false;
     }
 
-    // Add derivative dlambda/ds = Lambda''
-    using std::sqrt;
-    state.stepping.derivative(7) =
-        -sqrt(state.options.mass * state.options.mass +
-              newMomentum * newMomentum) *
-        g / (newMomentum * newMomentum * newMomentum);
+    if constexpr (hasTransportJacobians<decltype(state.stepping)>) {
+      // Add derivative dlambda/ds = Lambda''
+      using std::sqrt;
+      state.stepping.derivative(7) =
+          -sqrt(state.options.mass * state.options.mass +
+                newMomentum * newMomentum) *
+          g / (newMomentum * newMomentum * newMomentum);
+      // Add derivative dt/ds = 1/(beta * c) = sqrt(m^2 * p^{-2} + c^{-2})
+      using std::hypot;
+      state.stepping.derivative(3) = hypot(1, state.options.mass / newMomentum);
+    }
 
     // Update momentum
     state.stepping.pars[eFreeQOverP] =
         stepper.charge(state.stepping) / newMomentum;
-    // Add derivative dt/ds = 1/(beta * c) = sqrt(m^2 * p^{-2} + c^{-2})
-    using std::hypot;
-    state.stepping.derivative(3) = hypot(1, state.options.mass / newMomentum);
     // Update time
     state.stepping.pars[eFreeTime] +=
         (h / 6.) * (tKi[0] + 2. * (tKi[1] + tKi[2]) + tKi[3]);
@@ -0,0 +1,49 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <type_traits>
+
+namespace Acts {
+namespace detail {
+
+/// @brief Storage of the Jacobians needed for the covariance transport
+///
+/// Stepper states inherit from this, the specialisation for
+/// @p covariance_transport = false carries no data and removes the
+/// Jacobian storage from states which never transport a covariance.
+template <bool covariance_transport>
+struct TransportJacobians {
+  /// The full jacobian of the transport entire transport
+  BoundMatrix jacobian = BoundMatrix::Identity();
+
+  /// Jacobian from local to the global frame
+  BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+
+  /// Pure transport jacobian part from runge kutta integration
+  FreeMatrix jacTransport = FreeMatrix::Identity();
+
+  /// The propagation derivative
+  FreeVector derivative = FreeVector::Zero();
+};
+
+template <>
+struct TransportJacobians<false> {};
+
+/// Whether a stepper state carries the transport Jacobians, i.e. it was not
+/// explicitly built without them
+template <typename stepper_state_t>
+constexpr bool hasTransportJacobians =
+    !std::is_base_of_v<TransportJacobians<false>, stepper_state_t>;
+
+}  // namespace detail
+}  // namespace Acts
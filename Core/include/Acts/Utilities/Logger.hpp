@@ -58,8 +58,11 @@
   __local_acts_logger logger(log_object);
 
 // Debug level agnostic implementation of the ACTS_XYZ logging macros
+//
+// The compile-time check is constant and removes the whole statement for
+// levels below Acts::Logging::MINIMUM_LEVEL.
 #define ACTS_LOG(level, x)                                                     \
-  if (logger().doPrint(level)) {                                               \
+  if ((Acts::Logging::MINIMUM_LEVEL <= (level)) and logger().doPrint(level)) { \
     std::ostringstream os;                                                     \
     os << x;                                                                   \
     logger().log(level, os.str());                                             \
@@ -170,6 +173,25 @@ constexpr Level FAILURE_THRESHOLD =
     Level::MAX;
 #endif
 
+/// @brief debug level below which log statements are removed at compile time
+///
+/// All ACTS_* logging macros with a debug level lower than MINIMUM_LEVEL are
+/// compiled out, i.e. neither the level check nor the message formatting
+/// remain in the code. This is controlled via the ACTS_LOG_MINIMUM_LEVEL
+/// preprocessor define and removes the overhead of e.g. verbose output in hot
+/// loops. Loggers can still be configured with a lower threshold but never
+/// receive the removed messages.
+constexpr Level MINIMUM_LEVEL =
+#ifdef ACTS_LOG_MINIMUM_LEVEL
+    static_cast<Level>(ACTS_LOG_MINIMUM_LEVEL);
+#else
+    Level::VERBOSE;
+#endif
+
+static_assert(MINIMUM_LEVEL <= FAILURE_THRESHOLD,
+              "ACTS_LOG_MINIMUM_LEVEL must not remove messages that exceed "
+              "the ACTS_LOG_FAILURE_THRESHOLD");
+
 /// @brief abstract base class for printing debug output
 ///
 /// Implementations of this interface need to define how and where to @a print
@@ -438,6 +460,50 @@ class DefaultPrintPolicy final : public OutputPrintPolicy {
   /// pointer to destination output stream
   std::ostream* m_out;
 };
+
+/// @brief print policy for writing debug messages on a background thread
+///
+/// The fully formatted message is queued in a lock-free buffer owned by the
+/// calling thread and written to the output stream by a single background
+/// thread shared by all instances. The calling thread never waits on the
+/// output stream or on other logging threads, unless its buffer is full.
+/// Messages from one thread keep their order; messages from different threads
+/// are written in the order in which they are collected and output written
+/// directly to the same stream can appear out of order.
+///
+/// Messages exceeding the FAILURE_THRESHOLD are written before the exception
+/// is thrown. All remaining messages are written at program exit.
+class AsyncPrintPolicy final : public OutputPrintPolicy {
+ public:
+  /// @brief constructor
+  ///
+  /// @param [in] out pointer to output stream object
+  ///
+  /// @pre @p out is non-zero and must outlive all queued messages
+  explicit AsyncPrintPolicy(std::ostream* out = &std::cout) : m_out(out) {}
+
+  /// @brief queue the debug message for the destination stream
+  ///
+  /// @param [in] lvl   debug level of debug message
+  /// @param [in] input text of debug message
+  void flush(const Level& lvl, const std::string& input) final;
+
+ private:
+  /// pointer to destination output stream
+  std::ostream* m_out;
+};
+
+/// @brief wait until all queued asynchronous debug messages are written
+///
+/// Only messages queued before the call are guaranteed to be written.
+void flushAsyncOutput();
+
+/// @brief select the print policy used by getDefaultLogger
+///
+/// @param [in] async use AsyncPrintPolicy instead of DefaultPrintPolicy
+///
+/// Only affects loggers created afterwards. Disabled by default.
+void setDefaultAsyncOutput(bool async);
 }  // namespace Logging
 
 /// @brief class for printing debug output
@@ -527,6 +593,9 @@ class LoggerWrapper {
 /// - name of logging instance
 /// - debug level
 ///
+/// Messages are written asynchronously if enabled via
+/// Logging::setDefaultAsyncOutput.
+///
 /// @return pointer to logging instance
 std::unique_ptr<const Logger> getDefaultLogger(
     const std::string& name, const Logging::Level& lvl,
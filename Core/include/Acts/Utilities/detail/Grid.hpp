@@ -149,7 +149,23 @@ class Grid final {
   template <class Point>
   detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
       const Point& position) const {
-    return rawClosestPointsIndices(localBinsFromPosition(position));
+    return closestPointsIndicesFromLocalBins(localBinsFromPosition(position));
+  }
+
+  /// @brief get global bin indices for closest points on grid
+  ///
+  /// @param [in] localBins local bin indices of the bin containing the point
+  ///                       of interest
+  /// @return Iterable that emits the indices of bins whose lower-left corners
+  ///         are the closest points on the grid to any point in the bin.
+  ///
+  /// @note Avoids resolving the local bins again if they are already known,
+  ///       e.g. to also compute the bin edges.
+  ///
+  /// @pre The given bin must not be an under-/overflow bin along any axis.
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndicesFromLocalBins(
+      const index_t& localBins) const {
+    return grid_helper::closestPointsIndices(localBins, m_axes);
   }
 
   /// @brief dimensionality of grid
@@ -356,7 +372,7 @@ class Grid final {
     const auto& llIndices = localBinsFromPosition(point);
 
     // get global indices for all surrounding corner points
-    const auto& closestIndices = rawClosestPointsIndices(llIndices);
+    const auto& closestIndices = closestPointsIndicesFromLocalBins(llIndices);
 
     // get values on grid points
     size_t i = 0;
@@ -421,19 +437,16 @@ class Grid final {
     return grid_helper::getAxes(m_axes);
   }
 
+  /// @brief get the actual axis objects spanning the grid
+  ///
+  /// @return tuple of axes, e.g. to create a grid with different values
+  const std::tuple<Axes...>& axesTuple() const { return m_axes; }
+
  private:
   /// set of axis defining the multi-dimensional grid
   std::tuple<Axes...> m_axes;
   /// linear value store for each bin
   std::vector<T> m_values;
-
-  // Part of closestPointsIndices that goes after local bins resolution.
-  // Used as an interpolation performance optimization, but not exposed as it
-  // doesn't make that much sense from an API design standpoint.
-  detail::GlobalNeighborHoodIndices<DIM> rawClosestPointsIndices(
-      const index_t& localBins) const {
-    return grid_helper::closestPointsIndices(localBins, m_axes);
-  }
 };
 }  // namespace detail
 
@@ -0,0 +1,169 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
+
+#include <array>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+namespace Acts {
+
+namespace detail {
+
+/// @brief read-only grid on values stored elsewhere
+///
+/// @tparam T    type of values stored inside the bins of the grid
+/// @tparam Axes parameter pack of axis types defining the grid
+///
+/// Provides the read-only interface of Acts::detail::Grid, e.g. for values
+/// that are memory-mapped from a file. The values must be stored in the order
+/// of the global bin index including the under-/overflow bins. The memory is
+/// kept alive by shared ownership of its owner.
+template <typename T, class... Axes>
+class GridView final {
+ public:
+  /// number of dimensions of the grid
+  static constexpr size_t DIM = sizeof...(Axes);
+
+  /// type of values stored
+  using value_type = T;
+  /// constant reference type to values stored
+  using const_reference = const value_type&;
+  /// type for points in d-dimensional grid space
+  using point_t = std::array<ActsScalar, DIM>;
+  /// index type using local bin indices along each axis
+  using index_t = std::array<size_t, DIM>;
+
+  /// @brief create the grid view
+  ///
+  /// @param [in] axes   actual axis objects spanning the grid
+  /// @param [in] values values for all bins ordered by global bin index
+  /// @param [in] owner  object owning the memory of the values
+  GridView(std::tuple<Axes...> axes, const T* values,
+           std::shared_ptr<const void> owner)
+      : m_axes(std::move(axes)), m_values(values), m_owner(std::move(owner)) {}
+
+  /// @brief access value stored in bin with given global bin number
+  ///
+  /// @param  [in] bin global bin number
+  /// @return const-reference to value stored in the bin
+  ///
+  /// @pre The bin must be a valid global bin number.
+  const_reference at(size_t bin) const { return m_values[bin]; }
+
+  /// @brief access value stored in bin with given local bin numbers
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return const-reference to value stored in the bin
+  const_reference atLocalBins(const index_t& localBins) const {
+    return at(grid_helper::getGlobalBin(localBins, m_axes));
+  }
+
+  /// @copydoc Acts::detail::Grid::closestPointsIndices
+  template <class Point>
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
+      const Point& position) const {
+    return closestPointsIndicesFromLocalBins(localBinsFromPosition(position));
+  }
+
+  /// @copydoc Acts::detail::Grid::closestPointsIndicesFromLocalBins
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndicesFromLocalBins(
+      const index_t& localBins) const {
+    return grid_helper::closestPointsIndices(localBins, m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::localBinsFromPosition
+  template <class Point>
+  index_t localBinsFromPosition(const Point& point) const {
+    return grid_helper::getLocalBinIndices(point, m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::lowerLeftBinEdge
+  point_t lowerLeftBinEdge(const index_t& localBins) const {
+    return grid_helper::getLowerLeftBinEdge(localBins, m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::upperRightBinEdge
+  point_t upperRightBinEdge(const index_t& localBins) const {
+    return grid_helper::getUpperRightBinEdge(localBins, m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::numLocalBins
+  index_t numLocalBins() const { return grid_helper::getNBins(m_axes); }
+
+  /// @copydoc Acts::detail::Grid::minPosition
+  point_t minPosition() const { return grid_helper::getMin(m_axes); }
+
+  /// @copydoc Acts::detail::Grid::maxPosition
+  point_t maxPosition() const { return grid_helper::getMax(m_axes); }
+
+  /// @brief interpolate grid values to given position
+  ///
+  /// @param [in] point location to which to interpolate grid values. The
+  ///                   position must be within the grid dimensions and not
+  ///                   lie in an under-/overflow bin along any axis.
+  /// @return interpolated value at given position
+  ///
+  /// @note Bin values are interpreted as being the field values at the
+  /// lower-left corner of the corresponding hyper-box.
+  template <class Point>
+  T interpolate(const Point& point) const {
+    constexpr size_t nCorners = 1 << DIM;
+    std::array<value_type, nCorners> neighbors;
+
+    const auto& llIndices = localBinsFromPosition(point);
+    size_t i = 0;
+    for (size_t index : closestPointsIndicesFromLocalBins(llIndices)) {
+      neighbors[i++] = at(index);
+    }
+
+    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
+                             upperRightBinEdge(llIndices), neighbors);
+  }
+
+  /// @copydoc Acts::detail::Grid::isInside
+  template <class Point>
+  bool isInside(const Point& position) const {
+    return grid_helper::isInside(position, m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::size
+  size_t size() const {
+    index_t nBinsArray = numLocalBins();
+    return std::accumulate(
+        nBinsArray.begin(), nBinsArray.end(), 1,
+        [](const size_t& a, const size_t& b) { return a * (b + 2); });
+  }
+
+  std::array<const IAxis*, DIM> axes() const {
+    return grid_helper::getAxes(m_axes);
+  }
+
+  /// @copydoc Acts::detail::Grid::axesTuple
+  const std::tuple<Axes...>& axesTuple() const { return m_axes; }
+
+ private:
+  /// set of axis defining the multi-dimensional grid
+  std::tuple<Axes...> m_axes;
+  /// values for each global bin
+  const T* m_values;
+  /// owner of the memory of the values
+  std::shared_ptr<const void> m_owner;
+};
+
+}  // namespace detail
+
+}  // namespace Acts
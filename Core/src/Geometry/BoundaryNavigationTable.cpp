@@ -0,0 +1,120 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/BoundaryNavigationTable.hpp"
+
+#include "Acts/Definitions/Common.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/DiscBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+
+namespace {
+
+/// The outward normal of a planar boundary, if it can be determined
+///
+/// @param gctx The current geometry context object, e.g. alignment
+/// @param volume The volume the boundary belongs to
+/// @param surface The surface representation of the boundary
+std::optional<Acts::Vector3> outwardNormal(const Acts::GeometryContext& gctx,
+                                           const Acts::TrackingVolume& volume,
+                                           const Acts::Surface& surface) {
+  // A reference position within the bounds of the surface
+  Acts::Vector3 position;
+  if (surface.type() == Acts::Surface::Plane) {
+    position = surface.center(gctx);
+  } else if (surface.type() == Acts::Surface::Disc) {
+    const auto& bounds =
+        static_cast<const Acts::DiscBounds&>(surface.bounds());
+    position = surface.localToGlobal(
+        gctx, Acts::Vector2(bounds.binningValueR(), bounds.binningValuePhi()),
+        surface.normal(gctx));
+  } else {
+    return std::nullopt;
+  }
+  // Test on which side of the surface the volume is
+  const Acts::Vector3 normal = surface.normal(gctx, position);
+  const double offset = 10 * Acts::s_onSurfaceTolerance;
+  const bool insideAlong = volume.inside(position + offset * normal);
+  const bool insideOpposite = volume.inside(position - offset * normal);
+  if (insideAlong == insideOpposite) {
+    return std::nullopt;
+  }
+  return insideOpposite ? normal : Acts::Vector3(-normal);
+}
+
+/// Whether all directions spanned by the corners point against the normal
+bool pointsInward(const std::array<Acts::Vector3, 4>& corners,
+                  const Acts::Vector3& normal) {
+  return std::all_of(
+      corners.begin(), corners.end(),
+      [&](const Acts::Vector3& c) { return c.dot(normal) <= Acts::s_epsilon; });
+}
+
+}  // namespace
+
+Acts::BoundaryNavigationTable::BoundaryNavigationTable(
+    const GeometryContext& gctx, const TrackingVolume& volume, size_t nBins)
+    : m_nBins(std::max<size_t>(nBins, 1)),
+      m_candidates(6 * m_nBins * m_nBins) {
+  // The boundaries of the volume with the outward normals of the planar ones
+  std::vector<std::pair<const BoundarySurface*, std::optional<Vector3>>>
+      boundaries;
+  for (const auto& bs : volume.boundarySurfaces()) {
+    boundaries.emplace_back(
+        bs.get(), outwardNormal(gctx, volume, bs->surfaceRepresentation()));
+  }
+  // Dense volumes can be entered from all sides
+  for (const auto& dv : volume.denseVolumes()) {
+    for (const auto& bs : dv->boundarySurfaces()) {
+      boundaries.emplace_back(bs.get(), std::nullopt);
+    }
+  }
+
+  const double binWidth = 2. / m_nBins;
+  for (size_t face = 0; face < 6; ++face) {
+    const size_t axis = face / 2;
+    const double sign = (face % 2 == 0) ? 1. : -1.;
+    for (size_t iu = 0; iu < m_nBins; ++iu) {
+      for (size_t iv = 0; iv < m_nBins; ++iv) {
+        // The (not normalized) corner directions of the cell
+        std::array<Vector3, 4> corners;
+        for (size_t ic = 0; ic < 4; ++ic) {
+          corners[ic][axis] = sign;
+          corners[ic][(axis + 1) % 3] = -1. + (iu + ic / 2) * binWidth;
+          corners[ic][(axis + 2) % 3] = -1. + (iv + ic % 2) * binWidth;
+        }
+        auto& candidates = m_candidates[(face * m_nBins + iu) * m_nBins + iv];
+        for (const auto& [bs, normal] : boundaries) {
+          // Drop a planar boundary if all directions of the cell point into
+          // the volume there, parallel ones (up to rounding) do not cross it
+          if (normal and pointsInward(corners, *normal)) {
+            continue;
+          }
+          candidates.push_back(bs);
+        }
+      }
+    }
+  }
+}
+
+size_t Acts::BoundaryNavigationTable::bin(const Vector3& direction) const {
+  Eigen::Index axis = 0;
+  const double major = direction.cwiseAbs().maxCoeff(&axis);
+  const size_t face = 2 * axis + (direction[axis] < 0. ? 1 : 0);
+  auto binOf = [&](double value) {
+    const double u = 0.5 * (value / major + 1.) * m_nBins;
+    return std::min(static_cast<size_t>(std::max(u, 0.)), m_nBins - 1);
+  };
+  return (face * m_nBins + binOf(direction[(axis + 1) % 3])) * m_nBins +
+         binOf(direction[(axis + 2) % 3]);
+}
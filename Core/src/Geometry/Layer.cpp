@@ -8,6 +8,8 @@
 
 #include "Acts/Geometry/Layer.hpp"
 
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -41,6 +43,27 @@ Acts::ApproachDescriptor* Acts::Layer::approachDescriptor() {
   return const_cast<ApproachDescriptor*>(m_approachDescriptor.get());
 }
 
+void Acts::Layer::createSurfaceHierarchy(const GeometryContext& gctx,
+                                         size_t maxDepth, double envelope) {
+  m_surfaceBoxes.clear();
+  m_surfaceHierarchy = nullptr;
+  if (!m_surfaceArray || m_surfaceArray->surfaces().empty()) {
+    return;
+  }
+  // the primitive boxes from the extent of the surfaces
+  std::vector<SurfaceBoundingBox*> prims;
+  for (const Surface* surface : m_surfaceArray->surfaces()) {
+    const Extent extent = surface->polyhedronRepresentation(gctx, 1).extent();
+    const Vector3 vmin(extent.min(binX), extent.min(binY), extent.min(binZ));
+    const Vector3 vmax(extent.max(binX), extent.max(binY), extent.max(binZ));
+    m_surfaceBoxes.push_back(std::make_unique<SurfaceBoundingBox>(
+        surface, vmin - Vector3::Constant(envelope),
+        vmax + Vector3::Constant(envelope)));
+    prims.push_back(m_surfaceBoxes.back().get());
+  }
+  m_surfaceHierarchy = make_octree(m_surfaceBoxes, prims, maxDepth);
+}
+
 void Acts::Layer::closeGeometry(const IMaterialDecorator* materialDecorator,
                                 const GeometryIdentifier& layerID) {
   // set the volumeID of this
@@ -51,6 +51,15 @@ Acts::TrackingGeometryBuilder::trackingGeometry(
     // first check if we have material to get
     const IMaterialDecorator* materialDecorator =
         m_cfg.materialDecorator ? m_cfg.materialDecorator.get() : nullptr;
+    // the boundary navigation tables need the final boundaries
+    if (m_cfg.boundaryNavigationTableBins > 0) {
+      highestVolume->createBoundaryNavigationTables(
+          gctx, m_cfg.boundaryNavigationTableBins);
+    }
+    if (m_cfg.buildSurfaceHierarchies) {
+      highestVolume->createSurfaceHierarchies(
+          gctx, m_cfg.surfaceHierarchyDepth, m_cfg.surfaceHierarchyEnvelope);
+    }
     // build and set the TrackingGeometry
     trackingGeometry.reset(
         new TrackingGeometry(highestVolume, materialDecorator));
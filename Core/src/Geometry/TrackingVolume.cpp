@@ -210,6 +210,7 @@ void Acts::TrackingVolume::glueTrackingVolume(const GeometryContext& gctx,
     }
     // Now set it to the neighbor volume
     (neighbor->m_boundarySurfaces).at(bsfNeighbor) = bSurfaceMine;
+    neighbor->m_boundaryTable.reset();
   }
 }
 
@@ -247,6 +248,7 @@ void Acts::TrackingVolume::glueTrackingVolumes(
     for (auto& nVolume : neighbors->arrayObjects()) {
       auto mutableNVolume = std::const_pointer_cast<TrackingVolume>(nVolume);
       (mutableNVolume->m_boundarySurfaces).at(bsfNeighbor) = bSurfaceMine;
+      mutableNVolume->m_boundaryTable.reset();
     }
   }
 }
@@ -274,6 +276,43 @@ void Acts::TrackingVolume::updateBoundarySurface(
     }
   }
   m_boundarySurfaces.at(bsf) = std::move(bs);
+  m_boundaryTable.reset();
+}
+
+void Acts::TrackingVolume::createBoundaryNavigationTables(
+    const GeometryContext& gctx, size_t nBins) {
+  m_boundaryTable =
+      std::make_unique<const BoundaryNavigationTable>(gctx, *this, nBins);
+  if (m_confinedVolumes) {
+    for (auto& volumesIter : m_confinedVolumes->arrayObjects()) {
+      auto mutableVolumesIter =
+          std::const_pointer_cast<TrackingVolume>(volumesIter);
+      mutableVolumesIter->createBoundaryNavigationTables(gctx, nBins);
+    }
+  }
+  for (auto& volumesIter : m_confinedDenseVolumes) {
+    volumesIter->createBoundaryNavigationTables(gctx, nBins);
+  }
+}
+
+void Acts::TrackingVolume::createSurfaceHierarchies(
+    const GeometryContext& gctx, size_t maxDepth, double envelope) {
+  if (m_confinedLayers) {
+    for (auto& layerPtr : m_confinedLayers->arrayObjects()) {
+      auto mutableLayerPtr = std::const_pointer_cast<Layer>(layerPtr);
+      mutableLayerPtr->createSurfaceHierarchy(gctx, maxDepth, envelope);
+    }
+  }
+  if (m_confinedVolumes) {
+    for (auto& volumesIter : m_confinedVolumes->arrayObjects()) {
+      auto mutableVolumesIter =
+          std::const_pointer_cast<TrackingVolume>(volumesIter);
+      mutableVolumesIter->createSurfaceHierarchies(gctx, maxDepth, envelope);
+    }
+  }
+  for (auto& volumesIter : m_confinedDenseVolumes) {
+    volumesIter->createSurfaceHierarchies(gctx, maxDepth, envelope);
+  }
 }
 
 void Acts::TrackingVolume::registerGlueVolumeDescriptor(
@@ -472,16 +511,15 @@ void Acts::TrackingVolume::visitSurfaces(
   }
 }
 
-// Returns the boundary surfaces ordered in probability to hit them based on
-std::vector<Acts::BoundaryIntersection>
-Acts::TrackingVolume::compatibleBoundaries(
+template <typename container_t>
+void Acts::TrackingVolume::fillCompatibleBoundaries(
     const GeometryContext& gctx, const Vector3& position,
     const Vector3& direction, const NavigationOptions<Surface>& options,
-    LoggerWrapper logger) const {
+    container_t& bIntersections, LoggerWrapper logger) const {
   ACTS_VERBOSE("Finding compatibleBoundaries");
   // Loop over boundarySurfaces and calculate the intersection
   auto excludeObject = options.startObject;
-  std::vector<BoundaryIntersection> bIntersections;
+  bIntersections.clear();
 
   // The signed direction: solution (except overstepping) is positive
   auto sDirection = options.navDir * direction;
@@ -545,54 +583,75 @@ Acts::TrackingVolume::compatibleBoundaries(
     return BoundaryIntersection();
   };
 
-  /// Helper function to process boundary surfaces
-  auto processBoundaries =
-      [&](const TrackingVolumeBoundaries& bSurfaces) -> void {
-    ACTS_VERBOSE("Processing boundaries");
-    // Loop over the boundary surfaces
-    for (auto& bsIter : bSurfaces) {
-      // Get the boundary surface pointer
-      const auto& bSurfaceRep = bsIter->surfaceRepresentation();
-      if (logger().doPrint(Logging::VERBOSE)) {
-        std::ostringstream os;
-        os << "Consider boundary surface " << &bSurfaceRep << " :\n";
-        bSurfaceRep.toStream(gctx, os);
-        logger().log(Logging::VERBOSE, os.str());
-      }
+  /// Helper function to process a boundary surface
+  auto processBoundary = [&](const BoundarySurface* bSurface) -> void {
+    // Get the boundary surface representation
+    const auto& bSurfaceRep = bSurface->surfaceRepresentation();
+    if (logger().doPrint(Logging::VERBOSE)) {
+      std::ostringstream os;
+      os << "Consider boundary surface " << &bSurfaceRep << " :\n";
+      bSurfaceRep.toStream(gctx, os);
+      logger().log(Logging::VERBOSE, os.str());
+    }
 
-      // Exclude the boundary where you are on
-      if (excludeObject != &bSurfaceRep) {
-        auto bCandidate = bSurfaceRep.intersect(gctx, position, sDirection,
-                                                options.boundaryCheck);
-        // Intersect and continue
-        auto bIntersection = checkIntersection(bCandidate, bsIter.get());
-        if (bIntersection) {
-          ACTS_VERBOSE(" - Proceed with surface");
-          bIntersections.push_back(bIntersection);
-        } else {
-          ACTS_VERBOSE(" - Surface intersecion invalid");
-        }
+    // Exclude the boundary where you are on
+    if (excludeObject != &bSurfaceRep) {
+      auto bCandidate = bSurfaceRep.intersect(gctx, position, sDirection,
+                                              options.boundaryCheck);
+      // Intersect and continue
+      auto bIntersection = checkIntersection(bCandidate, bSurface);
+      if (bIntersection) {
+        ACTS_VERBOSE(" - Proceed with surface");
+        bIntersections.push_back(bIntersection);
       } else {
-        ACTS_VERBOSE(" - Surface is excluded surface");
+        ACTS_VERBOSE(" - Surface intersecion invalid");
       }
+    } else {
+      ACTS_VERBOSE(" - Surface is excluded surface");
     }
   };
 
-  // Process the boundaries of the current volume
-  auto& bSurfaces = boundarySurfaces();
-  ACTS_VERBOSE("Volume reports " << bSurfaces.size() << " boundary surfaces");
-  processBoundaries(bSurfaces);
-
-  // Process potential boundaries of contained volumes
-  auto confinedDenseVolumes = denseVolumes();
-  ACTS_VERBOSE("Volume reports " << confinedDenseVolumes.size()
-                                 << " confined dense volumes");
-  for (const auto& dv : confinedDenseVolumes) {
-    auto& bSurfacesConfined = dv->boundarySurfaces();
-    ACTS_VERBOSE(" -> " << bSurfacesConfined.size() << " boundary surfaces");
-    processBoundaries(bSurfacesConfined);
+  // Only process the candidates of the direction if there is a table
+  if (m_boundaryTable != nullptr) {
+    const auto& candidates = m_boundaryTable->candidates(sDirection);
+    ACTS_VERBOSE("Table reports " << candidates.size()
+                                  << " candidate boundary surfaces");
+    for (const auto* bSurface : candidates) {
+      processBoundary(bSurface);
+    }
+  }
+
+  if (bIntersections.empty()) {
+    // Process the boundaries of the current volume
+    auto& bSurfaces = boundarySurfaces();
+    ACTS_VERBOSE("Volume reports " << bSurfaces.size()
+                                   << " boundary surfaces");
+    for (const auto& bsIter : bSurfaces) {
+      processBoundary(bsIter.get());
+    }
+
+    // Process potential boundaries of contained volumes
+    ACTS_VERBOSE("Volume reports " << m_confinedDenseVolumes.size()
+                                   << " confined dense volumes");
+    for (const auto& dv : m_confinedDenseVolumes) {
+      auto& bSurfacesConfined = dv->boundarySurfaces();
+      ACTS_VERBOSE(" -> " << bSurfacesConfined.size() << " boundary surfaces");
+      for (const auto& bsIter : bSurfacesConfined) {
+        processBoundary(bsIter.get());
+      }
+    }
   }
+}
 
+// Returns the boundary surfaces ordered in probability to hit them based on
+std::vector<Acts::BoundaryIntersection>
+Acts::TrackingVolume::compatibleBoundaries(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Surface>& options,
+    LoggerWrapper logger) const {
+  std::vector<BoundaryIntersection> bIntersections;
+  fillCompatibleBoundaries(gctx, position, direction, options, bIntersections,
+                           logger);
   // Sort them accordingly to the navigation direction
   if (options.navDir == forward) {
     std::sort(bIntersections.begin(), bIntersections.end());
@@ -602,11 +661,22 @@ Acts::TrackingVolume::compatibleBoundaries(
   return bIntersections;
 }
 
-std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
+void Acts::TrackingVolume::compatibleBoundaries(
     const GeometryContext& gctx, const Vector3& position,
-    const Vector3& direction, const NavigationOptions<Layer>& options) const {
+    const Vector3& direction, const NavigationOptions<Surface>& options,
+    boost::container::small_vector_base<BoundaryIntersection>& bIntersections,
+    LoggerWrapper logger) const {
+  fillCompatibleBoundaries(gctx, position, direction, options, bIntersections,
+                           logger);
+}
+
+template <typename container_t>
+void Acts::TrackingVolume::fillCompatibleLayers(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Layer>& options,
+    container_t& lIntersections) const {
   // the layer intersections which are valid
-  std::vector<LayerIntersection> lIntersections;
+  lIntersections.clear();
 
   // the confinedLayers
   if (m_confinedLayers != nullptr) {
@@ -642,17 +712,33 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
               ? nullptr
               : tLayer->nextLayer(gctx, position, options.navDir * direction);
     }
-    // sort them accordingly to the navigation direction
-    if (options.navDir == forward) {
-      std::sort(lIntersections.begin(), lIntersections.end());
-    } else {
-      std::sort(lIntersections.begin(), lIntersections.end(), std::greater<>());
-    }
+  }
+}
+
+std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Layer>& options) const {
+  // the layer intersections which are valid
+  std::vector<LayerIntersection> lIntersections;
+  fillCompatibleLayers(gctx, position, direction, options, lIntersections);
+  // sort them accordingly to the navigation direction
+  if (options.navDir == forward) {
+    std::sort(lIntersections.begin(), lIntersections.end());
+  } else {
+    std::sort(lIntersections.begin(), lIntersections.end(), std::greater<>());
   }
   // and return
   return lIntersections;
 }
 
+void Acts::TrackingVolume::compatibleLayers(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Layer>& options,
+    boost::container::small_vector_base<LayerIntersection>& lIntersections)
+    const {
+  fillCompatibleLayers(gctx, position, direction, options, lIntersections);
+}
+
 namespace {
 template <typename T>
 std::vector<const Acts::Volume*> intersectSearchHierarchy(
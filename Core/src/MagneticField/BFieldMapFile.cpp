@@ -0,0 +1,334 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/BFieldMapFile.hpp"
+
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+using Acts::VectorHelpers::perp;
+
+constexpr char kMagic[8] = {'A', 'C', 'T', 'S', 'B', 'F', 'M', '\0'};
+// written in native byte order to detect files from other architectures
+constexpr uint32_t kByteOrderMark = 0x01020304u;
+constexpr uint64_t kValuesAlignment = 64u;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t type;
+  uint32_t nAxes;
+  // offset of the values from the beginning of the file
+  uint64_t valuesOffset;
+  // number of field components of all grid points
+  uint64_t nValues;
+  Acts::BFieldMapFile::Axis axes[3];
+};
+
+static_assert(std::is_trivially_copyable_v<Header>,
+              "The header must be readable from raw memory");
+
+constexpr uint64_t kValuesOffset =
+    ((sizeof(Header) + kValuesAlignment - 1) / kValuesAlignment) *
+    kValuesAlignment;
+
+// number of values of all grid points including the under-/overflow bins;
+// zero if the number does not fit into 64 bit, e.g. for a corrupt header
+uint64_t numValues(const std::vector<Acts::BFieldMapFile::Axis>& axes,
+                   uint64_t nComponents) {
+  constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  uint64_t n = nComponents;
+  for (const auto& axis : axes) {
+    if ((kMax - 2u < axis.nBins) or (kMax / (axis.nBins + 2u) < n)) {
+      return 0u;
+    }
+    n *= axis.nBins + 2u;
+  }
+  return n;
+}
+
+// write the complete buffer, retrying on interrupts and partial writes
+// Create a new file next to the given path that is only used by the caller.
+//
+// Unlike mkstemp, the file is created with the permissions of a regular new
+// file, i.e. restricted by the umask of the process.
+int createTemporary(const std::string& path, std::string& tmpPath) {
+  static std::atomic<unsigned> s_counter = 0;
+  for (unsigned attempt = 0; attempt < 100u; ++attempt) {
+    tmpPath = path + "." + std::to_string(::getpid()) + "." +
+              std::to_string(s_counter++) + ".tmp";
+    int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                    0666);
+    if ((0 <= fd) or (errno != EEXIST)) {
+      return fd;
+    }
+  }
+  return -1;
+}
+
+bool writeAll(int fd, const void* data, size_t size) {
+  const char* begin = static_cast<const char*>(data);
+  while (0u < size) {
+    ssize_t written = ::write(fd, begin, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    begin += written;
+    size -= written;
+  }
+  return true;
+}
+
+template <size_t DIM>
+std::vector<Acts::BFieldMapFile::Axis> makeAxes(
+    const std::array<const Acts::IAxis*, DIM>& gridAxes) {
+  std::vector<Acts::BFieldMapFile::Axis> axes;
+  for (const auto* axis : gridAxes) {
+    axes.push_back({axis->getNBins(), axis->getMin(), axis->getMax()});
+  }
+  return axes;
+}
+
+Acts::detail::EquidistantAxis makeAxis(const Acts::BFieldMapFile::Axis& axis) {
+  return Acts::detail::EquidistantAxis(axis.min, axis.max, axis.nBins);
+}
+
+}  // namespace
+
+Acts::BFieldMapFile::BFieldMapFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open magnetic field map file '" +
+                             path + "'");
+  }
+  struct stat status;
+  if ((::fstat(fd, &status) != 0) or
+      (static_cast<size_t>(status.st_size) < sizeof(Header))) {
+    ::close(fd);
+    throw std::runtime_error("'" + path +
+                             "' is not a valid magnetic field map file");
+  }
+  m_size = status.st_size;
+  // the mapping stays valid after the file is closed
+  m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (m_data == MAP_FAILED) {
+    m_data = nullptr;
+    throw std::runtime_error("Could not map magnetic field map file '" +
+                             path + "'");
+  }
+
+  // the destructor does not run if the constructor throws
+  auto fail = [&](const std::string& reason) {
+    ::munmap(m_data, m_size);
+    throw std::runtime_error("'" + path +
+                             "' is not a valid magnetic field map file: " +
+                             reason);
+  };
+
+  Header header;
+  std::memcpy(&header, m_data, sizeof(Header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    fail("wrong file signature");
+  }
+  if (header.byteOrderMark != kByteOrderMark) {
+    fail("written with a different byte order");
+  }
+  if (header.version != kVersion) {
+    fail("unsupported version " + std::to_string(header.version));
+  }
+  if ((header.type != static_cast<uint32_t>(Type::RZ)) and
+      (header.type != static_cast<uint32_t>(Type::XYZ))) {
+    fail("unknown field map type");
+  }
+  m_type = static_cast<Type>(header.type);
+  // the number of field components is equal to the number of axes
+  uint32_t nComponents = (m_type == Type::RZ) ? 2u : 3u;
+  if (header.nAxes != nComponents) {
+    fail("wrong number of axes");
+  }
+  m_axes.assign(header.axes, header.axes + header.nAxes);
+  for (const auto& axis : m_axes) {
+    if ((axis.nBins == 0u) or not(axis.min < axis.max)) {
+      fail("invalid axis");
+    }
+  }
+  uint64_t nValues = numValues(m_axes, nComponents);
+  if (nValues == 0u) {
+    fail("too many grid points");
+  }
+  if (header.nValues != nValues) {
+    fail("wrong number of values");
+  }
+  if (((header.valuesOffset % kValuesAlignment) != 0u) or
+      (header.valuesOffset < sizeof(Header)) or
+      (m_size < header.valuesOffset) or
+      ((m_size - header.valuesOffset) / sizeof(double) < header.nValues)) {
+    fail("truncated or misaligned values");
+  }
+  m_values = reinterpret_cast<const double*>(static_cast<const char*>(m_data) +
+                                             header.valuesOffset);
+}
+
+Acts::BFieldMapFile::~BFieldMapFile() {
+  if (m_data != nullptr) {
+    ::munmap(m_data, m_size);
+  }
+}
+
+void Acts::BFieldMapFile::write(const std::string& path, Type type,
+                                const std::vector<Axis>& axes,
+                                const std::vector<double>& values) {
+  uint32_t nComponents = (type == Type::RZ) ? 2u : 3u;
+  if (axes.size() != nComponents) {
+    throw std::invalid_argument("Wrong number of magnetic field map axes");
+  }
+  uint64_t nValues = numValues(axes, nComponents);
+  if ((nValues == 0u) or (values.size() != nValues)) {
+    throw std::invalid_argument("Wrong number of magnetic field map values");
+  }
+
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.byteOrderMark = kByteOrderMark;
+  header.type = static_cast<uint32_t>(type);
+  header.nAxes = axes.size();
+  header.valuesOffset = kValuesOffset;
+  header.nValues = values.size();
+  std::copy(axes.begin(), axes.end(), header.axes);
+
+  // Other processes might have the file mapped. It must never be modified
+  // in place, so the content is written to a temporary file in the same
+  // directory that atomically replaces the previous file once complete.
+  std::string tmpPath;
+  int fd = createTemporary(path, tmpPath);
+  if (fd < 0) {
+    throw std::runtime_error("Could not write magnetic field map file '" +
+                             path + "'");
+  }
+  const char padding[kValuesOffset - sizeof(Header)] = {};
+  bool success = writeAll(fd, &header, sizeof(Header)) and
+                 writeAll(fd, padding, sizeof(padding)) and
+                 writeAll(fd, values.data(), values.size() * sizeof(double)) and
+                 (::fsync(fd) == 0);
+  success = (::close(fd) == 0) and success;
+  success = success and (::rename(tmpPath.c_str(), path.c_str()) == 0);
+  if (not success) {
+    ::unlink(tmpPath.c_str());
+    throw std::runtime_error("Could not write magnetic field map file '" +
+                             path + "'");
+  }
+}
+
+Acts::MappedBFieldMapperRZ Acts::mappedFieldMapperRZ(
+    std::shared_ptr<const BFieldMapFile> file) {
+  if (file->type() != BFieldMapFile::Type::RZ) {
+    throw std::invalid_argument("Magnetic field map file is not a r/z map");
+  }
+  using Grid_t = MappedBFieldMapperRZ::Grid_t;
+  const auto& axes = file->axes();
+  const auto* values = reinterpret_cast<const Vector2*>(file->values());
+  Grid_t grid(std::make_tuple(makeAxis(axes[0]), makeAxis(axes[1])), values,
+              std::move(file));
+
+  // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Acts::Vector3& pos) {
+    return Acts::Vector2(perp(pos), pos.z());
+  };
+
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Acts::Vector2& field,
+                            const Acts::Vector3& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi, sin_phi;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    } else {
+      cos_phi = 1.;
+      sin_phi = 0.;
+    }
+    return Acts::Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+
+  return MappedBFieldMapperRZ(transformPos, transformBField, std::move(grid));
+}
+
+Acts::MappedBFieldMapperXYZ Acts::mappedFieldMapperXYZ(
+    std::shared_ptr<const BFieldMapFile> file) {
+  if (file->type() != BFieldMapFile::Type::XYZ) {
+    throw std::invalid_argument("Magnetic field map file is not a x/y/z map");
+  }
+  using Grid_t = MappedBFieldMapperXYZ::Grid_t;
+  const auto& axes = file->axes();
+  const auto* values = reinterpret_cast<const Vector3*>(file->values());
+  Grid_t grid(std::make_tuple(makeAxis(axes[0]), makeAxis(axes[1]),
+                              makeAxis(axes[2])),
+              values, std::move(file));
+
+  // map (x,y,z) -> (x,y,z)
+  auto transformPos = [](const Acts::Vector3& pos) { return pos; };
+
+  // map (Bx,By,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Acts::Vector3& field,
+                            const Acts::Vector3& /*pos*/) { return field; };
+
+  return MappedBFieldMapperXYZ(transformPos, transformBField, std::move(grid));
+}
+
+void Acts::writeBFieldMapFile(
+    const std::string& path,
+    const InterpolatedBFieldMapper<
+        detail::Grid<Vector2, detail::EquidistantAxis,
+                     detail::EquidistantAxis>>& mapper) {
+  const auto& grid = mapper.getGrid();
+  std::vector<double> values;
+  values.reserve(2 * grid.size());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    values.insert(values.end(), grid.at(bin).data(), grid.at(bin).data() + 2);
+  }
+  BFieldMapFile::write(path, BFieldMapFile::Type::RZ, makeAxes(grid.axes()),
+                       values);
+}
+
+void Acts::writeBFieldMapFile(
+    const std::string& path,
+    const InterpolatedBFieldMapper<
+        detail::Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                     detail::EquidistantAxis>>& mapper) {
+  const auto& grid = mapper.getGrid();
+  std::vector<double> values;
+  values.reserve(3 * grid.size());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    values.insert(values.end(), grid.at(bin).data(), grid.at(bin).data() + 3);
+  }
+  BFieldMapFile::write(path, BFieldMapFile::Type::XYZ, makeAxes(grid.axes()),
+                       values);
+}
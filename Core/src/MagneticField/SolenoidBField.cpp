@@ -8,14 +8,31 @@
 
 #include "Acts/MagneticField/SolenoidBField.hpp"
 
+#include "Acts/MagneticField/BFieldMapFile.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
 #include <boost/exception/exception.hpp>
 #include <boost/math/special_functions/ellint_1.hpp>
 #include <boost/math/special_functions/ellint_2.hpp>
 
+struct Acts::SolenoidBField::Table {
+  using Grid_t = MappedBFieldMapperRZ::Grid_t;
+
+  std::once_flag built;
+  std::optional<Grid_t> grid;
+};
+
 Acts::SolenoidBField::SolenoidBField(Config config) : m_cfg(std::move(config)) {
   m_dz = m_cfg.length / m_cfg.nCoils;
   m_R2 = m_cfg.radius * m_cfg.radius;
@@ -25,6 +42,12 @@ Acts::SolenoidBField::SolenoidBField(Config config) : m_cfg(std::move(config)) {
   m_scale = m_cfg.bMagCenter / field.norm();
 }
 
+Acts::SolenoidBField::SolenoidBField(Config config, TableConfig tableConfig)
+    : SolenoidBField(std::move(config)) {
+  m_tableCfg = std::move(tableConfig);
+  m_table = std::make_shared<Table>();
+}
+
 Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
     const MagneticFieldContext& mctx) const {
   return MagneticFieldProvider::Cache::make<Cache>(mctx);
@@ -33,7 +56,7 @@ Acts::MagneticFieldProvider::Cache Acts::SolenoidBField::makeCache(
 Acts::Vector3 Acts::SolenoidBField::getField(const Vector3& position) const {
   using VectorHelpers::perp;
   Vector2 rzPos(perp(position), position.z());
-  Vector2 rzField = multiCoilField(rzPos, m_scale);
+  Vector2 rzField = getField(rzPos);
   Vector3 xyzField(0, 0, rzField[1]);
 
   if (rzPos[0] != 0.) {
@@ -50,7 +73,111 @@ Acts::Vector3 Acts::SolenoidBField::getField(
   return getField(position);
 }
 
+void Acts::SolenoidBField::getFieldBatch(
+    const Eigen::Ref<const BatchMatrix>& positions,
+    Eigen::Ref<BatchMatrix> fields,
+    MagneticFieldProvider::Cache& /*cache*/) const {
+  if (m_table) {
+    for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+      fields.col(i) = getField(Vector3(positions.col(i)));
+    }
+    return;
+  }
+  multiCoilFieldBatch(positions, fields);
+}
+
+void Acts::SolenoidBField::multiCoilFieldBatch(
+    const Eigen::Ref<const BatchMatrix>& positions,
+    Eigen::Ref<BatchMatrix> fields) const {
+  // fixed number of points per iteration so all inner loops can be vectorised
+  constexpr size_t kWidth = 8;
+  // the arithmetic-geometric mean converges quadratically; this is sufficient
+  // for double precision unless the point is directly on a coil.
+  constexpr size_t kAgmIterations = 10;
+  using Lanes = std::array<double, kWidth>;
+
+  size_t n = positions.cols();
+  for (size_t begin = 0; begin < n; begin += kWidth) {
+    size_t width = std::min(kWidth, n - begin);
+    Lanes r{};
+    Lanes z{};
+    for (size_t j = 0; j < width; ++j) {
+      r[j] = VectorHelpers::perp(Vector3(positions.col(begin + j)));
+      z[j] = positions(2, begin + j);
+    }
+    // the general expressions are singular on the axis
+    Lanes rSafe;
+    for (size_t j = 0; j < kWidth; ++j) {
+      rSafe[j] = (r[j] == 0.) ? 1. : r[j];
+    }
+
+    Lanes bR{};
+    Lanes bZ{};
+    for (size_t coil = 0; coil < m_cfg.nCoils; coil++) {
+      double shift = m_cfg.length * 0.5 - m_dz * (coil + 0.5);
+      for (size_t j = 0; j < kWidth; ++j) {
+        double zc = z[j] + shift;
+        double rs = rSafe[j];
+        double k_2 = k2(rs, zc);
+        double k = std::sqrt(k_2);
+        // complete elliptic integrals for the same argument as used by the
+        // single position lookup, i.e. ellint_1(k_2) and ellint_2(k_2)
+        double a = 1.;
+        double b = std::sqrt(1. - k_2 * k_2);
+        double weight = 0.5;
+        double sum = 0.5 * k_2 * k_2;
+        for (size_t it = 0; it < kAgmIterations; ++it) {
+          double c = 0.5 * (a - b);
+          double an = 0.5 * (a + b);
+          b = std::sqrt(a * b);
+          a = an;
+          weight *= 2.;
+          sum += weight * c * c;
+        }
+        double ellint1 = M_PI / (2. * a);
+        double ellint2 = ellint1 * (1. - sum);
+
+        double constantR = m_scale * k * zc /
+                           (4 * M_PI * std::sqrt(m_cfg.radius * rs * rs * rs));
+        double fieldR = (2. - k_2) / (2. - 2. * k_2) * ellint2 - ellint1;
+        double constantZ =
+            m_scale * k / (4 * M_PI * std::sqrt(m_cfg.radius * rs));
+        double fieldZ = ((m_cfg.radius + rs) * k_2 - 2. * rs) /
+                            (2. * rs * (1. - k_2)) * ellint2 +
+                        ellint1;
+        double axisZ = m_scale / 2. * m_R2 /
+                       (std::sqrt(m_R2 + zc * zc) * (m_R2 + zc * zc));
+
+        bR[j] += (r[j] == 0.) ? 0. : constantR * fieldR;
+        bZ[j] += (r[j] == 0.) ? axisZ : constantZ * fieldZ;
+      }
+    }
+
+    for (size_t j = 0; j < width; ++j) {
+      Vector3 xyzField(0, 0, bZ[j]);
+      if (r[j] != 0.) {
+        // radially symmetric xy field component
+        xyzField.x() = positions(0, begin + j) / r[j] * bR[j];
+        xyzField.y() = positions(1, begin + j) / r[j] * bR[j];
+      }
+      fields.col(begin + j) = xyzField;
+    }
+  }
+}
+
 Acts::Vector2 Acts::SolenoidBField::getField(const Vector2& position) const {
+  if (m_table) {
+    const Table& tab = table();
+    double r = std::abs(position[0]);
+    if (useTable(tab, r, position[1])) {
+      Vector2 field = tab.grid->interpolate(Vector2(r, position[1]));
+      // position[0] is signed, see B_r
+      if (position[0] < 0) {
+        field[0] = -field[0];
+      }
+      return field;
+    }
+  }
   return multiCoilField(position, m_scale);
 }
 
@@ -65,6 +192,233 @@ Acts::Vector3 Acts::SolenoidBField::getFieldGradient(
   return getField(position);
 }
 
+const Acts::SolenoidBField::Table& Acts::SolenoidBField::table() const {
+  std::call_once(m_table->built, [this] { buildTable(*m_table); });
+  return *m_table;
+}
+
+bool Acts::SolenoidBField::useTable(const Table& table, double r,
+                                    double z) const {
+  // the analytic field on the axis is not the limit towards the axis
+  return (r != 0.) and table.grid->isInside(Vector2(r, z));
+}
+
+void Acts::SolenoidBField::buildTable(Table& table) const {
+  using Grid_t = Table::Grid_t;
+
+  const double rMax =
+      (m_tableCfg.rMax > 0.) ? m_tableCfg.rMax : 2. * m_cfg.radius;
+  const double zMax = (m_tableCfg.zMax > 0.) ? m_tableCfg.zMax : m_cfg.length;
+  const double tolerance = m_tableCfg.tolerance * std::abs(m_cfg.bMagCenter);
+
+  // the field is singular at the coils, i.e. the interpolation error is not
+  // controlled in bins close to them
+  auto nearCoils = [&](double r, double z, double stepR, double stepZ) {
+    return (std::abs(r - m_cfg.radius) < m_tableCfg.coilMargin + stepR) and
+           (std::abs(z) < 0.5 * m_cfg.length + m_tableCfg.coilMargin + stepZ);
+  };
+
+  // evaluate the analytic field at r/z positions; grid points on the axis
+  // take the limit towards the axis, which is what is interpolated, and grid
+  // points at the coil radius are moved slightly to avoid hitting a coil
+  auto evaluate = [&](const std::vector<Vector2>& rzPositions) {
+    BatchMatrix positions(3, rzPositions.size());
+    for (size_t i = 0; i < rzPositions.size(); ++i) {
+      double r = std::max(rzPositions[i][0], 1e-6 * rMax);
+      if (std::abs(r - m_cfg.radius) < 1e-6 * m_cfg.radius) {
+        r = (1. + 1e-6) * m_cfg.radius;
+      }
+      positions.col(i) << r, 0., rzPositions[i][1];
+    }
+    BatchMatrix fields(3, rzPositions.size());
+    multiCoilFieldBatch(positions, fields);
+    std::vector<Vector2> rzFields;
+    rzFields.reserve(rzPositions.size());
+    for (size_t i = 0; i < rzPositions.size(); ++i) {
+      rzFields.emplace_back(fields(0, i), fields(2, i));
+    }
+    return rzFields;
+  };
+
+  // maximum interpolation error at the centers of a sample of bins
+  auto tableError = [&](const Grid_t& grid) {
+    constexpr size_t nSamples = 16;
+    auto nBins = grid.numLocalBins();
+    double stepR = rMax / nBins[0];
+    double stepZ = 2. * zMax / nBins[1];
+    std::vector<Vector2> centers;
+    for (size_t i = 0; i < nSamples; ++i) {
+      for (size_t j = 0; j < nSamples; ++j) {
+        Vector2 center(rMax * (2 * i + 1) / (2 * nSamples),
+                       zMax * ((2. * j + 1) / nSamples - 1.));
+        // move to the closest bin center
+        center[0] = (std::floor(center[0] / stepR) + 0.5) * stepR;
+        center[1] = (std::floor((center[1] + zMax) / stepZ) + 0.5) * stepZ -
+                    zMax;
+        if (not nearCoils(center[0], center[1], stepR, stepZ)) {
+          centers.push_back(center);
+        }
+      }
+    }
+    auto exact = evaluate(centers);
+    double error = 0.;
+    for (size_t i = 0; i < centers.size(); ++i) {
+      error = std::max(error, (grid.interpolate(centers[i]) - exact[i]).norm());
+    }
+    return error;
+  };
+
+  // the table can not be refined further
+  auto isFinest = [&](size_t nBinsR, size_t nBinsZ) {
+    return (2 * nBinsR > m_tableCfg.maxBins) or
+           (2 * nBinsZ > m_tableCfg.maxBins);
+  };
+
+  // map the table file if it covers the table range and the number of bins
+  // is accepted, the grid is left empty otherwise
+  auto mapFile = [&](auto&& accept) {
+    try {
+      auto file = std::make_shared<const BFieldMapFile>(m_tableCfg.file);
+      const auto& axes = file->axes();
+      if ((file->type() == BFieldMapFile::Type::RZ) and (axes[0].min == 0.) and
+          (axes[0].max == rMax) and (axes[1].min == -zMax) and
+          (axes[1].max == zMax) and (axes[0].nBins <= m_tableCfg.maxBins) and
+          (axes[1].nBins <= m_tableCfg.maxBins)) {
+        table.grid.emplace(mappedFieldMapperRZ(file).getGrid());
+        if (accept(axes[0].nBins, axes[1].nBins)) {
+          return true;
+        }
+        table.grid.reset();
+      }
+    } catch (const std::runtime_error&) {
+      // missing or invalid file
+    }
+    return false;
+  };
+
+  if (not m_tableCfg.file.empty() and
+      mapFile([&](size_t nBinsR, size_t nBinsZ) {
+        return (tableError(*table.grid) <= tolerance) or
+               isFinest(nBinsR, nBinsZ);
+      })) {
+    return;
+  }
+
+  // The table is refined by halving the bin size along both axes. The values
+  // at the new grid points are compared to the interpolation in the previous
+  // table; refinement stops once the previous table meets the tolerance.
+  //
+  // The coils are placed symmetrically around z = 0, i.e. only the grid
+  // points at z >= 0 are evaluated and B_r is mirrored to -B_r at -z.
+  size_t nBinsR = 4;
+  size_t nBinsZ = 4 * std::max<long>(1, std::lround(2. * zMax / rMax));
+  // grid point values, index iR + iZ * (nBinsR + 1)
+  std::vector<Vector2> points((nBinsR + 1) * (nBinsZ + 1));
+  std::vector<size_t> newIndices;
+  std::vector<Vector2> rzPositions;
+  for (size_t iZ = nBinsZ / 2; iZ <= nBinsZ; ++iZ) {
+    for (size_t iR = 0; iR <= nBinsR; ++iR) {
+      newIndices.push_back(iR + iZ * (nBinsR + 1));
+      rzPositions.emplace_back(rMax * iR / nBinsR,
+                               zMax * (2. * iZ / nBinsZ - 1.));
+    }
+  }
+  auto mirror = [](std::vector<Vector2>& values, size_t nR, size_t nZ) {
+    for (size_t iZ = 0; iZ < nZ / 2; ++iZ) {
+      for (size_t iR = 0; iR <= nR; ++iR) {
+        const Vector2& value = values[iR + (nZ - iZ) * (nR + 1)];
+        values[iR + iZ * (nR + 1)] = Vector2(-value[0], value[1]);
+      }
+    }
+  };
+  auto values = evaluate(rzPositions);
+  for (size_t i = 0; i < newIndices.size(); ++i) {
+    points[newIndices[i]] = values[i];
+  }
+  mirror(points, nBinsR, nBinsZ);
+
+  do {
+    size_t fineR = 2 * nBinsR;
+    size_t fineZ = 2 * nBinsZ;
+    std::vector<Vector2> finePoints((fineR + 1) * (fineZ + 1));
+    newIndices.clear();
+    rzPositions.clear();
+    for (size_t iZ = fineZ / 2; iZ <= fineZ; ++iZ) {
+      for (size_t iR = 0; iR <= fineR; ++iR) {
+        size_t index = iR + iZ * (fineR + 1);
+        if ((iR % 2 == 0) and (iZ % 2 == 0)) {
+          finePoints[index] = points[iR / 2 + iZ / 2 * (nBinsR + 1)];
+        } else {
+          newIndices.push_back(index);
+          rzPositions.emplace_back(rMax * iR / fineR,
+                                   zMax * (2. * iZ / fineZ - 1.));
+        }
+      }
+    }
+    values = evaluate(rzPositions);
+
+    // the new grid points are at the bin centers and edge centers of the
+    // previous table, i.e. its interpolation is the mean of the bin corners
+    double error = 0.;
+    for (size_t i = 0; i < newIndices.size(); ++i) {
+      finePoints[newIndices[i]] = values[i];
+      if (nearCoils(rzPositions[i][0], rzPositions[i][1], rMax / nBinsR,
+                    2. * zMax / nBinsZ)) {
+        continue;
+      }
+      size_t iR = newIndices[i] % (fineR + 1);
+      size_t iZ = newIndices[i] / (fineR + 1);
+      Vector2 interpolated = Vector2::Zero();
+      for (size_t cornerR : {iR / 2, (iR + 1) / 2}) {
+        for (size_t cornerZ : {iZ / 2, (iZ + 1) / 2}) {
+          interpolated += 0.25 * points[cornerR + cornerZ * (nBinsR + 1)];
+        }
+      }
+      error = std::max(error, (interpolated - values[i]).norm());
+    }
+    mirror(finePoints, fineR, fineZ);
+
+    points = std::move(finePoints);
+    nBinsR = fineR;
+    nBinsZ = fineZ;
+    if (error <= tolerance) {
+      break;
+    }
+  } while (not isFinest(nBinsR, nBinsZ));
+
+  // bin values correspond to the lower left bin edges, i.e. the last grid
+  // points are stored in the overflow bins
+  auto axes = std::make_tuple(detail::EquidistantAxis(0., rMax, nBinsR),
+                              detail::EquidistantAxis(-zMax, zMax, nBinsZ));
+  auto binValues =
+      std::make_shared<std::vector<Vector2>>((nBinsR + 2) * (nBinsZ + 2));
+  std::fill(binValues->begin(), binValues->end(), Vector2::Zero());
+  for (size_t iZ = 0; iZ <= nBinsZ; ++iZ) {
+    for (size_t iR = 0; iR <= nBinsR; ++iR) {
+      size_t bin = detail::grid_helper::getGlobalBin({iR + 1, iZ + 1}, axes);
+      (*binValues)[bin] = points[iR + iZ * (nBinsR + 1)];
+    }
+  }
+
+  if (not m_tableCfg.file.empty()) {
+    // use the written file to share the table with other processes. The file
+    // is replaced atomically but may be replaced again before it is mapped,
+    // i.e. the mapped header is checked against the computed table.
+    const double* data = binValues->data()->data();
+    BFieldMapFile::write(
+        m_tableCfg.file, BFieldMapFile::Type::RZ,
+        {{nBinsR, 0., rMax}, {nBinsZ, -zMax, zMax}},
+        std::vector<double>(data, data + 2 * binValues->size()));
+    if (mapFile([&](size_t fileBinsR, size_t fileBinsZ) {
+          return (fileBinsR == nBinsR) and (fileBinsZ == nBinsZ);
+        })) {
+      return;
+    }
+  }
+  const Vector2* data = binValues->data();
+  table.grid.emplace(std::move(axes), data, std::move(binValues));
+}
+
 Acts::Vector2 Acts::SolenoidBField::multiCoilField(const Vector2& pos,
                                                    double scale) const {
   // iterate over all coils
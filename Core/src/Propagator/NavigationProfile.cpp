@@ -0,0 +1,59 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/NavigationProfile.hpp"
+
+Acts::NavigationCounters& Acts::NavigationCounters::operator+=(
+    const NavigationCounters& other) {
+  steps += other.steps;
+  stepTrialsRejected += other.stepTrialsRejected;
+  stepSizeClamps += other.stepSizeClamps;
+  intersectionsTried += other.intersectionsTried;
+  intersectionsRejected += other.intersectionsRejected;
+  intersectionsReused += other.intersectionsReused;
+  boundaryResolutions += other.boundaryResolutions;
+  return *this;
+}
+
+Acts::NavigationCounters& Acts::NavigationCounters::operator-=(
+    const NavigationCounters& other) {
+  steps -= other.steps;
+  stepTrialsRejected -= other.stepTrialsRejected;
+  stepSizeClamps -= other.stepSizeClamps;
+  intersectionsTried -= other.intersectionsTried;
+  intersectionsRejected -= other.intersectionsRejected;
+  intersectionsReused -= other.intersectionsReused;
+  boundaryResolutions -= other.boundaryResolutions;
+  return *this;
+}
+
+void Acts::NavigationProfile::merge(const NavigationProfile& other) {
+  for (const auto& [volumeId, counters] : other.volumes) {
+    volumes[volumeId] += counters;
+  }
+}
+
+Acts::NavigationCounters Acts::NavigationProfile::total() const {
+  NavigationCounters sum;
+  for (const auto& [volumeId, counters] : volumes) {
+    sum += counters;
+  }
+  return sum;
+}
+
+void Acts::NavigationProfile::writeCsv(std::ostream& os) const {
+  os << "volume_id,steps,step_trials_rejected,step_size_clamps,"
+        "intersections_tried,intersections_rejected,intersections_reused,"
+        "boundary_resolutions\n";
+  for (const auto& [volumeId, c] : volumes) {
+    os << volumeId.volume() << ',' << c.steps << ',' << c.stepTrialsRejected
+       << ',' << c.stepSizeClamps << ',' << c.intersectionsTried << ','
+       << c.intersectionsRejected << ',' << c.intersectionsReused << ','
+       << c.boundaryResolutions << '\n';
+  }
+}
@@ -281,6 +281,21 @@ Result<BoundState> boundState(const GeometryContext& geoContext,
       jacobian, accumulatedPath);
 }
 
+Result<BoundState> boundState(const GeometryContext& geoContext,
+                              const FreeVector& parameters,
+                              double accumulatedPath, const Surface& surface) {
+  // Create the bound parameters
+  Result<BoundVector> bv =
+      detail::transformFreeToBoundParameters(parameters, surface, geoContext);
+  if (!bv.ok()) {
+    return bv.error();
+  }
+  // Create the bound state
+  return std::make_tuple(
+      BoundTrackParameters(surface.getSharedPtr(), *bv, std::nullopt),
+      Jacobian(Jacobian::Identity()), accumulatedPath);
+}
+
 CurvilinearState curvilinearState(Covariance& covarianceMatrix,
                                   Jacobian& jacobian,
                                   FreeMatrix& transportJacobian,
@@ -318,6 +333,21 @@ CurvilinearState curvilinearState(Covariance& covarianceMatrix,
                          accumulatedPath);
 }
 
+CurvilinearState curvilinearState(const FreeVector& parameters,
+                                  double accumulatedPath) {
+  // Create the curvilinear parameters
+  Vector4 pos4 = Vector4::Zero();
+  pos4[ePos0] = parameters[eFreePos0];
+  pos4[ePos1] = parameters[eFreePos1];
+  pos4[ePos2] = parameters[eFreePos2];
+  pos4[eTime] = parameters[eFreeTime];
+  CurvilinearTrackParameters curvilinearParams(
+      pos4, parameters.segment<3>(eFreeDir0), parameters[eFreeQOverP]);
+  // Create the curvilinear state
+  return std::make_tuple(std::move(curvilinearParams),
+                         Jacobian(Jacobian::Identity()), accumulatedPath);
+}
+
 void covarianceTransport(Covariance& covarianceMatrix, Jacobian& jacobian,
                          FreeMatrix& transportJacobian, FreeVector& derivatives,
                          BoundToFreeMatrix& jacToGlobal,
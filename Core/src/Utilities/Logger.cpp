@@ -8,7 +8,15 @@
 
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace Acts {
 
@@ -50,18 +58,192 @@ std::unique_ptr<const Logger> makeDummyLogger() {
 std::unique_ptr<const Logger> s_dummyLogger{makeDummyLogger()};
 LoggerWrapper s_dummyLoggerWrapper{*s_dummyLogger};
 
+std::atomic<bool> s_defaultAsyncOutput{false};
+
+/// Collects messages from per-thread buffers and writes them on its thread.
+///
+/// Each buffer is a single-producer/single-consumer ring that is only written
+/// by its owning thread and only read by the background thread. The mutex is
+/// only needed to register new buffers and to wait for the background thread.
+class AsyncOutput {
+ public:
+  static AsyncOutput& instance() {
+    static AsyncOutput output;
+    return output;
+  }
+
+  ~AsyncOutput() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+  }
+
+  void push(std::ostream* out, const std::string& text) {
+    Ring& ring = localRing();
+    size_t tail = ring.tail.load(std::memory_order_relaxed);
+    size_t used = tail - ring.head.load(std::memory_order_acquire);
+    while (used == Ring::kCapacity) {
+      m_wakeup.notify_one();
+      std::this_thread::yield();
+      used = tail - ring.head.load(std::memory_order_acquire);
+    }
+    // reuses the memory of previous messages in the same slot
+    Record& record = ring.records[tail % Ring::kCapacity];
+    record.out = out;
+    record.text.assign(text);
+    ring.tail.store(tail + 1, std::memory_order_release);
+    m_numQueued.fetch_add(1, std::memory_order_release);
+    // the background thread polls regularly and is only woken up early if
+    // the buffer is at risk of running full
+    if ((used + 1) == (Ring::kCapacity / 2)) {
+      m_wakeup.notify_one();
+    }
+  }
+
+  void flush() {
+    uint64_t target = m_numQueued.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_numWritten < target) {
+      m_wakeup.notify_one();
+      m_written.wait_for(lock, std::chrono::milliseconds(1));
+    }
+  }
+
+ private:
+  struct Record {
+    std::ostream* out = nullptr;
+    std::string text;
+  };
+  struct Ring {
+    static constexpr size_t kCapacity = 1024;
+
+    std::array<Record, kCapacity> records;
+    // next record to be read by the background thread
+    std::atomic<size_t> head{0};
+    // next record to be written by the owning thread
+    std::atomic<size_t> tail{0};
+    // the owning thread has exited and no further records are added
+    std::atomic<bool> retired{false};
+  };
+  // retires the ring when the owning thread exits
+  struct LocalRing {
+    std::shared_ptr<Ring> ring;
+
+    ~LocalRing() {
+      if (ring) {
+        ring->retired.store(true, std::memory_order_release);
+      }
+    }
+  };
+
+  AsyncOutput() : m_thread([this]() { run(); }) {}
+
+  Ring& localRing() {
+    thread_local LocalRing local;
+    if (not local.ring) {
+      local.ring = std::make_shared<Ring>();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_rings.push_back(local.ring);
+    }
+    return *local.ring;
+  }
+
+  // write all currently queued records. must be called with the lock held.
+  uint64_t drain() {
+    uint64_t numWritten = 0;
+    std::ostream* last = nullptr;
+    for (auto& ring : m_rings) {
+      // retired rings must be checked before reading the remaining records
+      bool retired = ring->retired.load(std::memory_order_acquire);
+      size_t head = ring->head.load(std::memory_order_relaxed);
+      size_t tail = ring->tail.load(std::memory_order_acquire);
+      for (; head != tail; ++head) {
+        Record& record = ring->records[head % Ring::kCapacity];
+        if ((last != nullptr) and (last != record.out)) {
+          last->flush();
+        }
+        (*record.out) << record.text << '\n';
+        last = record.out;
+        record.text.clear();
+        ++numWritten;
+      }
+      ring->head.store(head, std::memory_order_release);
+      if (retired) {
+        ring.reset();
+      }
+    }
+    if (last != nullptr) {
+      last->flush();
+    }
+    m_rings.erase(std::remove(m_rings.begin(), m_rings.end(), nullptr),
+                  m_rings.end());
+    return numWritten;
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      uint64_t numWritten = drain();
+      if (0u < numWritten) {
+        m_numWritten += numWritten;
+        m_written.notify_all();
+        continue;
+      }
+      if (m_stop) {
+        break;
+      }
+      m_wakeup.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::condition_variable m_written;
+  std::vector<std::shared_ptr<Ring>> m_rings;
+  std::atomic<uint64_t> m_numQueued{0};
+  uint64_t m_numWritten = 0;
+  bool m_stop = false;
+  // must be initialized last since it immediately uses the other members
+  std::thread m_thread;
+};
+
 }  // namespace
+
+void AsyncPrintPolicy::flush(const Level& lvl, const std::string& input) {
+  AsyncOutput::instance().push(m_out, input);
+  if (lvl >= FAILURE_THRESHOLD) {
+    flushAsyncOutput();
+    throw std::runtime_error(
+        "Previous debug message exceeds the "
+        "ACTS_LOG_FAILURE_THRESHOLD configuration, bailing out");
+  }
+}
+
+void flushAsyncOutput() {
+  AsyncOutput::instance().flush();
+}
+
+void setDefaultAsyncOutput(bool async) {
+  s_defaultAsyncOutput = async;
+}
 }  // namespace Logging
 
 std::unique_ptr<const Logger> getDefaultLogger(const std::string& name,
                                                const Logging::Level& lvl,
                                                std::ostream* log_stream) {
   using namespace Logging;
+  std::unique_ptr<OutputPrintPolicy> printer;
+  if (s_defaultAsyncOutput) {
+    printer = std::make_unique<AsyncPrintPolicy>(log_stream);
+  } else {
+    printer = std::make_unique<DefaultPrintPolicy>(log_stream);
+  }
   auto output = std::make_unique<LevelOutputDecorator>(
       std::make_unique<NamedOutputDecorator>(
-          std::make_unique<TimedOutputDecorator>(
-              std::make_unique<DefaultPrintPolicy>(log_stream)),
-          name));
+          std::make_unique<TimedOutputDecorator>(std::move(printer)), name));
   auto print = std::make_unique<DefaultFilterPolicy>(lvl);
   return std::make_unique<const Logger>(std::move(output), std::move(print));
 }
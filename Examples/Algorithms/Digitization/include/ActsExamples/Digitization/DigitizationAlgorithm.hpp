@@ -14,9 +14,12 @@
 #include "ActsExamples/Digitization/DigitizationConfig.hpp"
 #include "ActsExamples/Digitization/MeasurementCreation.hpp"
 #include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsFatras/Digitization/Channelizer.hpp"
 #include "ActsFatras/Digitization/PlanarSurfaceDrift.hpp"
@@ -101,6 +104,17 @@ class DigitizationAlgorithm final : public BareAlgorithm {
   ActsFatras::PlanarSurfaceMask m_surfaceMask;
   ActsFatras::Channelizer m_channelizer;
 
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  WriteHandle<IndexSourceLinkContainer> m_outputSourceLinks{
+      this, "OutputSourceLinks"};
+  WriteHandle<MeasurementContainer> m_outputMeasurements{this,
+                                                         "OutputMeasurements"};
+  WriteHandle<ClusterContainer> m_outputClusters{this, "OutputClusters"};
+  WriteHandle<IndexMultimap<ActsFatras::Barcode>>
+      m_outputMeasurementParticlesMap{this, "OutputMeasurementParticlesMap"};
+  WriteHandle<IndexMultimap<Index>> m_outputMeasurementSimHitsMap{
+      this, "OutputMeasurementSimHitsMap"};
+
   /// Construct a fixed-size smearer from a configuration.
   ///
   /// It's templated on the smearing dimention given by @tparam kSmearDIM
@@ -9,11 +9,19 @@
 #pragma once
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 namespace Acts {
@@ -72,6 +80,18 @@ class PlanarSteppingAlgorithm final : public BareAlgorithm {
   Config m_cfg;
   /// Lookup container for all digitizable surfaces
   std::unordered_map<Acts::GeometryIdentifier, Digitizable> m_digitizables;
+
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  WriteHandle<GeometryIdMultimap<Acts::PlanarModuleCluster>> m_outputClusters{
+      this, "OutputClusters"};
+  WriteHandle<IndexSourceLinkContainer> m_outputSourceLinks{
+      this, "OutputSourceLinks"};
+  WriteHandle<MeasurementContainer> m_outputMeasurements{this,
+                                                         "OutputMeasurements"};
+  WriteHandle<IndexMultimap<ActsFatras::Barcode>>
+      m_outputMeasurementParticlesMap{this, "OutputMeasurementParticlesMap"};
+  WriteHandle<IndexMultimap<Index>> m_outputMeasurementSimHitsMap{
+      this, "OutputMeasurementSimHitsMap"};
 };
 
 }  // namespace ActsExamples
@@ -12,7 +12,12 @@
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "ActsExamples/Digitization/DigitizationConfig.hpp"
 #include "ActsExamples/Digitization/SmearingConfig.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
 #include <memory>
@@ -53,6 +58,16 @@ class SmearingAlgorithm final : public BareAlgorithm {
   DigitizationConfig m_cfg;
   Acts::GeometryHierarchyMap<Smearer> m_smearers;
 
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  WriteHandle<IndexSourceLinkContainer> m_outputSourceLinks{
+      this, "OutputSourceLinks"};
+  WriteHandle<MeasurementContainer> m_outputMeasurements{this,
+                                                         "OutputMeasurements"};
+  WriteHandle<IndexMultimap<ActsFatras::Barcode>>
+      m_outputMeasurementParticlesMap{this, "OutputMeasurementParticlesMap"};
+  WriteHandle<IndexMultimap<Index>> m_outputMeasurementSimHitsMap{
+      this, "OutputMeasurementSimHitsMap"};
+
   /// Construct a fixed-size smearer from a configuration.
   template <size_t kSize>
   static Smearer makeSmearer(const SmearingConfig& cfg) {
@@ -105,12 +105,20 @@ ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
   }
 
   m_digitizers = Acts::GeometryHierarchyMap<Digitizer>(digitizerInput);
+
+  m_inputSimHits.initialize(m_cfg.inputSimHits);
+  m_outputSourceLinks.initialize(m_cfg.outputSourceLinks);
+  m_outputMeasurements.initialize(m_cfg.outputMeasurements);
+  m_outputClusters.initialize(m_cfg.outputClusters);
+  m_outputMeasurementParticlesMap.initialize(
+      m_cfg.outputMeasurementParticlesMap);
+  m_outputMeasurementSimHitsMap.initialize(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   // Retrieve input
-  const auto& simHits = ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimHits);
+  const auto& simHits = m_inputSimHits(ctx);
 
   // Prepare output containers
   IndexSourceLinkContainer sourceLinks;
@@ -232,13 +240,11 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
         *digitizerItr);
   }
 
-  ctx.eventStore.add(m_cfg.outputSourceLinks, std::move(sourceLinks));
-  ctx.eventStore.add(m_cfg.outputMeasurements, std::move(measurements));
-  ctx.eventStore.add(m_cfg.outputClusters, std::move(clusters));
-  ctx.eventStore.add(m_cfg.outputMeasurementParticlesMap,
-                     std::move(measurementParticlesMap));
-  ctx.eventStore.add(m_cfg.outputMeasurementSimHitsMap,
-                     std::move(measurementSimHitsMap));
+  m_outputSourceLinks(ctx, std::move(sourceLinks));
+  m_outputMeasurements(ctx, std::move(measurements));
+  m_outputClusters(ctx, std::move(clusters));
+  m_outputMeasurementParticlesMap(ctx, std::move(measurementParticlesMap));
+  m_outputMeasurementSimHitsMap(ctx, std::move(measurementSimHitsMap));
   return ProcessCode::SUCCESS;
 }
 
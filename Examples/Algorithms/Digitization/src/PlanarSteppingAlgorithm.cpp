@@ -85,6 +85,14 @@ ActsExamples::PlanarSteppingAlgorithm::PlanarSteppingAlgorithm(
     // record all valid surfaces
     this->m_digitizables.insert_or_assign(surface->geometryId(), dg);
   });
+
+  m_inputSimHits.initialize(m_cfg.inputSimHits);
+  m_outputClusters.initialize(m_cfg.outputClusters);
+  m_outputSourceLinks.initialize(m_cfg.outputSourceLinks);
+  m_outputMeasurements.initialize(m_cfg.outputMeasurements);
+  m_outputMeasurementParticlesMap.initialize(
+      m_cfg.outputMeasurementParticlesMap);
+  m_outputMeasurementSimHitsMap.initialize(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::PlanarSteppingAlgorithm::execute(
@@ -93,7 +101,7 @@ ActsExamples::ProcessCode ActsExamples::PlanarSteppingAlgorithm::execute(
       ActsExamples::GeometryIdMultimap<Acts::PlanarModuleCluster>;
 
   // retrieve input
-  const auto& simHits = ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimHits);
+  const auto& simHits = m_inputSimHits(ctx);
 
   // prepare output containers
   ClusterContainer clusters;
@@ -208,12 +216,10 @@ ActsExamples::ProcessCode ActsExamples::PlanarSteppingAlgorithm::execute(
   ACTS_DEBUG("digitized " << simHits.size() << " hits into " << clusters.size()
                           << " clusters");
 
-  ctx.eventStore.add(m_cfg.outputClusters, std::move(clusters));
-  ctx.eventStore.add(m_cfg.outputSourceLinks, std::move(sourceLinks));
-  ctx.eventStore.add(m_cfg.outputMeasurements, std::move(measurements));
-  ctx.eventStore.add(m_cfg.outputMeasurementParticlesMap,
-                     std::move(hitParticlesMap));
-  ctx.eventStore.add(m_cfg.outputMeasurementSimHitsMap,
-                     std::move(hitSimHitsMap));
+  m_outputClusters(ctx, std::move(clusters));
+  m_outputSourceLinks(ctx, std::move(sourceLinks));
+  m_outputMeasurements(ctx, std::move(measurements));
+  m_outputMeasurementParticlesMap(ctx, std::move(hitParticlesMap));
+  m_outputMeasurementSimHitsMap(ctx, std::move(hitSimHitsMap));
   return ActsExamples::ProcessCode::SUCCESS;
 }
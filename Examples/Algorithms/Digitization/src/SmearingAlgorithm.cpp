@@ -93,12 +93,19 @@ ActsExamples::SmearingAlgorithm::SmearingAlgorithm(DigitizationConfig cfg,
     }
   }
   m_smearers = Acts::GeometryHierarchyMap<Smearer>(std::move(smearersInput));
+
+  m_inputSimHits.initialize(m_cfg.inputSimHits);
+  m_outputSourceLinks.initialize(m_cfg.outputSourceLinks);
+  m_outputMeasurements.initialize(m_cfg.outputMeasurements);
+  m_outputMeasurementParticlesMap.initialize(
+      m_cfg.outputMeasurementParticlesMap);
+  m_outputMeasurementSimHitsMap.initialize(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::SmearingAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   // retrieve input
-  const auto& simHits = ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimHits);
+  const auto& simHits = m_inputSimHits(ctx);
 
   // prepare output containers
   IndexSourceLinkContainer sourceLinks;
@@ -179,11 +186,9 @@ ActsExamples::ProcessCode ActsExamples::SmearingAlgorithm::execute(
         *smearerItr);
   }
 
-  ctx.eventStore.add(m_cfg.outputSourceLinks, std::move(sourceLinks));
-  ctx.eventStore.add(m_cfg.outputMeasurements, std::move(measurements));
-  ctx.eventStore.add(m_cfg.outputMeasurementParticlesMap,
-                     std::move(hitParticlesMap));
-  ctx.eventStore.add(m_cfg.outputMeasurementSimHitsMap,
-                     std::move(hitSimHitsMap));
+  m_outputSourceLinks(ctx, std::move(sourceLinks));
+  m_outputMeasurements(ctx, std::move(measurements));
+  m_outputMeasurementParticlesMap(ctx, std::move(hitParticlesMap));
+  m_outputMeasurementSimHitsMap(ctx, std::move(hitSimHitsMap));
   return ProcessCode::SUCCESS;
 }
@@ -10,13 +10,17 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 #include "ActsExamples/Utilities/OptionsFwd.hpp"
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 namespace detail {
@@ -90,6 +94,13 @@ class FatrasAlgorithm final : public BareAlgorithm {
  private:
   Config m_cfg;
   std::unique_ptr<detail::FatrasAlgorithmSimulation> m_sim;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  WriteHandle<SimParticleContainer> m_outputParticlesInitial{
+      this, "OutputParticlesInitial"};
+  WriteHandle<SimParticleContainer> m_outputParticlesFinal{
+      this, "OutputParticlesFinal"};
+  WriteHandle<SimHitContainer> m_outputSimHits{this, "OutputSimHits"};
 };
 
 }  // namespace ActsExamples
@@ -10,9 +10,13 @@
 
 #include "Acts/Seeding/SeedfinderConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
 #include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -63,10 +67,20 @@ class SeedingAlgorithm final : public BareAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final override;
 
+  /// Per-thread seed finder and space point buffer.
+  std::unique_ptr<AlgorithmScratch> makeScratch() const final override;
+
  private:
   Config m_cfg;
   Acts::SpacePointGridConfig m_gridCfg;
   Acts::SeedfinderConfig<SimSpacePoint> m_finderCfg;
+
+  // one handle per input collection; handles must not be moved
+  std::vector<std::unique_ptr<ReadHandle<SimSpacePointContainer>>>
+      m_inputSpacePoints;
+  WriteHandle<SimSeedContainer> m_outputSeeds{this, "OutputSeeds"};
+  WriteHandle<ProtoTrackContainer> m_outputProtoTracks{this,
+                                                       "OutputProtoTracks"};
 };
 
 }  // namespace ActsExamples
@@ -9,7 +9,11 @@
 #pragma once
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <memory>
 #include <string>
@@ -90,6 +94,13 @@ class SpacePointMaker final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<IndexSourceLinkContainer> m_inputSourceLinks{this,
+                                                          "InputSourceLinks"};
+  ReadHandle<MeasurementContainer> m_inputMeasurements{this,
+                                                       "InputMeasurements"};
+  WriteHandle<SimSpacePointContainer> m_outputSpacePoints{this,
+                                                          "OutputSpacePoints"};
 };
 
 }  // namespace ActsExamples
@@ -11,9 +11,12 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 
 #include <functional>
@@ -55,6 +58,9 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
     TrackFinderFunction findTracks;
     /// CKF measurement selector config
     Acts::MeasurementSelector::Config measurementSelectorCfg;
+    /// Number of seeds per task to process seeds of one event concurrently
+    /// within the shared task arena; zero to process all seeds at once.
+    size_t seedsPerTask = 0;
   };
 
   /// Constructor of the track finding algorithm
@@ -72,6 +78,15 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<MeasurementContainer> m_inputMeasurements{this,
+                                                       "InputMeasurements"};
+  ReadHandle<IndexSourceLinkContainer> m_inputSourceLinks{this,
+                                                          "InputSourceLinks"};
+  ReadHandle<TrackParametersContainer> m_inputInitialTrackParameters{
+      this, "InputInitialTrackParameters"};
+  WriteHandle<TrajectoriesContainer> m_outputTrajectories{
+      this, "OutputTrajectories"};
 };
 
 }  // namespace ActsExamples
@@ -13,9 +13,13 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 
 #include <functional>
@@ -98,6 +102,19 @@ class TrackParamsEstimationAlgorithm final : public BareAlgorithm {
  private:
   Config m_cfg;
 
+  ReadHandle<IndexSourceLinkContainer> m_inputSourceLinks{this,
+                                                          "InputSourceLinks"};
+  // only the seeds or the proto tracks and space points are used
+  ReadHandle<SimSeedContainer> m_inputSeeds{this, "InputSeeds"};
+  ReadHandle<ProtoTrackContainer> m_inputProtoTracks{this, "InputProtoTracks"};
+  // one handle per input collection; handles must not be moved
+  std::vector<std::unique_ptr<ReadHandle<SimSpacePointContainer>>>
+      m_inputSpacePoints;
+  WriteHandle<TrackParametersContainer> m_outputTrackParameters{
+      this, "OutputTrackParameters"};
+  WriteHandle<ProtoTrackContainer> m_outputProtoTracks{this,
+                                                       "OutputProtoTracks"};
+
   /// The track parameters covariance (assumed to be the same for all estimated
   /// track parameters for the moment)
   Acts::BoundSymMatrix m_covariance = Acts::BoundSymMatrix::Zero();
@@ -20,6 +20,19 @@
 
 #include <stdexcept>
 
+namespace {
+// the seed finder only depends on the configuration and can be reused;
+// the space point buffer keeps its capacity between events
+struct SeedingScratch : public ActsExamples::AlgorithmScratch {
+  Acts::Seedfinder<ActsExamples::SimSpacePoint> finder;
+  std::vector<const ActsExamples::SimSpacePoint*> spacePointPtrs;
+
+  SeedingScratch(
+      const Acts::SeedfinderConfig<ActsExamples::SimSpacePoint>& cfg)
+      : finder(cfg) {}
+};
+}  // namespace
+
 ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
     ActsExamples::SeedingAlgorithm::Config cfg, Acts::Logging::Level lvl)
     : ActsExamples::BareAlgorithm("SeedingAlgorithm", lvl),
@@ -68,6 +81,15 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
   m_finderCfg.bFieldInZ = m_cfg.bFieldInZ;
   m_finderCfg.beamPos = Acts::Vector2(m_cfg.beamPosX, m_cfg.beamPosY);
   m_finderCfg.impactMax = m_cfg.impactMax;
+
+  for (const auto& isp : m_cfg.inputSpacePoints) {
+    auto& handle = m_inputSpacePoints.emplace_back(
+        std::make_unique<ReadHandle<SimSpacePointContainer>>(
+            this, "InputSpacePoints"));
+    handle->initialize(isp);
+  }
+  m_outputSeeds.initialize(m_cfg.outputSeeds);
+  m_outputProtoTracks.initialize(m_cfg.outputProtoTracks);
 }
 
 ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
@@ -76,14 +98,15 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
   // configured input sources.
   // pre-compute the total size required so we only need to allocate once
   size_t nSpacePoints = 0;
-  for (const auto& isp : m_cfg.inputSpacePoints) {
-    nSpacePoints += ctx.eventStore.get<SimSpacePointContainer>(isp).size();
+  for (const auto& isp : m_inputSpacePoints) {
+    nSpacePoints += (*isp)(ctx).size();
   }
-  std::vector<const SimSpacePoint*> spacePointPtrs;
+  auto& scratch = BareAlgorithm::scratch<SeedingScratch>(ctx);
+  auto& spacePointPtrs = scratch.spacePointPtrs;
+  spacePointPtrs.clear();
   spacePointPtrs.reserve(nSpacePoints);
-  for (const auto& isp : m_cfg.inputSpacePoints) {
-    for (const auto& spacePoint :
-         ctx.eventStore.get<SimSpacePointContainer>(isp)) {
+  for (const auto& isp : m_inputSpacePoints) {
+    for (const auto& spacePoint : (*isp)(ctx)) {
       // since the event store owns the space points, their pointers should be
       // stable and we do not need to create local copies.
       spacePointPtrs.push_back(&spacePoint);
@@ -104,10 +127,10 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
   auto spacePointsGrouping = Acts::BinnedSPGroup<SimSpacePoint>(
       spacePointPtrs.begin(), spacePointPtrs.end(), extractCovariance,
       bottomBinFinder, topBinFinder, std::move(grid), m_finderCfg);
-  auto finder = Acts::Seedfinder<SimSpacePoint>(m_finderCfg);
+  const auto& finder = scratch.finder;
 
-  // run the seeding
-  SimSeedContainer seeds;
+  // run the seeding; the seeds live as long as the event
+  SimSeedContainer seeds(ctx.eventMemory);
   auto group = spacePointsGrouping.begin();
   auto groupEnd = spacePointsGrouping.end();
   for (; !(group == groupEnd); ++group) {
@@ -129,10 +152,18 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
     protoTracks.push_back(std::move(protoTrack));
   }
 
+  // the buffer must not keep pointers into this event store
+  spacePointPtrs.clear();
+
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
-                        << spacePointPtrs.size() << " space points");
+                        << nSpacePoints << " space points");
 
-  ctx.eventStore.add(m_cfg.outputSeeds, std::move(seeds));
-  ctx.eventStore.add(m_cfg.outputProtoTracks, std::move(protoTracks));
+  m_outputSeeds(ctx, std::move(seeds));
+  m_outputProtoTracks(ctx, std::move(protoTracks));
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+std::unique_ptr<ActsExamples::AlgorithmScratch>
+ActsExamples::SeedingAlgorithm::makeScratch() const {
+  return std::make_unique<SeedingScratch>(m_finderCfg);
+}
@@ -81,14 +81,16 @@ ActsExamples::SpacePointMaker::SpacePointMaker(Config cfg,
   for (const auto& geoId : m_cfg.geometrySelection) {
     ACTS_INFO("  " << geoId);
   }
+
+  m_inputSourceLinks.initialize(m_cfg.inputSourceLinks);
+  m_inputMeasurements.initialize(m_cfg.inputMeasurements);
+  m_outputSpacePoints.initialize(m_cfg.outputSpacePoints);
 }
 
 ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
     const AlgorithmContext& ctx) const {
-  const auto& sourceLinks =
-      ctx.eventStore.get<IndexSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto& measurements =
-      ctx.eventStore.get<MeasurementContainer>(m_cfg.inputMeasurements);
+  const auto& sourceLinks = m_inputSourceLinks(ctx);
+  const auto& measurements = m_inputMeasurements(ctx);
 
   SimSpacePointContainer spacePoints;
   spacePoints.reserve(sourceLinks.size());
@@ -171,7 +173,7 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
   spacePoints.shrink_to_fit();
 
   ACTS_DEBUG("Created " << spacePoints.size() << " space points");
-  ctx.eventStore.add(m_cfg.outputSpacePoints, std::move(spacePoints));
+  m_outputSpacePoints(ctx, std::move(spacePoints));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -13,8 +13,12 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
+#include <tbb/parallel_for.h>
+
 ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
     Config cfg, Acts::Logging::Level level)
     : ActsExamples::BareAlgorithm("TrackFindingAlgorithm", level),
@@ -32,17 +36,19 @@ ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing trajectories output collection");
   }
+
+  m_inputMeasurements.initialize(m_cfg.inputMeasurements);
+  m_inputSourceLinks.initialize(m_cfg.inputSourceLinks);
+  m_inputInitialTrackParameters.initialize(m_cfg.inputInitialTrackParameters);
+  m_outputTrajectories.initialize(m_cfg.outputTrajectories);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
   // Read input data
-  const auto& measurements =
-      ctx.eventStore.get<MeasurementContainer>(m_cfg.inputMeasurements);
-  const auto& sourceLinks =
-      ctx.eventStore.get<IndexSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto& initialParameters = ctx.eventStore.get<TrackParametersContainer>(
-      m_cfg.inputInitialTrackParameters);
+  const auto& measurements = m_inputMeasurements(ctx);
+  const auto& sourceLinks = m_inputSourceLinks(ctx);
+  const auto& initialParameters = m_inputInitialTrackParameters(ctx);
 
   // Prepare the output data with MultiTrajectory
   TrajectoriesContainer trajectories;
@@ -65,7 +71,35 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   // Perform the track finding for all initial parameters
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
-  auto results = m_cfg.findTracks(sourceLinks, initialParameters, options);
+  TrackFinderResult results;
+  size_t numSeeds = initialParameters.size();
+  if ((0u < m_cfg.seedsPerTask) and (m_cfg.seedsPerTask < numSeeds)) {
+    // Split the seeds into chunks that can be picked up by idle threads
+    size_t numChunks = (numSeeds + m_cfg.seedsPerTask - 1) / m_cfg.seedsPerTask;
+    std::vector<TrackFinderResult> chunkResults(numChunks);
+    auto findChunk = [&](size_t ichunk) {
+      auto begin = initialParameters.begin() + ichunk * m_cfg.seedsPerTask;
+      auto end = initialParameters.begin() +
+                 std::min((ichunk + 1) * m_cfg.seedsPerTask, numSeeds);
+      TrackParametersContainer chunkParameters(begin, end);
+      chunkResults[ichunk] =
+          m_cfg.findTracks(sourceLinks, chunkParameters, options);
+    };
+    auto findChunks = [&]() {
+      tbb::parallel_for(size_t(0), numChunks, findChunk);
+    };
+    if (ctx.taskArena != nullptr) {
+      ctx.taskArena->execute(findChunks);
+    } else {
+      findChunks();
+    }
+    results.reserve(numSeeds);
+    for (auto& chunk : chunkResults) {
+      std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+    }
+  } else {
+    results = m_cfg.findTracks(sourceLinks, initialParameters, options);
+  }
   // Loop over the track finding results for all initial parameters
   for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
     // The result for this seed
@@ -86,6 +120,6 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
+  m_outputTrajectories(ctx, std::move(trajectories));
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -24,6 +24,9 @@ void ActsExamples::Options::addTrackFindingOptions(
   opt("ckf-selection-nmax", value<size_t>()->default_value(10),
       "Global criteria of maximum number of measurement candidates on a "
       "surface for CKF measurement selection");
+  opt("ckf-seeds-per-task", value<size_t>()->default_value(0),
+      "Number of seeds processed per task to run the track finding of one "
+      "event concurrently, 0 to process all seeds at once");
 }
 
 ActsExamples::TrackFindingAlgorithm::Config
@@ -31,11 +34,13 @@ ActsExamples::Options::readTrackFindingConfig(
     const ActsExamples::Options::Variables& variables) {
   auto chi2Max = variables["ckf-selection-chi2max"].template as<double>();
   auto nMax = variables["ckf-selection-nmax"].template as<size_t>();
+  auto seedsPerTask = variables["ckf-seeds-per-task"].template as<size_t>();
 
   // config is a GeometryHierarchyMap with just the global default
   TrackFindingAlgorithm::Config cfg;
   cfg.measurementSelectorCfg = {
       {Acts::GeometryIdentifier(), {chi2Max, nMax}},
   };
+  cfg.seedsPerTask = seedsPerTask;
   return cfg;
 }
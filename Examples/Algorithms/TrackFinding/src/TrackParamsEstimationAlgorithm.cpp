@@ -62,6 +62,21 @@ ActsExamples::TrackParamsEstimationAlgorithm::TrackParamsEstimationAlgorithm(
       cfg.sigmaQOverP * m_cfg.sigmaQOverP;
   m_covariance(Acts::eBoundTime, Acts::eBoundTime) =
       m_cfg.sigmaT0 * m_cfg.sigmaT0;
+
+  m_inputSourceLinks.initialize(m_cfg.inputSourceLinks);
+  if (not m_cfg.inputSeeds.empty()) {
+    m_inputSeeds.initialize(m_cfg.inputSeeds);
+  } else {
+    m_inputProtoTracks.initialize(m_cfg.inputProtoTracks);
+    for (const auto& isp : m_cfg.inputSpacePoints) {
+      auto& handle = m_inputSpacePoints.emplace_back(
+          std::make_unique<ReadHandle<SimSpacePointContainer>>(
+              this, "InputSpacePoints"));
+      handle->initialize(isp);
+    }
+  }
+  m_outputTrackParameters.initialize(m_cfg.outputTrackParameters);
+  m_outputProtoTracks.initialize(m_cfg.outputProtoTracks);
 }
 
 ActsExamples::SimSeedContainer
@@ -126,18 +141,16 @@ ActsExamples::TrackParamsEstimationAlgorithm::createSeeds(
 ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
   // Read source links (necesary for retrieving the geometry identifer)
-  const auto& sourceLinks =
-      ctx.eventStore.get<IndexSourceLinkContainer>(m_cfg.inputSourceLinks);
+  const auto& sourceLinks = m_inputSourceLinks(ctx);
   // Read seeds or create them from proto tracks and space points
   SimSeedContainer seeds;
   SimSpacePointContainer spacePoints;
   if (not m_cfg.inputSeeds.empty()) {
-    seeds = ctx.eventStore.get<SimSeedContainer>(m_cfg.inputSeeds);
+    seeds = m_inputSeeds(ctx);
   } else {
-    const auto& protoTracks =
-        ctx.eventStore.get<ProtoTrackContainer>(m_cfg.inputProtoTracks);
-    for (const auto& isp : m_cfg.inputSpacePoints) {
-      const auto& sps = ctx.eventStore.get<SimSpacePointContainer>(isp);
+    const auto& protoTracks = m_inputProtoTracks(ctx);
+    for (const auto& isp : m_inputSpacePoints) {
+      const auto& sps = (*isp)(ctx);
       std::copy(sps.begin(), sps.end(), std::back_inserter(spacePoints));
     }
     seeds = createSeeds(protoTracks, spacePoints);
@@ -189,7 +202,7 @@ ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputTrackParameters, std::move(trackParameters));
-  ctx.eventStore.add(m_cfg.outputProtoTracks, std::move(tracks));
+  m_outputTrackParameters(ctx, std::move(trackParameters));
+  m_outputProtoTracks(ctx, std::move(tracks));
   return ActsExamples::ProcessCode::SUCCESS;
 }
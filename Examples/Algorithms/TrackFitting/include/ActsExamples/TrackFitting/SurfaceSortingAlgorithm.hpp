@@ -11,8 +11,11 @@
 #include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <map>
 #include <memory>
@@ -41,6 +44,13 @@ class SurfaceSortingAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<ProtoTrackContainer> m_inputProtoTracks{this, "InputProtoTracks"};
+  ReadHandle<SimHitContainer> m_inputSimulatedHits{this, "InputSimulatedHits"};
+  ReadHandle<IndexMultimap<Index>> m_inputMeasurementSimHitsMap{
+      this, "InputMeasurementSimHitsMap"};
+  WriteHandle<ProtoTrackContainer> m_outputProtoTracks{this,
+                                                       "OutputProtoTracks"};
 };
 
 }  // namespace ActsExamples
@@ -12,8 +12,11 @@
 #include "Acts/TrackFitting/KalmanFitter.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 
 #include <functional>
@@ -97,6 +100,16 @@ class TrackFittingAlgorithm final : public BareAlgorithm {
       const std::vector<const Acts::Surface*>& surfSequence) const;
 
   Config m_cfg;
+
+  ReadHandle<MeasurementContainer> m_inputMeasurements{this,
+                                                       "InputMeasurements"};
+  ReadHandle<IndexSourceLinkContainer> m_inputSourceLinks{this,
+                                                          "InputSourceLinks"};
+  ReadHandle<ProtoTrackContainer> m_inputProtoTracks{this, "InputProtoTracks"};
+  ReadHandle<TrackParametersContainer> m_inputInitialTrackParameters{
+      this, "InputInitialTrackParameters"};
+  WriteHandle<TrajectoriesContainer> m_outputTrajectories{
+      this, "OutputTrajectories"};
 };
 
 inline ActsExamples::TrackFittingAlgorithm::TrackFitterResult
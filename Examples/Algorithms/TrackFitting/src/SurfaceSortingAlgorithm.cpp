@@ -28,18 +28,18 @@ ActsExamples::SurfaceSortingAlgorithm::SurfaceSortingAlgorithm(
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing output proto track collection");
   }
+
+  m_inputProtoTracks.initialize(m_cfg.inputProtoTracks);
+  m_inputSimulatedHits.initialize(m_cfg.inputSimulatedHits);
+  m_inputMeasurementSimHitsMap.initialize(m_cfg.inputMeasurementSimHitsMap);
+  m_outputProtoTracks.initialize(m_cfg.outputProtoTracks);
 }
 
 ActsExamples::ProcessCode ActsExamples::SurfaceSortingAlgorithm::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
-  using HitSimHitsMap = IndexMultimap<Index>;
-
-  const auto& protoTracks =
-      ctx.eventStore.get<ProtoTrackContainer>(m_cfg.inputProtoTracks);
-  const auto& simHits =
-      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
-  const auto& simHitsMap =
-      ctx.eventStore.get<HitSimHitsMap>(m_cfg.inputMeasurementSimHitsMap);
+  const auto& protoTracks = m_inputProtoTracks(ctx);
+  const auto& simHits = m_inputSimulatedHits(ctx);
+  const auto& simHitsMap = m_inputMeasurementSimHitsMap(ctx);
 
   ProtoTrackContainer sortedTracks;
   sortedTracks.reserve(protoTracks.size());
@@ -71,7 +71,7 @@ ActsExamples::ProcessCode ActsExamples::SurfaceSortingAlgorithm::execute(
     sortedTracks.emplace_back(std::move(sortedProtoTrack));
   }
 
-  ctx.eventStore.add(m_cfg.outputProtoTracks, std::move(sortedTracks));
+  m_outputProtoTracks(ctx, std::move(sortedTracks));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
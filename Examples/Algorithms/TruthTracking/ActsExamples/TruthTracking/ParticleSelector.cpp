@@ -97,6 +97,9 @@ ActsExamples::ParticleSelector::ParticleSelector(const Config& cfg,
                                        << ")");
   ACTS_DEBUG("remove charged particles " << m_cfg.removeCharged);
   ACTS_DEBUG("remove neutral particles " << m_cfg.removeNeutral);
+
+  m_inputParticles.initialize(m_cfg.inputParticles);
+  m_outputParticles.initialize(m_cfg.outputParticles);
 }
 
 ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
@@ -125,8 +128,7 @@ ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
   };
 
   // prepare input/ output types
-  const auto& inputParticles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& inputParticles = m_inputParticles(ctx);
   SimParticleContainer outputParticles;
   outputParticles.reserve(inputParticles.size());
 
@@ -143,6 +145,6 @@ ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
                       << outputParticles.size() << " from "
                       << inputParticles.size() << " particles");
 
-  ctx.eventStore.add(m_cfg.outputParticles, std::move(outputParticles));
+  m_outputParticles(ctx, std::move(outputParticles));
   return ProcessCode::SUCCESS;
 }
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Utilities/OptionsFwd.hpp"
 
 #include <limits>
@@ -63,6 +65,9 @@ class ParticleSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  WriteHandle<SimParticleContainer> m_outputParticles{this, "OutputParticles"};
 };
 
 }  // namespace ActsExamples
@@ -9,11 +9,15 @@
 #pragma once
 
 #include "Acts/Definitions/Units.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -58,6 +62,10 @@ class ParticleSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  WriteHandle<TrackParametersContainer> m_outputTrackParameters{
+      this, "OutputTrackParameters"};
 };
 
 }  // namespace ActsExamples
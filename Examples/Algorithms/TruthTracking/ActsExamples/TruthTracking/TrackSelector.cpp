@@ -28,6 +28,10 @@ ActsExamples::TrackSelector::TrackSelector(const Config& cfg,
   if (m_cfg.outputTrackIndices.empty()) {
     throw std::invalid_argument("Missing output track indices collection");
   }
+
+  m_inputTrackParameters.initialize(m_cfg.inputTrackParameters);
+  m_outputTrackParameters.initialize(m_cfg.outputTrackParameters);
+  m_outputTrackIndices.initialize(m_cfg.outputTrackIndices);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackSelector::execute(
@@ -58,8 +62,7 @@ ActsExamples::ProcessCode ActsExamples::TrackSelector::execute(
   };
 
   // prepare input and output containers
-  const auto& inputTrackParameters =
-      ctx.eventStore.get<TrackParametersContainer>(m_cfg.inputTrackParameters);
+  const auto& inputTrackParameters = m_inputTrackParameters(ctx);
   TrackParametersContainer outputTrackParameters;
   std::vector<uint32_t> outputTrackIndices;
   outputTrackParameters.reserve(inputTrackParameters.size());
@@ -80,8 +83,7 @@ ActsExamples::ProcessCode ActsExamples::TrackSelector::execute(
                       << outputTrackParameters.size() << " from "
                       << inputTrackParameters.size() << " tracks");
 
-  ctx.eventStore.add(m_cfg.outputTrackParameters,
-                     std::move(outputTrackParameters));
-  ctx.eventStore.add(m_cfg.outputTrackIndices, std::move(outputTrackIndices));
+  m_outputTrackParameters(ctx, std::move(outputTrackParameters));
+  m_outputTrackIndices(ctx, std::move(outputTrackIndices));
   return ProcessCode::SUCCESS;
 }
@@ -8,10 +8,14 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
+#include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -57,6 +61,13 @@ class TrackSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<TrackParametersContainer> m_inputTrackParameters{
+      this, "InputTrackParameters"};
+  WriteHandle<TrackParametersContainer> m_outputTrackParameters{
+      this, "OutputTrackParameters"};
+  WriteHandle<std::vector<uint32_t>> m_outputTrackIndices{this,
+                                                          "OutputTrackIndices"};
 };
 
 }  // namespace ActsExamples
@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 namespace ActsExamples {
 
@@ -61,6 +64,11 @@ class TruthSeedSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
+  WriteHandle<SimParticleContainer> m_outputParticles{this, "OutputParticles"};
 };
 
 }  // namespace ActsExamples
@@ -31,16 +31,16 @@ TruthTrackFinder::TruthTrackFinder(const Config& cfg, Acts::Logging::Level lvl)
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing output proto tracks collection");
   }
+
+  m_inputParticles.initialize(m_cfg.inputParticles);
+  m_inputMeasurementParticlesMap.initialize(m_cfg.inputMeasurementParticlesMap);
+  m_outputProtoTracks.initialize(m_cfg.outputProtoTracks);
 }
 
 ProcessCode TruthTrackFinder::execute(const AlgorithmContext& ctx) const {
-  using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
-
   // prepare input collections
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputMeasurementParticlesMap);
+  const auto& particles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
   // compute particle_id -> {hit_id...} map from the
   // hit_id -> {particle_id...} map on the fly.
   const auto& particleHitsMap = invertIndexMultimap(hitParticlesMap);
@@ -64,6 +64,6 @@ ProcessCode TruthTrackFinder::execute(const AlgorithmContext& ctx) const {
     tracks.emplace_back(std::move(track));
   }
 
-  ctx.eventStore.add(m_cfg.outputProtoTracks, std::move(tracks));
+  m_outputProtoTracks(ctx, std::move(tracks));
   return ProcessCode::SUCCESS;
 }
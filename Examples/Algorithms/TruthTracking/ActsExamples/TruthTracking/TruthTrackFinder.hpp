@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 namespace ActsExamples {
 
@@ -36,6 +40,12 @@ class TruthTrackFinder final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
+  WriteHandle<ProtoTrackContainer> m_outputProtoTracks{this,
+                                                       "OutputProtoTracks"};
 };
 
 }  // namespace ActsExamples
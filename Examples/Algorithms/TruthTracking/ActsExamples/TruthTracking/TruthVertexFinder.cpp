@@ -26,13 +26,15 @@ ActsExamples::TruthVertexFinder::TruthVertexFinder(const Config& cfg,
   if (m_cfg.outputProtoVertices.empty()) {
     throw std::invalid_argument("Missing output proto vertices collection");
   }
+
+  m_inputParticles.initialize(m_cfg.inputParticles);
+  m_outputProtoVertices.initialize(m_cfg.outputProtoVertices);
 }
 
 ActsExamples::ProcessCode ActsExamples::TruthVertexFinder::execute(
     const AlgorithmContext& ctx) const {
   // prepare input and output collections
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
   ProtoVertexContainer protoVertices;
 
   // assumes the begin/end iterator references the particles container
@@ -71,6 +73,6 @@ ActsExamples::ProcessCode ActsExamples::TruthVertexFinder::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputProtoVertices, std::move(protoVertices));
+  m_outputProtoVertices(ctx, std::move(protoVertices));
   return ProcessCode::SUCCESS;
 }
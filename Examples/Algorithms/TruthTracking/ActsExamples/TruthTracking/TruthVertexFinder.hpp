@@ -8,9 +8,13 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/ProtoVertex.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -34,6 +38,10 @@ class TruthVertexFinder final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  WriteHandle<ProtoVertexContainer> m_outputProtoVertices{
+      this, "OutputProtoVertices"};
 };
 
 }  // namespace ActsExamples
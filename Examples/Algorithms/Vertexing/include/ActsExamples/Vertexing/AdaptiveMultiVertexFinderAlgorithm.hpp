@@ -10,9 +10,13 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "ActsExamples/EventData/ProtoVertex.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -40,6 +44,11 @@ class AdaptiveMultiVertexFinderAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<TrackParametersContainer> m_inputTrackParameters{
+      this, "InputTrackParameters"};
+  WriteHandle<ProtoVertexContainer> m_outputProtoVertices{
+      this, "OutputProtoVertices"};
 };
 
 }  // namespace ActsExamples
@@ -11,9 +11,13 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "ActsExamples/EventData/ProtoVertex.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -49,6 +53,11 @@ class VertexFitterAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadHandle<TrackParametersContainer> m_inputTrackParameters{
+      this, "InputTrackParameters"};
+  ReadHandle<ProtoVertexContainer> m_inputProtoVertices{this,
+                                                       "InputProtoVertices"};
 };
 
 }  // namespace ActsExamples
@@ -34,6 +34,8 @@ ActsExamples::VertexFitterAlgorithm::VertexFitterAlgorithm(
   if (m_cfg.inputProtoVertices.empty()) {
     throw std::invalid_argument("Missing input proto vertices collection");
   }
+  m_inputTrackParameters.initialize(m_cfg.inputTrackParameters);
+  m_inputProtoVertices.initialize(m_cfg.inputProtoVertices);
 }
 
 ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
@@ -61,10 +63,8 @@ ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
   Linearizer::Config ltConfig(m_cfg.bField, propagator);
   Linearizer linearizer(ltConfig);
 
-  const auto& trackParameters =
-      ctx.eventStore.get<TrackParametersContainer>(m_cfg.inputTrackParameters);
-  const auto& protoVertices =
-      ctx.eventStore.get<ProtoVertexContainer>(m_cfg.inputProtoVertices);
+  const auto& trackParameters = m_inputTrackParameters(ctx);
+  const auto& protoVertices = m_inputProtoVertices(ctx);
   std::vector<const Acts::BoundTrackParameters*> inputTrackPtrCollection;
 
   for (const auto& protoVertex : protoVertices) {
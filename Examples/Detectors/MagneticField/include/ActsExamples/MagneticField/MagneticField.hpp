@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BFieldMapFile.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
@@ -33,6 +34,11 @@ using InterpolatedMagneticFieldMapper3 =
 using InterpolatedMagneticField3 =
     Acts::InterpolatedBFieldMap<InterpolatedMagneticFieldMapper3>;
 
+using MappedMagneticField2 =
+    Acts::InterpolatedBFieldMap<Acts::MappedBFieldMapperRZ>;
+using MappedMagneticField3 =
+    Acts::InterpolatedBFieldMap<Acts::MappedBFieldMapperXYZ>;
+
 }  // namespace detail
 
 }  // namespace ActsExamples
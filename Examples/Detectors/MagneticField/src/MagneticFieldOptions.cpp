@@ -9,6 +9,7 @@
 #include "ActsExamples/MagneticField/MagneticFieldOptions.hpp"
 
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapFile.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
@@ -45,8 +46,10 @@ void ActsExamples::Options::addMagneticFieldOptions(Description& desc) {
       "Scaling factor for the event-dependent field strength scaling. A unit "
       "value means that the field strength stays the same for every event.");
   opt("bf-map-file", value<std::string>(),
-      "Read a magnetic field map from the given file. ROOT and text file "
-      "formats are supported. Only used if no constant field is given.");
+      "Read a magnetic field map from the given file. ROOT, text, and binary "
+      "'.bfm' file formats are supported. Binary files are memory-mapped and "
+      "define their type and units themselves. Only used if no constant "
+      "field is given.");
   opt("bf-map-tree", value<std::string>()->default_value("bField"),
       "Name of the TTree in the ROOT file. Only used if the field map is read "
       "from a ROOT file.");
@@ -113,7 +116,21 @@ ActsExamples::Options::readMagneticField(const Variables& vars) {
         vars["bf-map-fieldscale-tesla"].as<double>() * Acts::UnitConstants::T;
 
     bool readRoot = false;
-    if (file.extension() == ".root") {
+    if (file.extension() == ".bfm") {
+      ACTS_INFO("Map magnetic field map from binary file '" << file << "'");
+      auto mapped = std::make_shared<const Acts::BFieldMapFile>(file.native());
+      if (mapped->type() == Acts::BFieldMapFile::Type::XYZ) {
+        ACTS_INFO("Use XYZ field map");
+        MappedMagneticField3::Config cfg(
+            Acts::mappedFieldMapperXYZ(std::move(mapped)));
+        return std::make_shared<MappedMagneticField3>(std::move(cfg));
+      } else {
+        ACTS_INFO("Use RZ field map");
+        MappedMagneticField2::Config cfg(
+            Acts::mappedFieldMapperRZ(std::move(mapped)));
+        return std::make_shared<MappedMagneticField2>(std::move(cfg));
+      }
+    } else if (file.extension() == ".root") {
       ACTS_INFO("Read magnetic field map from ROOT file '" << file << "'");
       readRoot = true;
     } else if (file.extension() == ".txt") {
@@ -12,10 +12,13 @@
 #include "ActsExamples/EventData/SimSpacePoint.hpp"
 
 #include <map>
+#include <memory_resource>
 #include <vector>
 
 namespace ActsExamples {
 /// Container of sim seed
-using SimSeedContainer = std::vector<Acts::Seed<SimSpacePoint>>;
+///
+/// Seeds are usually allocated from the per-event memory arena.
+using SimSeedContainer = std::pmr::vector<Acts::Seed<SimSpacePoint>>;
 
 }  // namespace ActsExamples
@@ -13,9 +13,13 @@
 #include <Acts/Utilities/CalibrationContext.hpp>
 
 #include <memory>
+#include <memory_resource>
+
+#include <tbb/task_arena.h>
 
 namespace ActsExamples {
 
+class AlgorithmScratch;
 class WhiteBoard;
 
 /// Aggregated information to run one algorithm over one event.
@@ -25,11 +29,25 @@ struct AlgorithmContext {
   /// @param alg is the algorithm/service/writer number
   /// @param event ist the event number
   /// @param store is the event-wise event store
+  /// @param memory is the event-wise memory arena
+  ///
+  /// @note memory allocated from the event arena is only released when the
+  /// event is finished; objects using it must not outlive the event store
   ///
   /// @note the event dependent contexts are to be added by the
   /// Sequencer::m_decorators list
-  AlgorithmContext(size_t alg, size_t event, WhiteBoard& store)
-      : algorithmNumber(alg), eventNumber(event), eventStore(store) {}
+  ///
+  /// @note algorithms are executed within the task arena of the sequencer
+  /// and nested TBB algorithms run there automatically. Work started from
+  /// other threads, e.g. by asynchronous writers, must use
+  /// `taskArena->execute(...)` to respect the configured number of threads.
+  AlgorithmContext(
+      size_t alg, size_t event, WhiteBoard& store,
+      std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+      : algorithmNumber(alg),
+        eventNumber(event),
+        eventStore(store),
+        eventMemory(memory) {}
 
   /// @brief ++operator overload to increase the algorithm number
   AlgorithmContext& operator++() {
@@ -40,10 +58,13 @@ struct AlgorithmContext {
   size_t algorithmNumber;            ///< Unique algorithm identifier
   size_t eventNumber;                ///< Unique event identifier
   WhiteBoard& eventStore;            ///< Per-event data store
+  std::pmr::memory_resource* eventMemory;  ///< Per-event memory arena
   Acts::GeometryContext geoContext;  ///< Per-event geometry context
   Acts::MagneticFieldContext
       magFieldContext;                    ///< Per-event magnetic Field context
   Acts::CalibrationContext calibContext;  ///< Per-event calbiration context
+  tbb::task_arena* taskArena = nullptr;   ///< Shared arena for nested tasks
+  AlgorithmScratch* scratch = nullptr;    ///< Per-thread algorithm state
 };
 
 }  // namespace ActsExamples
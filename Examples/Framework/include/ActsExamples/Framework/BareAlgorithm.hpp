@@ -19,6 +19,7 @@
 #include <Acts/Utilities/Logger.hpp>
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace ActsExamples {
@@ -49,6 +50,21 @@ class BareAlgorithm : public IAlgorithm {
  protected:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Access the scratch state of the current execution.
+  ///
+  /// @tparam scratch_t the type created by `makeScratch`
+  /// @throws std::logic_error if the context does not provide scratch state
+  ///
+  /// The scratch state belongs to the executing thread and must not be used
+  /// from nested tasks.
+  template <typename scratch_t>
+  static scratch_t& scratch(const AlgorithmContext& context) {
+    if (context.scratch == nullptr) {
+      throw std::logic_error("Missing algorithm scratch state");
+    }
+    return static_cast<scratch_t&>(*context.scratch);
+  }
+
  private:
   std::string m_name;
   std::unique_ptr<const Acts::Logger> m_logger;
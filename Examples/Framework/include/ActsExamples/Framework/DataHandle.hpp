@@ -0,0 +1,113 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+namespace ActsExamples {
+
+/// Type-erased part of a typed event store access handle.
+///
+/// Handles are declared as members of a sequence element and register
+/// themselves with it. The event store key is set with `initialize(...)`,
+/// usually in the constructor of the owning element. Before the event loop
+/// the sequencer validates the types of all handles sharing the same key and
+/// resolves each key to a fixed event store slot so that per-event access
+/// does not require a name lookup.
+class DataHandleBase {
+ public:
+  virtual ~DataHandleBase() = default;
+
+  // handles are registered by address and must not be copied
+  DataHandleBase(const DataHandleBase&) = delete;
+  DataHandleBase& operator=(const DataHandleBase&) = delete;
+
+  /// Set the event store key; an empty key leaves the handle unused.
+  void initialize(const std::string& key) { m_key = key; }
+  /// Whether the handle has a non-empty event store key.
+  bool isInitialized() const { return not m_key.empty(); }
+
+  /// The handle name used for diagnostics.
+  const std::string& name() const { return m_name; }
+  /// The event store key.
+  const std::string& key() const { return m_key; }
+  /// The type of the object that is accessed.
+  virtual const std::type_info& typeInfo() const = 0;
+
+  /// Bind the handle to a pre-resolved event store slot.
+  ///
+  /// @param table the slot table used by the event stores
+  /// @param slot the slot index of the handle key within the table
+  ///
+  /// The slot is only used for event stores created with the same table.
+  /// For all other event stores, the access falls back to the key lookup.
+  void resolve(const WhiteBoard::SlotTable* table, size_t slot) {
+    m_slotTable = table;
+    m_slot = slot;
+  }
+
+ protected:
+  DataHandleBase(std::string name) : m_name(std::move(name)) {}
+
+  std::string m_name;
+  std::string m_key;
+  const WhiteBoard::SlotTable* m_slotTable = nullptr;
+  size_t m_slot = 0;
+};
+
+/// Typed handle to read an object from the event store.
+template <typename T>
+class ReadHandle final : public DataHandleBase {
+ public:
+  /// @param parent the owning element; the handle registers itself with it
+  /// @param name the handle name used for diagnostics
+  ReadHandle(SequenceElement* parent, std::string name)
+      : DataHandleBase(std::move(name)) {
+    parent->registerReadHandle(*this);
+  }
+
+  const std::type_info& typeInfo() const final { return typeid(T); }
+
+  /// Get the object from the event store of the given event.
+  ///
+  /// @throws std::out_of_range if the object does not exist
+  const T& operator()(const AlgorithmContext& ctx) const {
+    return ctx.eventStore.template getSlot<T>(m_slotTable, m_slot, m_key);
+  }
+};
+
+/// Typed handle to write an object to the event store.
+template <typename T>
+class WriteHandle final : public DataHandleBase {
+ public:
+  /// @param parent the owning element; the handle registers itself with it
+  /// @param name the handle name used for diagnostics
+  WriteHandle(SequenceElement* parent, std::string name)
+      : DataHandleBase(std::move(name)) {
+    parent->registerWriteHandle(*this);
+  }
+
+  const std::type_info& typeInfo() const final { return typeid(T); }
+
+  /// Store the object in the event store of the given event.
+  ///
+  /// @throws std::invalid_argument if the object already exists
+  void operator()(const AlgorithmContext& ctx, T&& object) const {
+    ctx.eventStore.template addSlot<T>(m_slotTable, m_slot, m_key,
+                                       std::move(object));
+  }
+};
+
+}  // namespace ActsExamples
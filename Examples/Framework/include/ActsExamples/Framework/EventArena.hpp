@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+
+namespace ActsExamples {
+
+/// Monotonic memory arena for the data of a single event.
+///
+/// Deallocation is a no-op and all memory is released at once when the arena
+/// is destroyed at the end of the event. This avoids contention on the global
+/// allocator for the many small, short-lived per-event allocations.
+///
+/// Allocation is thread-safe and lock-free as long as the current memory
+/// block has space left; only obtaining a new block takes a lock. Threads
+/// working on the same event therefore do not serialise on the arena.
+///
+/// Objects allocated from the arena must not outlive it.
+class EventArena final : public std::pmr::memory_resource {
+ public:
+  /// @param initialSize size of the first memory block; zero for default
+  /// @param upstream resource that provides the memory blocks
+  explicit EventArena(
+      size_t initialSize = 0,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+  ~EventArena() override;
+
+  EventArena(const EventArena&) = delete;
+  EventArena& operator=(const EventArena&) = delete;
+
+  /// Total number of bytes handed out by the arena.
+  size_t allocatedBytes() const { return m_allocatedBytes; }
+
+ private:
+  struct Block {
+    Block* previous;
+    size_t size;
+    std::atomic<size_t> used;
+
+    std::byte* data() { return reinterpret_cast<std::byte*>(this + 1); }
+  };
+
+  static constexpr size_t s_defaultBlockSize = 16 * 1024;
+
+  /// Allocate a block with at least the given usable size.
+  Block* makeBlock(size_t size, Block* previous);
+  /// Replace the current block if it still is the given one.
+  void grow(Block* current, size_t bytes, size_t alignment);
+
+  void* do_allocate(size_t bytes, size_t alignment) final;
+  void do_deallocate(void* /*p*/, size_t /*bytes*/,
+                     size_t /*alignment*/) final {}
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept final {
+    return this == &other;
+  }
+
+  std::pmr::memory_resource* m_upstream;
+  std::atomic<Block*> m_current;
+  std::atomic<size_t> m_allocatedBytes = 0;
+  std::mutex m_growMutex;
+};
+
+}  // namespace ActsExamples
+
+inline ActsExamples::EventArena::EventArena(
+    size_t initialSize, std::pmr::memory_resource* upstream)
+    : m_upstream(upstream),
+      m_current(makeBlock(0 < initialSize ? initialSize : s_defaultBlockSize,
+                          nullptr)) {}
+
+inline ActsExamples::EventArena::~EventArena() {
+  Block* block = m_current.load();
+  while (block != nullptr) {
+    Block* previous = block->previous;
+    size_t size = block->size;
+    block->~Block();
+    m_upstream->deallocate(block, sizeof(Block) + size, alignof(Block));
+    block = previous;
+  }
+}
+
+inline ActsExamples::EventArena::Block* ActsExamples::EventArena::makeBlock(
+    size_t size, Block* previous) {
+  void* memory = m_upstream->allocate(sizeof(Block) + size, alignof(Block));
+  return new (memory) Block{previous, size, {0u}};
+}
+
+inline void ActsExamples::EventArena::grow(Block* current, size_t bytes,
+                                           size_t alignment) {
+  std::lock_guard<std::mutex> lock(m_growMutex);
+  // another thread might have replaced the block in the meantime
+  if (m_current.load() != current) {
+    return;
+  }
+  size_t size = std::max(2 * current->size, bytes + alignment);
+  m_current.store(makeBlock(size, current));
+}
+
+inline void* ActsExamples::EventArena::do_allocate(size_t bytes,
+                                                   size_t alignment) {
+  while (true) {
+    Block* block = m_current.load(std::memory_order_acquire);
+    auto begin = reinterpret_cast<std::uintptr_t>(block->data());
+    size_t used = block->used.load(std::memory_order_relaxed);
+    while (true) {
+      std::uintptr_t address = begin + used;
+      std::uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+      size_t end = (aligned - begin) + bytes;
+      if (block->size < end) {
+        break;
+      }
+      if (block->used.compare_exchange_weak(used, end,
+                                            std::memory_order_relaxed)) {
+        m_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        return reinterpret_cast<void*>(aligned);
+      }
+    }
+    grow(block, bytes, alignment);
+  }
+}
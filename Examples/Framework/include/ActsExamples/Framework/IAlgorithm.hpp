@@ -10,16 +10,28 @@
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
+/// Base class for mutable per-thread state of an algorithm.
+///
+/// Holds temporary buffers, caches, or tools that are expensive to set up
+/// and can be reused by subsequent executions on the same thread.
+class AlgorithmScratch {
+ public:
+  virtual ~AlgorithmScratch() = default;
+};
+
 /// Event processing algorithm interface.
 ///
 /// An algorithm must have no internal state and can communicate to the
 /// rest of the world only by reading and writting to the event store.
-class IAlgorithm {
+class IAlgorithm : public SequenceElement {
  public:
   virtual ~IAlgorithm() = default;
 
@@ -28,6 +40,32 @@ class IAlgorithm {
 
   /// Execute the algorithm for one event.
   virtual ProcessCode execute(const AlgorithmContext& context) const = 0;
+
+  /// Names of the event store objects read by the algorithm.
+  ///
+  /// Used by the sequencer to schedule independent algorithms concurrently
+  /// within one event. An algorithm that declares neither inputs nor outputs
+  /// is always run in sequence order with respect to all other algorithms.
+  /// Defaults to the keys of the registered read handles. Only algorithms
+  /// that access the event store without data handles override it.
+  virtual std::vector<std::string> inputs() const { return readKeys(); }
+
+  /// Names of the event store objects written by the algorithm.
+  ///
+  /// Defaults to the keys of the registered write handles. Only algorithms
+  /// that access the event store without data handles override it.
+  virtual std::vector<std::string> outputs() const { return writeKeys(); }
+
+  /// Create the scratch state used by one execution at a time.
+  ///
+  /// The sequencer creates scratch objects on demand and keeps them per
+  /// thread. Each execution is given exclusive access to one of them via
+  /// `AlgorithmContext::scratch`; its content is left over from a previous
+  /// execution on the same thread and must not carry event data. Defaults to
+  /// no scratch state.
+  virtual std::unique_ptr<AlgorithmScratch> makeScratch() const {
+    return nullptr;
+  }
 };
 
 }  // namespace ActsExamples
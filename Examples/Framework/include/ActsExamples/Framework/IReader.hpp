@@ -10,6 +10,7 @@
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
 
 #include <string>
 #include <utility>
@@ -21,7 +22,7 @@ namespace ActsExamples {
 /// Read data from disk and add it to the event store. The reader can have
 /// internal state and implementations are responsible to handle concurrent
 /// calls.
-class IReader {
+class IReader : public SequenceElement {
  public:
   virtual ~IReader() = default;
 
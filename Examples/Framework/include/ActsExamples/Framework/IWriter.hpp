@@ -14,8 +14,11 @@
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <chrono>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -24,7 +27,7 @@ namespace ActsExamples {
 /// Get data from the event store and write it to disk. The writer can have
 /// internal state and implementations are responsible to handle concurrent
 /// calls.
-class IWriter {
+class IWriter : public SequenceElement {
  public:
   virtual ~IWriter() = default;
 
@@ -36,6 +39,21 @@ class IWriter {
 
   /// End the run (e.g. aggregate statistics, write down output, close files).
   virtual ProcessCode endRun() = 0;
+
+  /// Names of the event store objects read by the writer.
+  ///
+  /// Used by the sequencer to schedule writers concurrently with independent
+  /// algorithms. A writer that declares no inputs is run after all algorithms.
+  /// Defaults to the keys of the registered read handles. Only writers that
+  /// access the event store without data handles override it.
+  virtual std::vector<std::string> inputs() const { return readKeys(); }
+
+  /// Accumulated time spent waiting on locks that serialize concurrent writes.
+  ///
+  /// Only used for profiling; writers without such locks report zero.
+  virtual std::chrono::nanoseconds lockWaitTime() const {
+    return std::chrono::nanoseconds::zero();
+  }
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,47 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace ActsExamples {
+
+/// Mutex that accumulates the time spent waiting to acquire it.
+///
+/// Can be used as a drop-in replacement for `std::mutex` with the standard
+/// lock guards. An uncontended lock only costs an additional `try_lock`; the
+/// clock is only read if the mutex is already locked by another thread.
+class InstrumentedMutex {
+ public:
+  void lock() {
+    if (m_mutex.try_lock()) {
+      return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    m_mutex.lock();
+    auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    m_waitTime.fetch_add(wait.count(), std::memory_order_relaxed);
+  }
+  bool try_lock() { return m_mutex.try_lock(); }
+  void unlock() { m_mutex.unlock(); }
+
+  /// Accumulated time spent waiting in `lock()`.
+  std::chrono::nanoseconds waitTime() const {
+    return std::chrono::nanoseconds(m_waitTime.load(std::memory_order_relaxed));
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::atomic<std::chrono::nanoseconds::rep> m_waitTime = 0;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,55 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+class DataHandleBase;
+
+/// Common base for readers, algorithms, and writers.
+///
+/// Keeps track of the data handles used to access the event store. Handles
+/// register themselves on construction; see `ReadHandle` and `WriteHandle`.
+class SequenceElement {
+ public:
+  virtual ~SequenceElement() = default;
+
+  /// Register a handle that reads from the event store.
+  void registerReadHandle(DataHandleBase& handle) {
+    m_readHandles.push_back(&handle);
+  }
+  /// Register a handle that writes to the event store.
+  void registerWriteHandle(DataHandleBase& handle) {
+    m_writeHandles.push_back(&handle);
+  }
+
+  /// All registered handles that read from the event store.
+  const std::vector<DataHandleBase*>& readHandles() const {
+    return m_readHandles;
+  }
+  /// All registered handles that write to the event store.
+  const std::vector<DataHandleBase*>& writeHandles() const {
+    return m_writeHandles;
+  }
+
+ protected:
+  /// Event store keys of all initialized read handles.
+  std::vector<std::string> readKeys() const;
+  /// Event store keys of all initialized write handles.
+  std::vector<std::string> writeKeys() const;
+
+ private:
+  std::vector<DataHandleBase*> m_readHandles;
+  std::vector<DataHandleBase*> m_writeHandles;
+};
+
+}  // namespace ActsExamples
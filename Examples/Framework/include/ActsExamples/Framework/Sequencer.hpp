@@ -13,8 +13,10 @@
 #include "ActsExamples/Framework/IReader.hpp"
 #include "ActsExamples/Framework/IService.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -23,6 +25,9 @@
 
 namespace ActsExamples {
 
+class EventProfiler;
+class ScratchPool;
+
 /// A simple algorithm sequencer for event processing.
 ///
 /// This is the backbone of the framework. It reads events from file,
@@ -38,9 +43,51 @@ class Sequencer {
     /// logging level
     Acts::Logging::Level logLevel = Acts::Logging::INFO;
     /// number of parallel threads to run, negative for automatic determination
+    ///
+    /// The event processing and all nested parallelism within algorithms
+    /// share a task arena with this concurrency.
     int numThreads = -1;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// run independent algorithms and writers of one event concurrently
+    ///
+    /// The execution order within an event is derived from the inputs and
+    /// outputs declared by the algorithms and writers. Elements without
+    /// declared inputs and outputs keep their position in the sequence.
+    bool dataflowScheduling = false;
+    /// run the writers on dedicated threads decoupled from event processing
+    bool asyncWriters = false;
+    /// number of dedicated writer threads; ignored for ordered writes
+    size_t numWriterThreads = 1;
+    /// maximum number of events waiting to be written before no further
+    /// events are started
+    size_t writerQueueCapacity = 16;
+    /// write events in increasing event number order with async writers
+    bool orderedWrites = false;
+    /// initial size in bytes of the per-event memory arena, zero for default
+    size_t eventArenaSize = 0;
+    /// maximum number of events processed concurrently, zero for no limit
+    ///
+    /// If set, or with async writers, events are dispatched one at a time
+    /// instead of in chunks.
+    size_t maxEventsInFlight = 0;
+    /// resident memory in bytes above which no further events are started
+    /// while other events are still being processed, zero to disable
+    size_t maxResidentMemory = 0;
+    /// number of dedicated I/O threads that read events ahead of the
+    /// processing, zero to read events within the event processing
+    ///
+    /// Services, context decorators, and readers run on these threads. Events
+    /// are then dispatched one at a time instead of in chunks.
+    size_t numReaderThreads = 0;
+    /// maximum number of events read ahead and waiting to be processed
+    size_t prefetchEvents = 8;
+    /// record per-event timing distributions, thread utilisation, and the
+    /// time writers spend waiting on locks
+    bool profiling = false;
+    /// file for a trace of all executions in the Chrome trace event format,
+    /// relative to the output directory; empty to disable, implies profiling
+    std::string traceFile;
   };
 
   Sequencer(const Config& cfg);
@@ -95,10 +142,23 @@ class Sequencer {
   int run();
 
  private:
+  using Duration = std::chrono::high_resolution_clock::duration;
+
   /// List of all configured algorithm names.
   std::vector<std::string> listAlgorithmNames() const;
   /// Determine range of (requested) events; [SIZE_MAX, SIZE_MAX) for error.
   std::pair<size_t, size_t> determineEventsRange() const;
+  /// Validate the data handles and resolve them to event store slots.
+  ///
+  /// @return false if the handles are inconsistent
+  bool resolveDataHandles();
+  /// Build the dependency graph between algorithms and writers.
+  void buildDataflowGraph();
+  /// Run all algorithms and writers for one event following the graph.
+  void runDataflowGraph(const AlgorithmContext& context, size_t offset,
+                        std::vector<Duration>& clocks,
+                        ScratchPool& scratchPool,
+                        EventProfiler* profiler) const;
 
   Config m_cfg;
   std::vector<std::shared_ptr<IService>> m_services;
@@ -106,6 +166,12 @@ class Sequencer {
   std::vector<std::shared_ptr<IReader>> m_readers;
   std::vector<std::shared_ptr<IAlgorithm>> m_algorithms;
   std::vector<std::shared_ptr<IWriter>> m_writers;
+  /// Successors of each algorithm/writer node in the dataflow graph
+  std::vector<std::vector<size_t>> m_dataflowSuccessors;
+  /// Number of direct predecessors of each node in the dataflow graph
+  std::vector<size_t> m_dataflowPredecessors;
+  /// Event store slots of all data handle keys
+  std::shared_ptr<const WhiteBoard::SlotTable> m_slotTable;
   std::unique_ptr<const Acts::Logger> m_logger;
 
   const Acts::Logger& logger() const { return *m_logger; }
@@ -8,9 +8,13 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/EventArena.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -25,11 +29,39 @@ namespace ActsExamples {
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
-/// Its lifetime is bound to the liftime of the white board.
+/// Its lifetime is bound to the liftime of the white board. Objects can be
+/// added and retrieved concurrently from multiple threads.
+///
+/// The white board owns the per-event memory arena. The store bookkeeping is
+/// allocated from it and algorithms can use it for their own event data, see
+/// `AlgorithmContext::eventMemory`. The memory is released at once when the
+/// white board is destroyed at the end of the event. Only the store
+/// bookkeeping and the `SimSeedContainer` use the arena; the other event data
+/// containers, e.g. for sim hits, measurements and trajectories, keep the
+/// standard allocator.
+///
+/// Objects with names that are part of the slot table are stored in fixed
+/// slots instead of the name-based map. Data handles bound to the same slot
+/// table access them by index without name lookup or type comparison.
 class WhiteBoard {
  public:
-  WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
-                 Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO));
+  /// Event store slots pre-resolved by the sequencer for the data handles.
+  struct SlotTable {
+    /// Slot index for each object name
+    std::unordered_map<std::string, size_t> indices;
+    /// Expected object type for each slot
+    std::vector<const std::type_info*> types;
+  };
+
+  /// @param logger the logger instance
+  /// @param arenaSize initial size of the event memory arena; zero for default
+  /// @param slots optional slot table shared by all event stores
+  /// @param upstream resource that provides the memory of the event arena
+  WhiteBoard(
+      std::unique_ptr<const Acts::Logger> logger =
+          Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO),
+      size_t arenaSize = 0, std::shared_ptr<const SlotTable> slots = nullptr,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
 
   // A WhiteBoard holds unique elements and can not be copied
   WhiteBoard(const WhiteBoard& other) = delete;
@@ -39,7 +71,8 @@ class WhiteBoard {
   ///
   /// @param name Non-empty identifier to store it under
   /// @param object Movable reference to the transferable object
-  /// @throws std::invalid_argument on empty or duplicate name
+  /// @throws std::invalid_argument on empty or duplicate name, or if the
+  ///         type does not match the type registered in the slot table
   template <typename T>
   void add(const std::string& name, T&& object);
 
@@ -51,7 +84,17 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// The per-event memory arena.
+  ///
+  /// Objects allocated from it must not outlive the white board.
+  EventArena& arena() { return m_arena; }
+
  private:
+  template <typename T>
+  friend class ReadHandle;
+  template <typename T>
+  friend class WriteHandle;
+
   // type-erased value holder for move-constructible types
   struct IHolder {
     virtual ~IHolder() = default;
@@ -66,9 +109,35 @@ class WhiteBoard {
     HolderT(T&& v) : value(std::move(v)) {}
     const std::type_info& type() const { return typeid(T); }
   };
+  // holders are allocated from the arena; only destruct, never free
+  struct HolderDeleter {
+    void operator()(IHolder* holder) const { holder->~IHolder(); }
+  };
+  using HolderPtr = std::unique_ptr<IHolder, HolderDeleter>;
 
+  template <typename T>
+  HolderPtr makeHolder(T&& object);
+  /// Slot index for the given name or the number of slots if there is none.
+  size_t slotIndex(const std::string& name) const;
+  void addToSlot(size_t slot, const std::string& name, HolderPtr holder);
+
+  /// Store an object in a pre-resolved slot if the slot table matches.
+  template <typename T>
+  void addSlot(const SlotTable* table, size_t slot, const std::string& name,
+               T&& object);
+  /// Get an object from a pre-resolved slot if the slot table matches.
+  template <typename T>
+  const T& getSlot(const SlotTable* table, size_t slot,
+                   const std::string& name) const;
+
+  // must be declared first to be destructed after all stored objects
+  EventArena m_arena;
   std::unique_ptr<const Acts::Logger> m_logger;
-  std::unordered_map<std::string, std::unique_ptr<IHolder>> m_store;
+  std::shared_ptr<const SlotTable> m_slotTable;
+  // objects are only written once and each slot has a single producer
+  std::pmr::vector<HolderPtr> m_slots;
+  std::pmr::unordered_map<std::string, HolderPtr> m_store;
+  mutable std::shared_mutex m_storeMutex;
 
   const Acts::Logger& logger() const { return *m_logger; }
 };
@@ -76,31 +145,113 @@ class WhiteBoard {
 }  // namespace ActsExamples
 
 inline ActsExamples::WhiteBoard::WhiteBoard(
-    std::unique_ptr<const Acts::Logger> logger)
-    : m_logger(std::move(logger)) {}
+    std::unique_ptr<const Acts::Logger> logger, size_t arenaSize,
+    std::shared_ptr<const SlotTable> slots,
+    std::pmr::memory_resource* upstream)
+    : m_arena(arenaSize, upstream),
+      m_logger(std::move(logger)),
+      m_slotTable(std::move(slots)),
+      m_slots(m_slotTable ? m_slotTable->types.size() : 0u, &m_arena),
+      m_store(&m_arena) {}
+
+template <typename T>
+inline ActsExamples::WhiteBoard::HolderPtr
+ActsExamples::WhiteBoard::makeHolder(T&& object) {
+  std::pmr::polymorphic_allocator<HolderT<T>> allocator(&m_arena);
+  HolderT<T>* raw = allocator.allocate(1u);
+  return HolderPtr(new (raw) HolderT<T>(std::forward<T>(object)));
+}
+
+inline size_t ActsExamples::WhiteBoard::slotIndex(
+    const std::string& name) const {
+  if (not m_slotTable) {
+    return 0u;
+  }
+  auto it = m_slotTable->indices.find(name);
+  return (it != m_slotTable->indices.end()) ? it->second : m_slots.size();
+}
+
+inline void ActsExamples::WhiteBoard::addToSlot(size_t slot,
+                                                const std::string& name,
+                                                HolderPtr holder) {
+  if (m_slots[slot]) {
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  m_slots[slot] = std::move(holder);
+  ACTS_VERBOSE("Added object '" << name << "'");
+}
 
 template <typename T>
 inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (0 < m_store.count(name)) {
-    throw std::invalid_argument("Object '" + name + "' already exists");
+  size_t slot = slotIndex(name);
+  if (slot < m_slots.size()) {
+    if (typeid(T) != *m_slotTable->types[slot]) {
+      throw std::invalid_argument("Type missmatch for object '" + name + "'");
+    }
+    addToSlot(slot, name, makeHolder(std::forward<T>(object)));
+    return;
+  }
+  HolderPtr holder = makeHolder(std::forward<T>(object));
+  {
+    std::unique_lock<std::shared_mutex> lock(m_storeMutex);
+    if (not m_store.emplace(name, std::move(holder)).second) {
+      throw std::invalid_argument("Object '" + name + "' already exists");
+    }
   }
-  m_store.emplace(name, std::make_unique<HolderT<T>>(std::forward<T>(object)));
   ACTS_VERBOSE("Added object '" << name << "'");
 }
 
 template <typename T>
 inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
-    throw std::out_of_range("Object '" + name + "' does not exists");
+  const IHolder* holder = nullptr;
+  size_t slot = slotIndex(name);
+  if (slot < m_slots.size()) {
+    holder = m_slots[slot].get();
+    if (holder == nullptr) {
+      throw std::out_of_range("Object '" + name + "' does not exists");
+    }
+  } else {
+    std::shared_lock<std::shared_mutex> lock(m_storeMutex);
+    auto it = m_store.find(name);
+    if (it == m_store.end()) {
+      throw std::out_of_range("Object '" + name + "' does not exists");
+    }
+    holder = it->second.get();
   }
-  const IHolder* holder = it->second.get();
   if (typeid(T) != holder->type()) {
     throw std::out_of_range("Type missmatch for object '" + name + "'");
   }
   ACTS_VERBOSE("Retrieved object '" << name << "'");
   return reinterpret_cast<const HolderT<T>*>(holder)->value;
 }
+
+template <typename T>
+inline void ActsExamples::WhiteBoard::addSlot(const SlotTable* table,
+                                              size_t slot,
+                                              const std::string& name,
+                                              T&& object) {
+  // types are checked when the handles are resolved
+  if ((table != nullptr) and (table == m_slotTable.get())) {
+    addToSlot(slot, name, makeHolder(std::forward<T>(object)));
+  } else {
+    add(name, std::forward<T>(object));
+  }
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::getSlot(
+    const SlotTable* table, size_t slot, const std::string& name) const {
+  if ((table == nullptr) or (table != m_slotTable.get())) {
+    return get<T>(name);
+  }
+  // types are checked when the handles are resolved
+  const IHolder* holder = m_slots[slot].get();
+  if (holder == nullptr) {
+    throw std::out_of_range("Object '" + name + "' does not exists");
+  }
+  ACTS_VERBOSE("Retrieved object '" << name << "'");
+  return static_cast<const HolderT<T>*>(holder)->value;
+}
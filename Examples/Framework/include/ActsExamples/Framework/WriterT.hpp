@@ -12,13 +12,16 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/InstrumentedMutex.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -59,6 +62,9 @@ class WriterT : public IWriter {
   /// No-op default implementation.
   ProcessCode endRun() override;
 
+  /// Time spent waiting on the write mutex.
+  std::chrono::nanoseconds lockWaitTime() const final override;
+
  protected:
   /// Type-specific write function implementation
   /// this method is implemented in the user implementation
@@ -70,8 +76,11 @@ class WriterT : public IWriter {
 
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Mutex for implementations that must serialize concurrent writes.
+  InstrumentedMutex m_writeMutex;
+
  private:
-  std::string m_objectName;
+  ReadHandle<write_data_t> m_inputHandle{this, "InputData"};
   std::string m_writerName;
   std::unique_ptr<const Acts::Logger> m_logger;
 };
@@ -82,14 +91,14 @@ template <typename write_data_t>
 ActsExamples::WriterT<write_data_t>::WriterT(std::string objectName,
                                              std::string writerName,
                                              Acts::Logging::Level level)
-    : m_objectName(std::move(objectName)),
-      m_writerName(std::move(writerName)),
+    : m_writerName(std::move(writerName)),
       m_logger(Acts::getDefaultLogger(m_writerName, level)) {
-  if (m_objectName.empty()) {
+  if (objectName.empty()) {
     throw std::invalid_argument("Missing input collection");
   } else if (m_writerName.empty()) {
     throw std::invalid_argument("Missing writer name");
   }
+  m_inputHandle.initialize(objectName);
 }
 
 template <typename write_data_t>
@@ -102,8 +111,14 @@ inline ActsExamples::ProcessCode ActsExamples::WriterT<write_data_t>::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+template <typename write_data_t>
+inline std::chrono::nanoseconds
+ActsExamples::WriterT<write_data_t>::lockWaitTime() const {
+  return m_writeMutex.waitTime();
+}
+
 template <typename write_data_t>
 inline ActsExamples::ProcessCode ActsExamples::WriterT<write_data_t>::write(
     const AlgorithmContext& context) {
-  return writeT(context, context.eventStore.get<write_data_t>(m_objectName));
+  return writeT(context, m_inputHandle(context));
 }
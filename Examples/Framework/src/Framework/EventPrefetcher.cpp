@@ -0,0 +1,243 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "EventPrefetcher.hpp"
+
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include "EventProfiler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+ActsExamples::EventPrefetcher::EventPrefetcher(
+    const Config& cfg, const Acts::Logger& parentLogger)
+    : m_cfg(cfg),
+      m_logger(parentLogger),
+      m_nextEvent(cfg.firstEvent),
+      m_durations(cfg.services.size() + cfg.decorators.size() +
+                      cfg.readers.size(),
+                  Duration::zero()) {
+  if (not m_cfg.makeStore) {
+    throw std::invalid_argument("Missing event store factory");
+  }
+  if (m_cfg.numThreads == 0u) {
+    return;
+  }
+  m_cfg.depth = std::max<size_t>(m_cfg.depth, 1u);
+  m_slots.resize(m_cfg.depth);
+  for (size_t i = 0; i < m_slots.size(); ++i) {
+    m_slots[i].event = m_cfg.firstEvent + i;
+  }
+  ACTS_DEBUG("Starting " << m_cfg.numThreads << " I/O thread(s) to read up to "
+                         << m_cfg.depth << " events ahead");
+  for (size_t i = 0; i < m_cfg.numThreads; ++i) {
+    m_threads.emplace_back([this]() { runThread(); });
+  }
+}
+
+ActsExamples::EventPrefetcher::~EventPrefetcher() {
+  // wakes up all threads waiting for a free slot
+  {
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+    m_stop = true;
+  }
+  m_slotsCondition.notify_all();
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+std::unique_ptr<ActsExamples::EventPrefetcher::Event>
+ActsExamples::EventPrefetcher::next(size_t event,
+                                    std::vector<Duration>& clocks) {
+  if (m_slots.empty()) {
+    return read(event, clocks);
+  }
+  checkRange(event);
+  std::unique_ptr<Event> staged;
+  {
+    std::unique_lock<std::mutex> lock(m_slotsMutex);
+    Slot& eventSlot = slot(event);
+    m_slotsCondition.wait(lock, [&]() {
+      return ((eventSlot.event == event) and eventSlot.staged) or m_failed;
+    });
+    staged = take(event);
+  }
+  m_slotsCondition.notify_all();
+  return staged;
+}
+
+std::unique_ptr<ActsExamples::EventPrefetcher::Event>
+ActsExamples::EventPrefetcher::tryNext(size_t event,
+                                       std::vector<Duration>& clocks) {
+  if (m_slots.empty()) {
+    return read(event, clocks);
+  }
+  checkRange(event);
+  std::unique_ptr<Event> staged;
+  {
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+    staged = take(event);
+  }
+  if (staged) {
+    m_slotsCondition.notify_all();
+  }
+  return staged;
+}
+
+bool ActsExamples::EventPrefetcher::ready(size_t event) {
+  if (m_slots.empty()) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(m_slotsMutex);
+  const Slot& eventSlot = slot(event);
+  return ((eventSlot.event == event) and eventSlot.staged) or m_failed;
+}
+
+std::unique_ptr<ActsExamples::EventPrefetcher::Event>
+ActsExamples::EventPrefetcher::take(size_t event) {
+  if (m_failed) {
+    std::rethrow_exception(m_error);
+  }
+  Slot& eventSlot = slot(event);
+  if ((eventSlot.event != event) or (not eventSlot.staged)) {
+    return nullptr;
+  }
+  // the slot is free for the event one depth ahead
+  eventSlot.event = event + m_slots.size();
+  return std::move(eventSlot.staged);
+}
+
+void ActsExamples::EventPrefetcher::checkRange(size_t event) const {
+  if ((event < m_cfg.firstEvent) or (m_cfg.lastEvent <= event)) {
+    throw std::out_of_range("Event " + std::to_string(event) +
+                            " is not in the prefetched range");
+  }
+}
+
+void ActsExamples::EventPrefetcher::finish() {
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+  m_threads.clear();
+}
+
+std::unique_ptr<ActsExamples::EventPrefetcher::Event>
+ActsExamples::EventPrefetcher::read(size_t event,
+                                    std::vector<Duration>& clocks) const {
+  using Clock = std::chrono::high_resolution_clock;
+
+  std::unique_ptr<WhiteBoard> store = m_cfg.makeStore(event);
+  WhiteBoard& eventStore = *store;
+  auto staged = std::unique_ptr<Event>(new Event{
+      std::move(store),
+      AlgorithmContext(0, event, eventStore, &eventStore.arena())});
+  AlgorithmContext& context = staged->context;
+  context.taskArena = m_cfg.taskArena;
+
+  size_t ialgo = 0;
+  auto measure = [&](auto&& execute) {
+    if (m_cfg.profiler != nullptr) {
+      m_cfg.profiler->begin();
+    }
+    auto start = Clock::now();
+    // also recorded on failure to keep the profiler nesting consistent
+    auto stop = [&]() {
+      auto end = Clock::now();
+      clocks[ialgo] += end - start;
+      if (m_cfg.profiler != nullptr) {
+        m_cfg.profiler->record(ialgo, event, start, end);
+      }
+      ++ialgo;
+    };
+    try {
+      execute();
+    } catch (...) {
+      stop();
+      throw;
+    }
+    stop();
+  };
+  // Prepare event store w/ service information
+  for (auto& service : m_cfg.services) {
+    measure([&]() { service->prepare(++context); });
+  }
+  /// Decorate the context
+  for (auto& cdr : m_cfg.decorators) {
+    measure([&]() {
+      if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to decorate event context");
+      }
+    });
+  }
+  // Read everything in
+  for (auto& rdr : m_cfg.readers) {
+    measure([&]() {
+      if (rdr->read(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to read input data");
+      }
+    });
+  }
+  return staged;
+}
+
+void ActsExamples::EventPrefetcher::runThread() {
+  std::vector<Duration> durations(m_durations.size(), Duration::zero());
+
+  while (true) {
+    size_t event = m_nextEvent++;
+    if (m_cfg.lastEvent <= event) {
+      break;
+    }
+    // wait until the event one depth before has been handed out
+    {
+      std::unique_lock<std::mutex> lock(m_slotsMutex);
+      Slot& eventSlot = slot(event);
+      m_slotsCondition.wait(lock, [&]() {
+        return (eventSlot.event == event) or m_stop or m_failed;
+      });
+      if (m_stop or m_failed) {
+        break;
+      }
+    }
+    std::unique_ptr<Event> staged;
+    try {
+      staged = read(event, durations);
+    } catch (...) {
+      ACTS_ERROR("Failed to read event " << event);
+      // all waiting and later requests fail with the first error
+      {
+        std::lock_guard<std::mutex> lock(m_slotsMutex);
+        if (not m_error) {
+          m_error = std::current_exception();
+        }
+        m_failed = true;
+      }
+      m_slotsCondition.notify_all();
+      if (m_cfg.onStaged) {
+        m_cfg.onStaged();
+      }
+      break;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_slotsMutex);
+      slot(event).staged = std::move(staged);
+    }
+    m_slotsCondition.notify_all();
+    if (m_cfg.onStaged) {
+      m_cfg.onStaged();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_durationsMutex);
+  for (size_t i = 0; i < durations.size(); ++i) {
+    m_durations[i] += durations[i];
+  }
+}
@@ -0,0 +1,163 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IContextDecorator.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/IService.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ActsExamples {
+
+class EventProfiler;
+
+/// Prepare and read events, optionally ahead of time on dedicated threads.
+///
+/// Preparing an event runs the services, the context decorators, and the
+/// readers on a new event store. Without I/O threads this happens on the
+/// calling thread when the event is requested. With I/O threads, events are
+/// read ahead in increasing event number and staged until they are requested
+/// by the event processing; reading then overlaps with the processing of
+/// previous events.
+///
+/// Staged events are kept in a ring of slots indexed by the event number.
+/// An event is only read once the event that is the configured depth before
+/// it has been handed out, so at most that many events are read ahead of the
+/// oldest event that has not been requested yet. Events are handed out by
+/// their number regardless of the order in which the reads finish, and a
+/// slow read only holds back the request for that event.
+///
+/// Tasks that share the task arena with nested parallelism must not block,
+/// since their worker might hold stolen work that the I/O threads indirectly
+/// wait for. They request events with `tryNext` and are notified through
+/// `Config::onStaged` once a missing event might be available.
+class EventPrefetcher {
+ public:
+  using Duration = std::chrono::high_resolution_clock::duration;
+
+  /// A prepared event ready to be processed.
+  struct Event {
+    std::unique_ptr<WhiteBoard> store;
+    AlgorithmContext context;
+  };
+
+  struct Config {
+    std::vector<std::shared_ptr<IService>> services;
+    std::vector<std::shared_ptr<IContextDecorator>> decorators;
+    std::vector<std::shared_ptr<IReader>> readers;
+    /// create the event store for the given event number
+    std::function<std::unique_ptr<WhiteBoard>(size_t)> makeStore;
+    /// number of I/O threads; zero to read on the requesting thread
+    size_t numThreads = 0;
+    /// maximum number of staged events waiting to be processed
+    size_t depth = 8;
+    /// events range [firstEvent, lastEvent) to read ahead
+    size_t firstEvent = 0;
+    size_t lastEvent = 0;
+    /// optional recording of every execution
+    EventProfiler* profiler = nullptr;
+    /// task arena made available to the event processing
+    tbb::task_arena* taskArena = nullptr;
+    /// called on an I/O thread after an event has been staged or has failed
+    std::function<void()> onStaged;
+  };
+
+  /// Start the I/O threads if any.
+  EventPrefetcher(const Config& cfg, const Acts::Logger& parentLogger);
+  /// Stops the I/O threads and drops all staged events.
+  ~EventPrefetcher();
+
+  EventPrefetcher(const EventPrefetcher&) = delete;
+  EventPrefetcher& operator=(const EventPrefetcher&) = delete;
+
+  /// Get an event for processing.
+  ///
+  /// @param event the requested event number
+  /// @param clocks per-element clocks to accumulate without I/O threads
+  /// @throws std::runtime_error or the first error encountered while reading
+  ///
+  /// With I/O threads, this blocks until the requested event is staged and
+  /// must not be used within tasks; see `tryNext`. Each event in the
+  /// configured range must be requested exactly once and events should be
+  /// requested in roughly increasing order, since reading ahead is limited
+  /// to the configured depth.
+  std::unique_ptr<Event> next(size_t event, std::vector<Duration>& clocks);
+
+  /// Get an event for processing if it is available.
+  ///
+  /// @return the event or nullptr if it has not been staged yet
+  /// @throws the same errors as `next`
+  ///
+  /// Never blocks on the I/O threads. Without them, the event is read on the
+  /// calling thread. An event that is not available yet must be requested
+  /// again later.
+  std::unique_ptr<Event> tryNext(size_t event, std::vector<Duration>& clocks);
+
+  /// Whether the event can be requested without waiting for the I/O threads.
+  ///
+  /// Also true if reading has failed and requests throw the error.
+  bool ready(size_t event);
+
+  /// Wait for the I/O threads to finish.
+  void finish();
+
+  /// Accumulated time spent in each element on the I/O threads.
+  ///
+  /// Elements are ordered as services, decorators, and readers.
+  const std::vector<Duration>& durations() const { return m_durations; }
+
+ private:
+  struct Slot {
+    /// the event that is staged or to be staged next in this slot
+    size_t event = 0;
+    std::unique_ptr<Event> staged;
+  };
+
+  std::unique_ptr<Event> read(size_t event,
+                              std::vector<Duration>& clocks) const;
+  /// Take the staged event or return nullptr; the lock must be held.
+  std::unique_ptr<Event> take(size_t event);
+  void checkRange(size_t event) const;
+  void runThread();
+  Slot& slot(size_t event) {
+    return m_slots[(event - m_cfg.firstEvent) % m_slots.size()];
+  }
+
+  Config m_cfg;
+  const Acts::Logger& m_logger;
+  std::atomic<size_t> m_nextEvent;
+  // staged events and their hand-over; the slots are guarded by the mutex
+  std::mutex m_slotsMutex;
+  std::condition_variable m_slotsCondition;
+  std::vector<Slot> m_slots;
+  bool m_stop = false;
+  // first read failure; the error is handed to all later requests
+  std::exception_ptr m_error;
+  std::atomic<bool> m_failed = false;
+  std::mutex m_durationsMutex;
+  std::vector<Duration> m_durations;
+  std::vector<std::thread> m_threads;
+
+  const Acts::Logger& logger() const { return m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,189 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "EventProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+#include <dfe/dfe_io_dsv.hpp>
+#include <dfe/dfe_namedtuple.hpp>
+
+namespace {
+using Seconds = std::chrono::duration<double>;
+using MicroSeconds = std::chrono::duration<double, std::micro>;
+
+double asSeconds(ActsExamples::EventProfiler::Duration duration) {
+  return std::chrono::duration_cast<Seconds>(duration).count();
+}
+
+struct DistributionInfo {
+  std::string identifier;
+  size_t n_events;
+  double time_mean_s;
+  double time_p50_s;
+  double time_p95_s;
+  double time_p99_s;
+  double time_max_s;
+  size_t event_max;
+  double time_lockwait_s;
+
+  DFE_NAMEDTUPLE(DistributionInfo, identifier, n_events, time_mean_s,
+                 time_p50_s, time_p95_s, time_p99_s, time_max_s, event_max,
+                 time_lockwait_s);
+};
+
+struct ThreadInfo {
+  size_t thread;
+  size_t n_executions;
+  double time_busy_s;
+  double utilisation;
+
+  DFE_NAMEDTUPLE(ThreadInfo, thread, n_executions, time_busy_s, utilisation);
+};
+
+// nearest-rank percentile of sorted values
+template <typename T>
+T percentile(const std::vector<T>& sorted, double fraction) {
+  size_t rank = std::ceil(fraction * sorted.size());
+  return sorted[std::clamp<size_t>(rank, 1u, sorted.size()) - 1u];
+}
+
+// names are identifiers chosen by the user and might contain anything
+std::string jsonEscape(const std::string& str) {
+  std::string escaped;
+  for (char c : str) {
+    if ((c == '"') or (c == '\\')) {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20u) {
+      escaped += ' ';
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+}  // namespace
+
+ActsExamples::EventProfiler::EventProfiler(Config cfg)
+    : m_cfg(std::move(cfg)),
+      m_start(Clock::now()),
+      m_stop(m_start),
+      m_durations(m_cfg.numEvents * m_cfg.names.size(), Duration::zero()) {}
+
+void ActsExamples::EventProfiler::begin() {
+  m_threads.local().depth += 1;
+}
+
+void ActsExamples::EventProfiler::record(size_t element, size_t event,
+                                         Timepoint start, Timepoint end) {
+  ThreadRecord& thread = m_threads.local();
+  thread.depth -= std::min<size_t>(thread.depth, 1u);
+  bool outermost = (thread.depth == 0u);
+
+  size_t ievent = event - m_cfg.firstEvent;
+  // must not throw since it is called from destructors
+  if ((m_cfg.numEvents <= ievent) or (m_cfg.names.size() <= element)) {
+    return;
+  }
+  m_durations[ievent * m_cfg.names.size() + element] = end - start;
+
+  thread.numExecutions += 1;
+  if (outermost) {
+    thread.busy += end - start;
+  }
+  if (m_cfg.trace) {
+    thread.executions.push_back({element, event, start, end});
+  }
+}
+
+void ActsExamples::EventProfiler::stop() {
+  m_stop = Clock::now();
+}
+
+void ActsExamples::EventProfiler::writeDistributions(
+    const std::vector<Duration>& lockWaits, const std::string& path) const {
+  dfe::NamedTupleTsvWriter<DistributionInfo> writer(path, 6);
+  std::vector<std::pair<Duration, size_t>> values(m_cfg.numEvents);
+  for (size_t i = 0; i < m_cfg.names.size(); ++i) {
+    Duration total = Duration::zero();
+    for (size_t ievent = 0; ievent < m_cfg.numEvents; ++ievent) {
+      Duration duration = m_durations[ievent * m_cfg.names.size() + i];
+      values[ievent] = {duration, m_cfg.firstEvent + ievent};
+      total += duration;
+    }
+    std::sort(values.begin(), values.end());
+
+    DistributionInfo info;
+    info.identifier = m_cfg.names[i];
+    info.n_events = values.size();
+    info.time_mean_s = asSeconds(total) / std::max<size_t>(values.size(), 1u);
+    info.time_p50_s = 0;
+    info.time_p95_s = 0;
+    info.time_p99_s = 0;
+    info.time_max_s = 0;
+    info.event_max = 0;
+    if (not values.empty()) {
+      info.time_p50_s = asSeconds(percentile(values, 0.50).first);
+      info.time_p95_s = asSeconds(percentile(values, 0.95).first);
+      info.time_p99_s = asSeconds(percentile(values, 0.99).first);
+      info.time_max_s = asSeconds(values.back().first);
+      info.event_max = values.back().second;
+    }
+    info.time_lockwait_s =
+        (i < lockWaits.size()) ? asSeconds(lockWaits[i]) : 0.0;
+    writer.append(info);
+  }
+}
+
+void ActsExamples::EventProfiler::writeThreads(const std::string& path) const {
+  dfe::NamedTupleTsvWriter<ThreadInfo> writer(path, 6);
+  double wall = asSeconds(m_stop - m_start);
+  size_t ithread = 0;
+  for (const auto& thread : m_threads) {
+    ThreadInfo info;
+    info.thread = ithread++;
+    info.n_executions = thread.numExecutions;
+    info.time_busy_s = asSeconds(thread.busy);
+    info.utilisation = (0 < wall) ? (info.time_busy_s / wall) : 0.0;
+    writer.append(info);
+  }
+}
+
+void ActsExamples::EventProfiler::writeTrace(const std::string& path) const {
+  std::ofstream os(path, std::ios::out | std::ios::trunc);
+  if (not os.good()) {
+    throw std::runtime_error("Could not open '" + path + "' for writing");
+  }
+  auto microSeconds = [&](Timepoint t) {
+    return std::chrono::duration_cast<MicroSeconds>(t - m_start).count();
+  };
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  size_t ithread = 0;
+  for (const auto& thread : m_threads) {
+    // thread name metadata makes the timeline easier to read
+    os << (first ? "\n" : ",\n");
+    os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ithread
+       << ",\"args\":{\"name\":\"Thread " << ithread << "\"}}";
+    first = false;
+    for (const auto& exec : thread.executions) {
+      os << ",\n{\"name\":\"" << jsonEscape(m_cfg.names[exec.element])
+         << "\",\"cat\":\"event\",\"ph\":\"X\",\"pid\":0,\"tid\":" << ithread
+         << ",\"ts\":" << microSeconds(exec.start)
+         << ",\"dur\":" << (microSeconds(exec.end) - microSeconds(exec.start))
+         << ",\"args\":{\"event\":" << exec.event << "}}";
+    }
+    ++ithread;
+  }
+  os << "\n]}\n";
+}
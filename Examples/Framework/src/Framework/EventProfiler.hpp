@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+namespace ActsExamples {
+
+/// Record the execution of every sequence element for every event.
+///
+/// Execution times are stored per event and element so that the distribution
+/// over events can be analysed, e.g. to find rare events that dominate the
+/// overall processing time. Executions are additionally accumulated per
+/// thread to compute the thread utilisation and, if requested, kept as a
+/// trace of individual executions.
+///
+/// Recording is thread-safe. Each (element, event) pair must only be recorded
+/// once which is guaranteed by the sequencer.
+class EventProfiler {
+ public:
+  using Clock = std::chrono::high_resolution_clock;
+  using Duration = Clock::duration;
+  using Timepoint = Clock::time_point;
+
+  struct Config {
+    /// names of the sequence elements that run for every event
+    std::vector<std::string> names;
+    /// first event number
+    size_t firstEvent = 0;
+    /// number of events
+    size_t numEvents = 0;
+    /// keep every execution for the trace export
+    bool trace = false;
+  };
+
+  /// Starts the clock used for the thread utilisation and the trace.
+  EventProfiler(Config cfg);
+
+  /// Mark the start of an execution on the calling thread.
+  ///
+  /// Must be followed by a `record` call for the execution on the same
+  /// thread. An execution that starts while another one is running on the
+  /// same thread, e.g. stolen work within a nested parallel algorithm, does
+  /// not add to the busy time of the thread a second time.
+  void begin();
+
+  /// Record a single execution.
+  ///
+  /// Executions outside the configured events or elements are ignored.
+  ///
+  /// @param element the sequence element index
+  /// @param event the event number
+  /// @param start the start time of the execution
+  /// @param end the end time of the execution
+  void record(size_t element, size_t event, Timepoint start, Timepoint end);
+
+  /// Stop the clock used for the thread utilisation.
+  void stop();
+
+  /// Write the per-element distribution of per-event execution times.
+  ///
+  /// @param lockWaits additional time waiting on locks for each element
+  /// @param path output file path
+  void writeDistributions(const std::vector<Duration>& lockWaits,
+                          const std::string& path) const;
+  /// Write the busy time and utilisation of each thread.
+  void writeThreads(const std::string& path) const;
+  /// Write all executions in the Chrome/Perfetto trace event format.
+  void writeTrace(const std::string& path) const;
+
+ private:
+  struct Execution {
+    size_t element;
+    size_t event;
+    Timepoint start;
+    Timepoint end;
+  };
+  struct ThreadRecord {
+    std::thread::id id = std::this_thread::get_id();
+    size_t numExecutions = 0;
+    // number of executions currently running on the thread
+    size_t depth = 0;
+    // only counts the outermost executions so intervals do not overlap
+    Duration busy = Duration::zero();
+    std::vector<Execution> executions;
+  };
+
+  Config m_cfg;
+  Timepoint m_start;
+  Timepoint m_stop;
+  // execution times indexed by event and then by element
+  std::vector<Duration> m_durations;
+  tbb::enumerable_thread_specific<ThreadRecord> m_threads;
+};
+
+}  // namespace ActsExamples
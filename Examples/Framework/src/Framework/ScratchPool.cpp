@@ -0,0 +1,35 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ScratchPool.hpp"
+
+ActsExamples::ScratchPool::ScratchPool(
+    const std::vector<std::shared_ptr<IAlgorithm>>& algorithms)
+    : m_algorithms(algorithms),
+      m_stateless(algorithms.size()),
+      m_free([n = algorithms.size()]() { return FreeLists(n); }) {}
+
+ActsExamples::ScratchPool::Lease ActsExamples::ScratchPool::acquire(
+    size_t ialgorithm) {
+  if (m_stateless[ialgorithm]) {
+    return Lease();
+  }
+  auto& free = m_free.local()[ialgorithm];
+  if (free.empty()) {
+    auto scratch = m_algorithms[ialgorithm]->makeScratch();
+    if (not scratch) {
+      m_stateless[ialgorithm] = true;
+      return Lease();
+    }
+    m_numCreated += 1;
+    return Lease(&free, std::move(scratch));
+  }
+  auto scratch = std::move(free.back());
+  free.pop_back();
+  return Lease(&free, std::move(scratch));
+}
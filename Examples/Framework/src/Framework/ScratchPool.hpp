@@ -0,0 +1,75 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+namespace ActsExamples {
+
+/// Per-thread pools of algorithm scratch state that is reused across events.
+///
+/// Scratch objects are created on first use by the executing thread. They are
+/// checked out for the duration of a single algorithm execution and returned
+/// to the pool of the executing thread afterwards. A thread that picks up
+/// another event while it waits within a nested parallel algorithm finds its
+/// scratch object checked out and creates an additional one; the number of
+/// objects is thus bounded by the number of threads times the nesting depth.
+class ScratchPool {
+ public:
+  /// A checked out scratch object that is returned when going out of scope.
+  class Lease {
+   public:
+    Lease() = default;
+    Lease(std::vector<std::unique_ptr<AlgorithmScratch>>* free,
+          std::unique_ptr<AlgorithmScratch> scratch)
+        : m_free(free), m_scratch(std::move(scratch)) {}
+    Lease(Lease&&) = default;
+    Lease& operator=(Lease&&) = delete;
+    ~Lease() {
+      if (m_scratch) {
+        m_free->push_back(std::move(m_scratch));
+      }
+    }
+
+    AlgorithmScratch* get() const { return m_scratch.get(); }
+
+   private:
+    std::vector<std::unique_ptr<AlgorithmScratch>>* m_free = nullptr;
+    std::unique_ptr<AlgorithmScratch> m_scratch;
+  };
+
+  /// Create empty pools for the given algorithms.
+  ScratchPool(const std::vector<std::shared_ptr<IAlgorithm>>& algorithms);
+
+  /// Check out a scratch object of the given algorithm for the calling thread.
+  ///
+  /// Returns an empty lease if the algorithm does not use scratch state.
+  /// Algorithms that do not provide scratch state are never asked again.
+  Lease acquire(size_t ialgorithm);
+
+  /// Total number of scratch objects created so far.
+  size_t size() const { return m_numCreated; }
+
+ private:
+  using FreeLists = std::vector<std::vector<std::unique_ptr<AlgorithmScratch>>>;
+
+  std::vector<std::shared_ptr<IAlgorithm>> m_algorithms;
+  std::vector<std::atomic<bool>> m_stateless;
+  tbb::enumerable_thread_specific<FreeLists> m_free;
+  std::atomic<size_t> m_numCreated = 0;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,32 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/SequenceElement.hpp"
+
+#include "ActsExamples/Framework/DataHandle.hpp"
+
+namespace {
+std::vector<std::string> initializedKeys(
+    const std::vector<ActsExamples::DataHandleBase*>& handles) {
+  std::vector<std::string> keys;
+  for (const auto* handle : handles) {
+    if (handle->isInitialized()) {
+      keys.push_back(handle->key());
+    }
+  }
+  return keys;
+}
+}  // namespace
+
+std::vector<std::string> ActsExamples::SequenceElement::readKeys() const {
+  return initializedKeys(m_readHandles);
+}
+
+std::vector<std::string> ActsExamples::SequenceElement::writeKeys() const {
+  return initializedKeys(m_writeHandles);
+}
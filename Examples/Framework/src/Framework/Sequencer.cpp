@@ -8,26 +8,40 @@
 
 #include "ActsExamples/Framework/Sequencer.hpp"
 
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include "EventPrefetcher.hpp"
+#include "EventProfiler.hpp"
+#include "ScratchPool.hpp"
+#include "WriterPipeline.hpp"
+
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
 #include <numeric>
+#include <set>
+#include <unordered_map>
 
 #include <TROOT.h>
+#include <boost/core/demangle.hpp>
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
 #include <tbb/tbb.h>
+#include <unistd.h>
 
 ActsExamples::Sequencer::Sequencer(const Sequencer::Config& cfg)
     : m_cfg(cfg),
       m_logger(Acts::getDefaultLogger("Sequencer", m_cfg.logLevel)) {
   // automatically determine the number of concurrent threads to use
   if (m_cfg.numThreads < 0) {
-    m_cfg.numThreads = tbb::task_scheduler_init::default_num_threads();
+    m_cfg.numThreads = tbb::this_task_arena::max_concurrency();
   }
   ROOT::EnableThreadSafety();
 }
@@ -175,11 +189,146 @@ using NanoSeconds = std::chrono::duration<double, std::nano>;
 struct StopWatch {
   Timepoint start;
   Duration& store;
+  // optional recording of the individual per-event execution
+  ActsExamples::EventProfiler* profiler = nullptr;
+  size_t element = 0;
+  size_t event = 0;
 
   StopWatch(Duration& s) : start(Clock::now()), store(s) {}
-  ~StopWatch() { store += Clock::now() - start; }
+  StopWatch(std::vector<Duration>& clocks, size_t i, size_t ev,
+            ActsExamples::EventProfiler* p)
+      : start(Clock::now()),
+        store(clocks[i]),
+        profiler(p),
+        element(i),
+        event(ev) {
+    if (profiler != nullptr) {
+      profiler->begin();
+    }
+  }
+  ~StopWatch() {
+    Timepoint end = Clock::now();
+    store += end - start;
+    if (profiler != nullptr) {
+      profiler->record(element, event, start, end);
+    }
+  }
 };
 
+// Schedule runner tasks that process events until none are left.
+//
+// A runner that can not continue, e.g. because the writers fall behind, is
+// parked instead of blocking its worker thread. The worker might hold stolen
+// work of another event within a nested wait and would never get back to it.
+// Parked runners are scheduled again by whoever resolves their condition.
+// Runners are enqueued into the task arena and the calling thread waits
+// outside of it.
+class RunnerPool {
+ public:
+  /// Called with the event claimed before parking or `kNoEvent`. Returns
+  /// true if the runner has been parked and false once it is done.
+  using Runner = std::function<bool(size_t)>;
+
+  static constexpr size_t kNoEvent = SIZE_MAX;
+
+  RunnerPool(tbb::task_arena& arena) : m_arena(arena) {}
+
+  /// Run the given number of runners and wait until all of them are done.
+  ///
+  /// @throws the first error of any runner
+  void run(size_t numRunners, Runner runner) {
+    m_runner = std::move(runner);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_numLive = numRunners;
+    }
+    for (size_t i = 0; i < numRunners; ++i) {
+      spawn(kNoEvent);
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [&]() { return m_numLive == 0u; });
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  /// Whether a runner has failed and the others should stop.
+  bool failed() const { return m_failed; }
+
+  /// Park the calling runner if it is still blocked.
+  ///
+  /// The condition is checked under the same lock as in `unpark` so the
+  /// wake-up can not be missed. A parked runner must return immediately.
+  /// An event claimed by the runner is handed to it again when resumed.
+  bool park(const std::function<bool()>& blocked, size_t event = kNoEvent) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_failed or not blocked()) {
+      return false;
+    }
+    m_parked.push_back(event);
+    return true;
+  }
+
+  /// Schedule all parked runners again to check their condition.
+  void unpark() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resume();
+  }
+
+ private:
+  void spawn(size_t event) {
+    m_arena.enqueue([this, event]() { execute(event); });
+  }
+  void resume() {
+    for (size_t event : m_parked) {
+      spawn(event);
+    }
+    m_parked.clear();
+  }
+  void execute(size_t event) {
+    std::exception_ptr error;
+    try {
+      if (m_runner(event)) {
+        return;
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (error) {
+      if (not m_error) {
+        m_error = error;
+      }
+      // parked runners stop once they are scheduled again
+      m_failed = true;
+      resume();
+    }
+    m_numLive -= 1;
+    // notify under the lock since the waiting thread might destroy the pool
+    m_condition.notify_all();
+  }
+
+  tbb::task_arena& m_arena;
+  Runner m_runner;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  size_t m_numLive = 0;
+  std::vector<size_t> m_parked;
+  std::exception_ptr m_error;
+  std::atomic<bool> m_failed = false;
+};
+
+// Current resident memory of the process in bytes; zero if unknown.
+size_t residentMemory() {
+  std::ifstream statm("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  if (not(statm >> size >> resident)) {
+    return 0u;
+  }
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
 // Convert duration to a printable string w/ reasonable unit.
 template <typename D>
 inline std::string asString(D duration) {
@@ -225,6 +374,249 @@ void storeTiming(const std::vector<std::string>& identifiers,
 }
 }  // namespace
 
+bool ActsExamples::Sequencer::resolveDataHandles() {
+  auto table = std::make_shared<WhiteBoard::SlotTable>();
+  // element that writes each key
+  std::unordered_map<std::string, std::string> producers;
+  // elements that read a key that was not written before them
+  std::vector<std::pair<std::string, std::string>> unresolvedReads;
+  // handles are only bound to the table once it is known to be valid
+  std::vector<std::pair<DataHandleBase*, size_t>> slots;
+  bool valid = true;
+
+  auto resolve = [&](const std::string& element, DataHandleBase& handle) {
+    auto [it, inserted] =
+        table->indices.emplace(handle.key(), table->types.size());
+    if (inserted) {
+      table->types.push_back(&handle.typeInfo());
+    } else if (*table->types[it->second] != handle.typeInfo()) {
+      ACTS_ERROR(element << " handle '" << handle.name() << "' accesses '"
+                         << handle.key() << "' with type '"
+                         << boost::core::demangle(handle.typeInfo().name())
+                         << "' but it is used with type '"
+                         << boost::core::demangle(
+                                table->types[it->second]->name())
+                         << "' elsewhere");
+      valid = false;
+    }
+    slots.emplace_back(&handle, it->second);
+  };
+  // elements are visited in the order of the event processing
+  auto visit = [&](const std::string& element, SequenceElement& seqElement) {
+    for (auto* handle : seqElement.readHandles()) {
+      if (not handle->isInitialized()) {
+        continue;
+      }
+      if (producers.count(handle->key()) == 0) {
+        unresolvedReads.emplace_back(element, handle->key());
+      }
+      resolve(element, *handle);
+    }
+    for (auto* handle : seqElement.writeHandles()) {
+      if (not handle->isInitialized()) {
+        continue;
+      }
+      auto [it, inserted] = producers.emplace(handle->key(), element);
+      if (not inserted) {
+        ACTS_ERROR(element << " writes '" << handle->key()
+                           << "' which is already written by " << it->second);
+        valid = false;
+      }
+      resolve(element, *handle);
+    }
+  };
+  for (const auto& rdr : m_readers) {
+    visit("Reader:" + rdr->name(), *rdr);
+  }
+  for (const auto& alg : m_algorithms) {
+    visit("Algorithm:" + alg->name(), *alg);
+  }
+  for (const auto& wrt : m_writers) {
+    visit("Writer:" + wrt->name(), *wrt);
+  }
+
+  for (const auto& [element, key] : unresolvedReads) {
+    auto it = producers.find(key);
+    if (it != producers.end()) {
+      ACTS_ERROR(element << " reads '" << key << "' before it is written by "
+                         << it->second);
+      valid = false;
+    } else {
+      // objects can still be added to the event store without handles
+      ACTS_DEBUG(element << " reads '" << key
+                         << "' which is not written by any data handle");
+    }
+  }
+
+  // the scheduling must see the same dependencies as the data handles. only
+  // elements without handles declare their event store objects by name.
+  auto nonEmpty = [](const std::vector<std::string>& keys) {
+    std::set<std::string> set;
+    for (const auto& key : keys) {
+      if (not key.empty()) {
+        set.insert(key);
+      }
+    }
+    return set;
+  };
+  auto handleKeys = [](const std::vector<DataHandleBase*>& handles) {
+    std::set<std::string> set;
+    for (const auto* handle : handles) {
+      if (handle->isInitialized()) {
+        set.insert(handle->key());
+      }
+    }
+    return set;
+  };
+  auto checkDeclared = [&](const std::string& element,
+                           const SequenceElement& seqElement,
+                           const std::vector<std::string>& ins,
+                           const std::vector<std::string>& outs) {
+    if (seqElement.readHandles().empty() and
+        seqElement.writeHandles().empty()) {
+      return;
+    }
+    if ((nonEmpty(ins) != handleKeys(seqElement.readHandles())) or
+        (nonEmpty(outs) != handleKeys(seqElement.writeHandles()))) {
+      ACTS_ERROR(element << " declares event store objects that differ from "
+                            "its data handles");
+      valid = false;
+    }
+  };
+  for (const auto& alg : m_algorithms) {
+    checkDeclared("Algorithm:" + alg->name(), *alg, alg->inputs(),
+                  alg->outputs());
+  }
+  for (const auto& wrt : m_writers) {
+    checkDeclared("Writer:" + wrt->name(), *wrt, wrt->inputs(), {});
+  }
+
+  if (valid) {
+    for (auto [handle, slot] : slots) {
+      handle->resolve(table.get(), slot);
+    }
+    ACTS_DEBUG("Resolved " << table->types.size()
+                           << " event store slot(s) for the data handles");
+    m_slotTable = std::move(table);
+  }
+  return valid;
+}
+
+void ActsExamples::Sequencer::buildDataflowGraph() {
+  // algorithms and writers are nodes in the graph in sequence order
+  std::vector<std::set<std::string>> inputs;
+  std::vector<std::set<std::string>> outputs;
+  std::vector<std::string> nodeNames;
+  auto addNode = [&](const std::string& name,
+                     const std::vector<std::string>& ins,
+                     const std::vector<std::string>& outs) {
+    inputs.emplace_back();
+    outputs.emplace_back();
+    for (const auto& in : ins) {
+      if (not in.empty()) {
+        inputs.back().insert(in);
+      }
+    }
+    for (const auto& out : outs) {
+      if (not out.empty()) {
+        outputs.back().insert(out);
+      }
+    }
+    nodeNames.push_back(name);
+  };
+  for (const auto& alg : m_algorithms) {
+    addNode("Algorithm:" + alg->name(), alg->inputs(), alg->outputs());
+  }
+  // asynchronous writers are not part of the event processing
+  if (not m_cfg.asyncWriters) {
+    for (const auto& wrt : m_writers) {
+      addNode("Writer:" + wrt->name(), wrt->inputs(), {});
+    }
+  }
+
+  auto intersects = [](const std::set<std::string>& a,
+                       const std::set<std::string>& b) {
+    return std::any_of(a.begin(), a.end(),
+                       [&](const std::string& x) { return 0 < b.count(x); });
+  };
+  auto isOpaque = [&](size_t i) {
+    return inputs[i].empty() and outputs[i].empty();
+  };
+
+  size_t numNodes = nodeNames.size();
+  m_dataflowSuccessors.assign(numNodes, {});
+  m_dataflowPredecessors.assign(numNodes, 0u);
+  for (size_t i = 0; i < numNodes; ++i) {
+    for (size_t j = 0; j < i; ++j) {
+      // nodes without declared data dependencies act as barriers. a node
+      // must wait for all producers of its inputs; a later producer must wait
+      // for all earlier readers and producers of the same object so the
+      // observed data and the reported error match the sequential order.
+      bool depends = isOpaque(i) or isOpaque(j) or
+                     intersects(outputs[j], inputs[i]) or
+                     intersects(inputs[j], outputs[i]) or
+                     intersects(outputs[j], outputs[i]);
+      if (depends) {
+        m_dataflowSuccessors[j].push_back(i);
+        m_dataflowPredecessors[i] += 1;
+      }
+    }
+  }
+
+  ACTS_DEBUG("Dataflow graph:");
+  for (size_t i = 0; i < numNodes; ++i) {
+    ACTS_DEBUG("  " << nodeNames[i] << " waits for "
+                    << m_dataflowPredecessors[i] << " predecessor(s)");
+  }
+}
+
+void ActsExamples::Sequencer::runDataflowGraph(
+    const AlgorithmContext& context, size_t offset,
+    std::vector<Duration>& clocks, ScratchPool& scratchPool,
+    EventProfiler* profiler) const {
+  size_t numNodes = m_dataflowPredecessors.size();
+  std::unique_ptr<std::atomic<size_t>[]> pending(
+      new std::atomic<size_t>[numNodes]);
+  for (size_t i = 0; i < numNodes; ++i) {
+    pending[i] = m_dataflowPredecessors[i];
+  }
+
+  tbb::task_group group;
+  std::function<void(size_t)> launch = [&](size_t i) {
+    group.run([&, i]() {
+      // every node gets its own context with the sequence-order number
+      AlgorithmContext nodeContext = context;
+      nodeContext.algorithmNumber = offset + i + 1;
+      {
+        StopWatch sw(clocks, offset + i, context.eventNumber, profiler);
+        if (i < m_algorithms.size()) {
+          auto scratch = scratchPool.acquire(i);
+          nodeContext.scratch = scratch.get();
+          if (m_algorithms[i]->execute(nodeContext) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to process event data");
+          }
+        } else {
+          const auto& wrt = m_writers[i - m_algorithms.size()];
+          if (wrt->write(nodeContext) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to write output data");
+          }
+        }
+      }
+      for (size_t next : m_dataflowSuccessors[i]) {
+        if (--pending[next] == 0u) {
+          launch(next);
+        }
+      }
+    });
+  };
+  for (size_t i = 0; i < numNodes; ++i) {
+    if (m_dataflowPredecessors[i] == 0u) {
+      launch(i);
+    }
+  }
+  group.wait();
+}
+
 int ActsExamples::Sequencer::run() {
   // measure overall wall clock
   Timepoint clockWallStart = Clock::now();
@@ -239,6 +631,10 @@ int ActsExamples::Sequencer::run() {
   if ((eventsRange.first == SIZE_MAX) and (eventsRange.second == SIZE_MAX)) {
     return EXIT_FAILURE;
   }
+  // inconsistent data handles are a configuration error
+  if (not resolveDataHandles()) {
+    return EXIT_FAILURE;
+  }
 
   ACTS_INFO("Processing events [" << eventsRange.first << ", "
                                   << eventsRange.second << ")");
@@ -257,78 +653,272 @@ int ActsExamples::Sequencer::run() {
     service->startRun();
   }
 
+  if (m_cfg.dataflowScheduling) {
+    buildDataflowGraph();
+  }
+
+  // the event loop and nested parallelism in the algorithms share the arena.
+  // no slot is reserved for this thread, which only waits for the runners.
+  tbb::task_arena taskArena(m_cfg.numThreads, 0);
+  // parked runners are scheduled again by the I/O and writer threads
+  RunnerPool runnerPool(taskArena);
+  // algorithm scratch state is kept per thread and reused across events
+  ScratchPool scratchPool(m_algorithms);
+
+  // optional recording of every execution within the event loop
+  std::unique_ptr<EventProfiler> profiler;
+  if (m_cfg.profiling or not m_cfg.traceFile.empty()) {
+    EventProfiler::Config profilerCfg;
+    profilerCfg.names = listAlgorithmNames();
+    profilerCfg.firstEvent = eventsRange.first;
+    profilerCfg.numEvents = eventsRange.second - eventsRange.first;
+    profilerCfg.trace = not m_cfg.traceFile.empty();
+    profiler = std::make_unique<EventProfiler>(std::move(profilerCfg));
+  }
+
+  // services, decorators, and readers prepare the event, optionally ahead of
+  // time on dedicated I/O threads
+  size_t readersOffset =
+      m_services.size() + m_decorators.size() + m_readers.size();
+  EventPrefetcher::Config prefetcherCfg;
+  prefetcherCfg.services = m_services;
+  prefetcherCfg.decorators = m_decorators;
+  prefetcherCfg.readers = m_readers;
+  prefetcherCfg.makeStore = [&](size_t event) {
+    return std::make_unique<WhiteBoard>(
+        Acts::getDefaultLogger("EventStore#" + std::to_string(event),
+                               m_cfg.logLevel),
+        m_cfg.eventArenaSize, m_slotTable);
+  };
+  prefetcherCfg.numThreads = m_cfg.numReaderThreads;
+  prefetcherCfg.depth = m_cfg.prefetchEvents;
+  prefetcherCfg.firstEvent = eventsRange.first;
+  prefetcherCfg.lastEvent = eventsRange.second;
+  prefetcherCfg.profiler = profiler.get();
+  prefetcherCfg.taskArena = &taskArena;
+  prefetcherCfg.onStaged = [&]() { runnerPool.unpark(); };
+  EventPrefetcher prefetcher(prefetcherCfg, logger());
+
+  // Events are dispatched one at a time by runner tasks instead of in chunks
+  // if their number in flight must be controlled. The number of runners
+  // bounds the number of events in flight.
+  size_t nTotalEvents = eventsRange.second - eventsRange.first;
+  bool useRunners = (0u < m_cfg.maxEventsInFlight) or
+                    (0u < m_cfg.maxResidentMemory) or m_cfg.asyncWriters or
+                    (0u < m_cfg.numReaderThreads);
+  size_t numRunners = (0u < m_cfg.maxEventsInFlight)
+                          ? m_cfg.maxEventsInFlight
+                          : static_cast<size_t>(m_cfg.numThreads);
+  numRunners = std::clamp<size_t>(numRunners, 1u, nTotalEvents);
+
+  // writers either run within the event processing or on their own threads
+  size_t writersOffset = readersOffset + m_algorithms.size();
+  std::unique_ptr<WriterPipeline> writerPipeline;
+  if (m_cfg.asyncWriters) {
+    WriterPipeline::Config pipelineCfg;
+    pipelineCfg.writers = m_writers;
+    pipelineCfg.numThreads = m_cfg.numWriterThreads;
+    pipelineCfg.capacity = m_cfg.writerQueueCapacity;
+    pipelineCfg.numProducers = numRunners;
+    pipelineCfg.ordered = m_cfg.orderedWrites;
+    pipelineCfg.firstEvent = eventsRange.first;
+    pipelineCfg.profiler = profiler.get();
+    pipelineCfg.onRelease = [&]() { runnerPool.unpark(); };
+    writerPipeline = std::make_unique<WriterPipeline>(pipelineCfg, logger());
+  }
+
   // execute the parallel event loop
   std::atomic<size_t> nProcessedEvents = 0;
-  size_t nTotalEvents = eventsRange.second - eventsRange.first;
-  tbb::task_scheduler_init init(m_cfg.numThreads);
-  tbb::parallel_for(
-      tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-      [&](const tbb::blocked_range<size_t>& r) {
-        std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                    Duration::zero());
-
-        for (size_t event = r.begin(); event != r.end(); ++event) {
-          // Use per-event store
-          WhiteBoard eventStore(Acts::getDefaultLogger(
-              "EventStore#" + std::to_string(event), m_cfg.logLevel));
-          // If we ever wanted to run algorithms in parallel, this needs to be
-          // changed to Algorithm context copies
-          AlgorithmContext context(0, event, eventStore);
-          size_t ialgo = 0;
-
-          // Prepare event store w/ service information
-          for (auto& service : m_services) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            service->prepare(++context);
+  auto processEvent = [&](std::unique_ptr<EventPrefetcher::Event> staged,
+                          std::vector<Duration>& localClocksAlgorithms) {
+    // Use per-event store; it is handed over to the asynchronous writers
+    // after processing
+    auto& eventStore = staged->store;
+    // Algorithms run in parallel by the dataflow scheduling get their own
+    // copies of the context
+    AlgorithmContext& context = staged->context;
+    size_t event = context.eventNumber;
+    size_t ialgo = readersOffset;
+
+    if (m_cfg.dataflowScheduling) {
+      // Execute algorithms and writers as their inputs become available
+      runDataflowGraph(context, ialgo, localClocksAlgorithms, scratchPool,
+                       profiler.get());
+    } else {
+      // Execute all algorithms
+      for (size_t i = 0; i < m_algorithms.size(); ++i) {
+        StopWatch sw(localClocksAlgorithms, ialgo++, event, profiler.get());
+        auto scratch = scratchPool.acquire(i);
+        context.scratch = scratch.get();
+        if (m_algorithms[i]->execute(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to process event data");
+        }
+        context.scratch = nullptr;
+      }
+      // Write out results
+      if (not writerPipeline) {
+        for (auto& wrt : m_writers) {
+          StopWatch sw(localClocksAlgorithms, ialgo++, event, profiler.get());
+          if (wrt->write(++context) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to write output data");
           }
-          /// Decorate the context
-          for (auto& cdr : m_decorators) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to decorate event context");
+        }
+      }
+    }
+    if (writerPipeline) {
+      context.algorithmNumber = writersOffset;
+      writerPipeline->push(std::move(eventStore), context);
+    }
+
+    nProcessedEvents++;
+    if (nTotalEvents <= 100) {
+      ACTS_INFO("finished event " << event);
+    } else {
+      if (nProcessedEvents % 100 == 0) {
+        ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
+                                   << " events processed");
+      }
+    }
+  };
+  auto mergeClocks = [&](const std::vector<Duration>& localClocksAlgorithms) {
+    tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+    for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+      clocksAlgorithms[i] += localClocksAlgorithms[i];
+    }
+  };
+  if (not useRunners) {
+    taskArena.execute([&]() {
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
+          [&](const tbb::blocked_range<size_t>& r) {
+            std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                        Duration::zero());
+            for (size_t ievent = r.begin(); ievent != r.end(); ++ievent) {
+              // prepare and read the event on this thread
+              processEvent(prefetcher.next(ievent, localClocksAlgorithms),
+                           localClocksAlgorithms);
             }
+            mergeClocks(localClocksAlgorithms);
+          });
+    });
+  } else {
+    // Each runner task processes one event at a time and takes the next event
+    // number once it is done. A slow event only holds back its own runner.
+    // Chunks would also be unsafe with the I/O threads, since they can be
+    // stolen by a worker that waits for an earlier event in its own chunk.
+    ACTS_DEBUG("Processing up to " << numRunners << " events concurrently");
+    std::atomic<size_t> nextEvent = eventsRange.first;
+    std::atomic<size_t> nActiveEvents = 0;
+    std::atomic<size_t> nThrottledEvents = 0;
+    // runners are scheduled again on any thread and keep per-thread clocks
+    tbb::enumerable_thread_specific<std::vector<Duration>> localClocks(
+        names.size(), Duration::zero());
+    auto overMemoryLimit = [&]() {
+      return (0u < m_cfg.maxResidentMemory) and
+             (m_cfg.maxResidentMemory < residentMemory());
+    };
+    // only a finished event can release memory and resume throttled runners
+    auto finishEvent = [&]() {
+      nActiveEvents--;
+      if (0u < m_cfg.maxResidentMemory) {
+        runnerPool.unpark();
+      }
+    };
+    runnerPool.run(numRunners, [&](size_t claimed) {
+      auto& localClocksAlgorithms = localClocks.local();
+      while (not runnerPool.failed()) {
+        size_t ievent = claimed;
+        claimed = RunnerPool::kNoEvent;
+        if (ievent == RunnerPool::kNoEvent) {
+          if (eventsRange.second <= nextEvent) {
+            break;
           }
-          // Read everything in
-          for (auto& rdr : m_readers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (rdr->read(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to read input data");
-            }
+          // A full writer pipeline must not block the worker thread, which
+          // might hold stolen work of another event. The runner is parked
+          // instead and scheduled again once an event has been written.
+          if (writerPipeline and writerPipeline->full() and
+              runnerPool.park([&]() { return writerPipeline->full(); })) {
+            return true;
           }
-          // Execute all algorithms
-          for (auto& alg : m_algorithms) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (alg->execute(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to process event data");
+          // Above the memory limit, no event is started while other events
+          // are in flight and the runner is parked until one of them is
+          // finished. Without any, one event is started regardless to ensure
+          // progress.
+          bool counted = false;
+          if (overMemoryLimit()) {
+            size_t none = 0u;
+            if (not nActiveEvents.compare_exchange_strong(none, 1u)) {
+              if (runnerPool.park([&]() { return 0u < nActiveEvents; })) {
+                nThrottledEvents++;
+                return true;
+              }
+              continue;
             }
+            counted = true;
           }
-          // Write out results
-          for (auto& wrt : m_writers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (wrt->write(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to write output data");
+          ievent = nextEvent++;
+          if (eventsRange.second <= ievent) {
+            if (counted) {
+              finishEvent();
             }
+            break;
           }
-
-          nProcessedEvents++;
-          if (nTotalEvents <= 100) {
-            ACTS_INFO("finished event " << event);
-          } else {
-            if (nProcessedEvents % 100 == 0) {
-              ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                         << " events processed");
-            }
+          if (not counted) {
+            nActiveEvents++;
           }
         }
-
-        // add timing info to global information
-        {
-          tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-          for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-            clocksAlgorithms[i] += localClocksAlgorithms[i];
+        try {
+          // Prepare and read the event. An event that is still being read
+          // ahead parks the runner instead of waiting for the I/O threads;
+          // the runner resumes the event once it is staged.
+          auto staged = prefetcher.tryNext(ievent, localClocksAlgorithms);
+          if (not staged) {
+            if (runnerPool.park([&]() { return not prefetcher.ready(ievent); },
+                                ievent)) {
+              return true;
+            }
+            claimed = ievent;
+            continue;
           }
+          processEvent(std::move(staged), localClocksAlgorithms);
+        } catch (...) {
+          // the other runners stop and the error is rethrown by the pool
+          finishEvent();
+          throw;
         }
-      });
+        finishEvent();
+      }
+      // a claimed event is dropped if another runner has failed
+      if (claimed != RunnerPool::kNoEvent) {
+        finishEvent();
+      }
+      return false;
+    });
+    for (const auto& clocks : localClocks) {
+      mergeClocks(clocks);
+    }
+    if (0u < nThrottledEvents) {
+      ACTS_INFO("Held back the start of an event " << nThrottledEvents
+                                                   << " times due to the "
+                                                      "memory limit");
+    }
+  }
+
+  prefetcher.finish();
+  for (size_t i = 0; i < readersOffset; ++i) {
+    clocksAlgorithms[i] += prefetcher.durations()[i];
+  }
+  // wait for the remaining events to be written
+  if (writerPipeline) {
+    writerPipeline->finish();
+    for (size_t i = 0; i < m_writers.size(); ++i) {
+      clocksAlgorithms[writersOffset + i] += writerPipeline->durations()[i];
+    }
+  }
+  if (profiler) {
+    profiler->stop();
+  }
+  ACTS_DEBUG("Used " << scratchPool.size() << " algorithm scratch object(s)");
 
   // run end-of-run hooks
   for (auto& wrt : m_writers) {
@@ -355,6 +945,25 @@ int ActsExamples::Sequencer::run() {
   }
   storeTiming(names, clocksAlgorithms, numEvents,
               joinPaths(m_cfg.outputDir, "timing.tsv"));
+  if (profiler) {
+    std::vector<Duration> lockWaits(writersOffset + m_writers.size(),
+                                    Duration::zero());
+    for (size_t i = 0; i < m_writers.size(); ++i) {
+      lockWaits[writersOffset + i] =
+          std::chrono::duration_cast<Duration>(m_writers[i]->lockWaitTime());
+      if (lockWaits[writersOffset + i] != Duration::zero()) {
+        ACTS_DEBUG("Writer:" << m_writers[i]->name() << " waited "
+                             << asString(lockWaits[writersOffset + i])
+                             << " on locks");
+      }
+    }
+    profiler->writeDistributions(
+        lockWaits, joinPaths(m_cfg.outputDir, "timing_events.tsv"));
+    profiler->writeThreads(joinPaths(m_cfg.outputDir, "timing_threads.tsv"));
+    if (not m_cfg.traceFile.empty()) {
+      profiler->writeTrace(joinPaths(m_cfg.outputDir, m_cfg.traceFile));
+    }
+  }
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,168 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "WriterPipeline.hpp"
+
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include "EventProfiler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+ActsExamples::WriterPipeline::WriterPipeline(
+    const Config& cfg, const Acts::Logger& parentLogger)
+    : m_cfg(cfg),
+      m_logger(parentLogger),
+      m_durations(cfg.writers.size(), Duration::zero()) {
+  m_cfg.capacity = std::max<size_t>(m_cfg.capacity, 1u);
+  m_cfg.numProducers = std::max<size_t>(m_cfg.numProducers, 1u);
+  // ordered writing is inherently sequential
+  m_cfg.numThreads =
+      m_cfg.ordered ? 1u : std::max<size_t>(m_cfg.numThreads, 1u);
+  // every producer can hand over one event while the pipeline is not yet
+  // full; the stop markers for the threads must always fit as well
+  m_queue.set_capacity(m_cfg.capacity - 1u + m_cfg.numProducers +
+                       m_cfg.numThreads);
+  ACTS_DEBUG("Starting " << m_cfg.numThreads << " writer thread(s) for up to "
+                         << m_cfg.capacity << " pending events");
+  for (size_t i = 0; i < m_cfg.numThreads; ++i) {
+    m_threads.emplace_back([this]() { runThread(); });
+  }
+}
+
+ActsExamples::WriterPipeline::~WriterPipeline() {
+  stop();
+}
+
+void ActsExamples::WriterPipeline::push(std::unique_ptr<WhiteBoard> store,
+                                        const AlgorithmContext& context) {
+  if (m_failed) {
+    throw std::runtime_error("Failed to write output data");
+  }
+  auto event = std::make_unique<Event>(Event{std::move(store), context});
+  // counted before the hand-over so the writers never see it negative
+  m_numPending += 1;
+  // admission by the caller guarantees space; a full queue must not block
+  if (not m_queue.try_push(event.get())) {
+    m_numPending -= 1;
+    throw std::logic_error("Too many events handed over to the writers");
+  }
+  event.release();
+}
+
+void ActsExamples::WriterPipeline::finish() {
+  stop();
+  if (m_error) {
+    std::rethrow_exception(m_error);
+  }
+}
+
+void ActsExamples::WriterPipeline::runThread() {
+  std::vector<Duration> durations(m_cfg.writers.size(), Duration::zero());
+  // only used for ordered writes where there is a single thread
+  std::map<size_t, std::unique_ptr<Event>> reorderBuffer;
+  size_t nextEvent = m_cfg.firstEvent;
+
+  while (true) {
+    Event* raw = nullptr;
+    m_queue.pop(raw);
+    if (raw == nullptr) {
+      break;
+    }
+    std::unique_ptr<Event> event(raw);
+
+    if (not m_cfg.ordered) {
+      write(*event, durations);
+      release();
+      continue;
+    }
+    reorderBuffer.emplace(event->context.eventNumber, std::move(event));
+    while ((not reorderBuffer.empty()) and
+           (reorderBuffer.begin()->first == nextEvent)) {
+      write(*reorderBuffer.begin()->second, durations);
+      reorderBuffer.erase(reorderBuffer.begin());
+      release();
+      ++nextEvent;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_durationsMutex);
+  for (size_t i = 0; i < durations.size(); ++i) {
+    m_durations[i] += durations[i];
+  }
+}
+
+void ActsExamples::WriterPipeline::write(Event& event,
+                                         std::vector<Duration>& durations) {
+  using Clock = std::chrono::high_resolution_clock;
+
+  // discard all events after the first failure
+  if (m_failed) {
+    return;
+  }
+  try {
+    AlgorithmContext context = event.context;
+    for (size_t i = 0; i < m_cfg.writers.size(); ++i) {
+      if (m_cfg.profiler != nullptr) {
+        m_cfg.profiler->begin();
+      }
+      auto start = Clock::now();
+      // also recorded on failure to keep the profiler nesting consistent
+      auto stop = [&]() {
+        auto end = Clock::now();
+        durations[i] += end - start;
+        if (m_cfg.profiler != nullptr) {
+          m_cfg.profiler->record(context.algorithmNumber - 1u,
+                                 context.eventNumber, start, end);
+        }
+      };
+      ProcessCode ret = ProcessCode::ABORT;
+      try {
+        ret = m_cfg.writers[i]->write(++context);
+      } catch (...) {
+        stop();
+        throw;
+      }
+      stop();
+      if (ret != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write output data");
+      }
+    }
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(m_errorMutex);
+      if (not m_error) {
+        m_error = std::current_exception();
+      }
+    }
+    ACTS_ERROR("Failed to write event " << event.context.eventNumber);
+    m_failed = true;
+  }
+}
+
+void ActsExamples::WriterPipeline::release() {
+  m_numPending -= 1;
+  if (m_cfg.onRelease) {
+    m_cfg.onRelease();
+  }
+}
+
+void ActsExamples::WriterPipeline::stop() {
+  if (m_threads.empty()) {
+    return;
+  }
+  // one stop marker per thread; queued events are still written
+  for (size_t i = 0; i < m_threads.size(); ++i) {
+    m_queue.push(nullptr);
+  }
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+  m_threads.clear();
+}
@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <tbb/concurrent_queue.h>
+
+namespace ActsExamples {
+
+class EventProfiler;
+
+/// Run the writers for finished events on dedicated threads.
+///
+/// Event processing threads hand over the event store of a finished event and
+/// continue immediately with the next event. The hand-over uses a bounded
+/// lock-free queue and never blocks, so it is safe within tasks that share
+/// the task arena with nested parallelism. Backpressure is left to the
+/// caller, which must not start further events while the pipeline is full
+/// and can resume once it is notified that an event has been written.
+///
+/// If ordered writing is requested, events are written in increasing event
+/// number by a single writer thread. Events that arrive early wait in a
+/// reorder buffer and count as pending.
+class WriterPipeline {
+ public:
+  using Duration = std::chrono::high_resolution_clock::duration;
+
+  struct Config {
+    /// writers to run for every event
+    std::vector<std::shared_ptr<IWriter>> writers;
+    /// number of dedicated writer threads; forced to one for ordered writes
+    size_t numThreads = 1;
+    /// number of events waiting to be written above which the pipeline is
+    /// considered full
+    size_t capacity = 16;
+    /// maximum number of events that can be handed over after the pipeline
+    /// was last seen not to be full, i.e. the number of events in flight
+    size_t numProducers = 1;
+    /// write events in increasing event number order
+    bool ordered = false;
+    /// first event number that will be written; used for ordered writes
+    size_t firstEvent = 0;
+    /// optional recording of every writer execution
+    EventProfiler* profiler = nullptr;
+    /// called on a writer thread after every written or discarded event
+    std::function<void()> onRelease;
+  };
+
+  /// Start the writer threads.
+  WriterPipeline(const Config& cfg, const Acts::Logger& parentLogger);
+  /// Stops the writer threads but drops all errors; call `finish()` instead.
+  ~WriterPipeline();
+
+  WriterPipeline(const WriterPipeline&) = delete;
+  WriterPipeline& operator=(const WriterPipeline&) = delete;
+
+  /// Hand over an event for writing.
+  ///
+  /// @param store the event store; ownership is transferred to the pipeline
+  /// @param context the event context; writers are numbered after it
+  /// @throws std::runtime_error if a writer has previously failed
+  /// @throws std::logic_error if more events are handed over than admitted
+  ///         by the configured capacity and number of producers
+  ///
+  /// Never blocks.
+  void push(std::unique_ptr<WhiteBoard> store, const AlgorithmContext& context);
+
+  /// Whether the configured number of events is waiting to be written.
+  ///
+  /// No further events should be started until `Config::onRelease` is
+  /// called.
+  bool full() const { return m_cfg.capacity <= m_numPending; }
+
+  /// Write all remaining events and stop the writer threads.
+  ///
+  /// @throws the first error encountered by any of the writers
+  void finish();
+
+  /// Accumulated time spent in each writer.
+  const std::vector<Duration>& durations() const { return m_durations; }
+
+ private:
+  struct Event {
+    std::unique_ptr<WhiteBoard> store;
+    AlgorithmContext context;
+  };
+
+  void runThread();
+  void write(Event& event, std::vector<Duration>& durations);
+  void release();
+  void stop();
+
+  Config m_cfg;
+  const Acts::Logger& m_logger;
+  // lock-free hand-over from the event processing threads; nullptr stops
+  tbb::concurrent_bounded_queue<Event*> m_queue;
+  // events handed over but not yet written, including the reorder buffer
+  std::atomic<size_t> m_numPending = 0;
+  // first writer failure; later events are discarded
+  std::mutex m_errorMutex;
+  std::exception_ptr m_error;
+  std::atomic<bool> m_failed = false;
+  std::mutex m_durationsMutex;
+  std::vector<Duration> m_durations;
+  std::vector<std::thread> m_threads;
+
+  const Acts::Logger& logger() const { return m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -20,9 +20,11 @@
 #include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -77,6 +79,10 @@ class CsvMeasurementWriter final : public WriterT<MeasurementContainer> {
 
  private:
   Config m_cfg;
+
+  ReadHandle<IndexMultimap<Index>> m_inputMeasurementSimHitsMap{
+      this, "InputMeasurementSimHitsMap"};
+  ReadHandle<ClusterContainer> m_inputClusters{this, "InputClusters"};
 };
 
 }  // namespace ActsExamples
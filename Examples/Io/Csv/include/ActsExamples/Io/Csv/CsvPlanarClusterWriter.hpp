@@ -11,11 +11,14 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 #include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -68,6 +71,8 @@ class CsvPlanarClusterWriter final
 
  private:
   Config m_cfg;
+
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
 };
 
 }  // namespace ActsExamples
@@ -41,6 +41,9 @@ ActsExamples::CsvMeasurementWriter::CsvMeasurementWriter(
     throw std::invalid_argument(
         "Missing hit-to-simulated-hits map input collection");
   }
+
+  m_inputMeasurementSimHitsMap.initialize(m_cfg.inputMeasurementSimHitsMap);
+  m_inputClusters.initialize(m_cfg.inputClusters);
 }
 
 ActsExamples::CsvMeasurementWriter::~CsvMeasurementWriter() {}
@@ -52,12 +55,11 @@ ActsExamples::ProcessCode ActsExamples::CsvMeasurementWriter::endRun() {
 
 ActsExamples::ProcessCode ActsExamples::CsvMeasurementWriter::writeT(
     const AlgorithmContext& ctx, const MeasurementContainer& measurements) {
-  const auto& measurementSimHitsMap = ctx.eventStore.get<IndexMultimap<Index>>(
-      m_cfg.inputMeasurementSimHitsMap);
+  const auto& measurementSimHitsMap = m_inputMeasurementSimHitsMap(ctx);
 
   ClusterContainer clusters;
   if (not m_cfg.inputClusters.empty()) {
-    clusters = ctx.eventStore.get<ClusterContainer>(m_cfg.inputClusters);
+    clusters = m_inputClusters(ctx);
   }
 
   // Open per-event file for all components
@@ -72,7 +72,6 @@ class RootNuclearInteractionParametersWriter final
 
  private:
   Config m_cfg;             ///< The config class
-  std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
   std::vector<detail::NuclearInteractionParametrisation::EventFraction>
       m_eventFractionCollection;  ///< The recorded fractions of events
 };
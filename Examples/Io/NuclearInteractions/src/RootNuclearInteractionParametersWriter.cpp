@@ -352,7 +352,7 @@ ActsExamples::RootNuclearInteractionParametersWriter::endRun() {
     return ProcessCode::ABORT;
 
   // Exclusive access to the file while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   // The file
   TFile tf(m_cfg.outputFilename.c_str(), m_cfg.fileMode.c_str());
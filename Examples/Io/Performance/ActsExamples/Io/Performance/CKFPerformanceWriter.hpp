@@ -9,7 +9,10 @@
 #pragma once
 
 #include "Acts/Definitions/Units.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 #include "ActsExamples/Validation/DuplicationPlotTool.hpp"
 #include "ActsExamples/Validation/EffPlotTool.hpp"
@@ -73,8 +76,6 @@ class CKFPerformanceWriter final : public WriterT<TrajectoriesContainer> {
                      const TrajectoriesContainer& trajectories) final override;
 
   Config m_cfg;
-  /// Mutex used to protect multi-threaded writes.
-  std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
   /// Plot tool for efficiency
   EffPlotTool m_effPlotTool;
@@ -88,6 +89,10 @@ class CKFPerformanceWriter final : public WriterT<TrajectoriesContainer> {
   /// Plot tool for track hit info
   TrackSummaryPlotTool m_trackSummaryPlotTool;
   TrackSummaryPlotTool::TrackSummaryPlotCache m_trackSummaryPlotCache;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
 };
 
 }  // namespace ActsExamples
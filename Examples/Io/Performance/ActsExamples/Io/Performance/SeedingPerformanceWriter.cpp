@@ -19,12 +19,6 @@
 
 #include <TFile.h>
 
-namespace {
-using SimParticleContainer = ActsExamples::SimParticleContainer;
-using HitParticlesMap = ActsExamples::IndexMultimap<ActsFatras::Barcode>;
-using ProtoTrackContainer = ActsExamples::ProtoTrackContainer;
-}  // namespace
-
 ActsExamples::SeedingPerformanceWriter::SeedingPerformanceWriter(
     ActsExamples::SeedingPerformanceWriter::Config cfg,
     Acts::Logging::Level lvl)
@@ -51,6 +45,9 @@ ActsExamples::SeedingPerformanceWriter::SeedingPerformanceWriter(
   }
   // initialize the plot tools
   m_effPlotTool.book(m_effPlotCache);
+
+  m_inputParticles.initialize(m_cfg.inputParticles);
+  m_inputMeasurementParticlesMap.initialize(m_cfg.inputMeasurementParticlesMap);
 }
 
 ActsExamples::SeedingPerformanceWriter::~SeedingPerformanceWriter() {
@@ -84,10 +81,8 @@ ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::endRun() {
 ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::writeT(
     const AlgorithmContext& ctx, const ProtoTrackContainer& tracks) {
   // Read truth information collections
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputMeasurementParticlesMap);
+  const auto& particles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
 
   size_t nSeeds = tracks.size();
   size_t nMatchedSeeds = 0;
@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 #include "ActsExamples/Validation/EffPlotTool.hpp"
 
@@ -49,8 +52,6 @@ class SeedingPerformanceWriter final : public WriterT<ProtoTrackContainer> {
                      const ProtoTrackContainer& tracks) final override;
 
   Config m_cfg;
-  /// Mutex used to protect multi-threaded writes.
-  std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
   /// Plot tool for efficiency
   EffPlotTool m_effPlotTool;
@@ -61,6 +62,10 @@ class SeedingPerformanceWriter final : public WriterT<ProtoTrackContainer> {
   size_t m_nTotalParticles = 0;
   size_t m_nTotalMatchedParticles = 0;
   size_t m_nTotalDuplicatedParticles = 0;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
 };
 
 }  // namespace ActsExamples
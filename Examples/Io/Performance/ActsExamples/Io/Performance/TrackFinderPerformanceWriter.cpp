@@ -239,7 +239,11 @@ ActsExamples::TrackFinderPerformanceWriter::TrackFinderPerformanceWriter(
     ActsExamples::TrackFinderPerformanceWriter::Config cfg,
     Acts::Logging::Level lvl)
     : WriterT(cfg.inputProtoTracks, "TrackFinderPerformanceWriter", lvl),
-      m_impl(std::make_unique<Impl>(std::move(cfg), logger())) {}
+      m_impl(std::make_unique<Impl>(std::move(cfg), logger())) {
+  m_inputParticles.initialize(m_impl->cfg.inputParticles);
+  m_inputMeasurementParticlesMap.initialize(
+      m_impl->cfg.inputMeasurementParticlesMap);
+}
 
 ActsExamples::TrackFinderPerformanceWriter::~TrackFinderPerformanceWriter() {
   // explicit destructor needed for pimpl idiom to work
@@ -248,10 +252,8 @@ ActsExamples::TrackFinderPerformanceWriter::~TrackFinderPerformanceWriter() {
 ActsExamples::ProcessCode ActsExamples::TrackFinderPerformanceWriter::writeT(
     const ActsExamples::AlgorithmContext& ctx,
     const ActsExamples::ProtoTrackContainer& tracks) {
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_impl->cfg.inputParticles);
-  const auto& hitParticlesMap = ctx.eventStore.get<HitParticlesMap>(
-      m_impl->cfg.inputMeasurementParticlesMap);
+  const auto& particles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
   m_impl->write(ctx.eventNumber, particles, hitParticlesMap, tracks);
   return ProcessCode::SUCCESS;
 }
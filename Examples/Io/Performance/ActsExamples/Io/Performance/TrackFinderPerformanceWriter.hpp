@@ -8,11 +8,15 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -46,6 +50,10 @@ class TrackFinderPerformanceWriter final : public WriterT<ProtoTrackContainer> {
 
   struct Impl;
   std::unique_ptr<Impl> m_impl;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
 };
 
 }  // namespace ActsExamples
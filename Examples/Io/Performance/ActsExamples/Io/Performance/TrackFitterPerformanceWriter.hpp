@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 #include "ActsExamples/Validation/EffPlotTool.hpp"
 #include "ActsExamples/Validation/ResPlotTool.hpp"
@@ -61,8 +64,6 @@ class TrackFitterPerformanceWriter final
                      const TrajectoriesContainer& trajectories) final override;
 
   Config m_cfg;
-  /// Mutex used to protect multi-threaded writes.
-  std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
   /// Plot tool for residuals and pulls.
   ResPlotTool m_resPlotTool;
@@ -73,6 +74,10 @@ class TrackFitterPerformanceWriter final
   /// Plot tool for track hit info
   TrackSummaryPlotTool m_trackSummaryPlotTool;
   TrackSummaryPlotTool::TrackSummaryPlotCache m_trackSummaryPlotCache;
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
 };
 
 }  // namespace ActsExamples
@@ -84,8 +84,6 @@ class RootMaterialTrackWriter
  private:
   /// The config class
   Config m_cfg;
-  /// mutex used to protect multi-threaded writes
-  std::mutex m_writeMutex;
   /// The output file name
   TFile* m_outputFile;
   /// The output tree name
@@ -20,6 +20,7 @@
 #include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <memory>
@@ -248,12 +249,16 @@ class RootMeasurementWriter final : public WriterT<MeasurementContainer> {
 
  private:
   Config m_cfg;
-  std::mutex m_writeMutex;  ///< protect multi-threaded writes
   TFile* m_outputFile;      ///< the output file
   Acts::GeometryHierarchyMap<std::unique_ptr<DigitizationTree>>
       m_outputTrees;  ///< the output trees
   std::unordered_map<Acts::GeometryIdentifier, const Acts::Surface*>
       m_dSurfaces;  ///< All surfaces that could carry measurements
+
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  ReadHandle<IndexMultimap<Index>> m_inputMeasurementSimHitsMap{
+      this, "InputMeasurementSimHitsMap"};
+  ReadHandle<ClusterContainer> m_inputClusters{this, "InputClusters"};
 };
 
 }  // namespace ActsExamples
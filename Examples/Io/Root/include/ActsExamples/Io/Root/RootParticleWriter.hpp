@@ -63,7 +63,6 @@ class RootParticleWriter final : public WriterT<SimParticleContainer> {
 
  private:
   Config m_cfg;
-  std::mutex m_writeMutex;
   TFile* m_outputFile = nullptr;
   TTree* m_outputTree = nullptr;
   /// Event identifier.
@@ -11,6 +11,8 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 #include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <memory>
@@ -71,7 +73,6 @@ class RootPlanarClusterWriter
 
  private:
   Config m_cfg;                    ///< the configuration object
-  std::mutex m_writeMutex;         ///< protect multi-threaded writes
   TFile* m_outputFile;             ///< the output file
   TTree* m_outputTree;             ///< the output tree
   int m_eventNr;                   ///< the event number of
@@ -101,6 +102,8 @@ class RootPlanarClusterWriter
   std::vector<float> m_t_ly;  ///< truth position local y
   std::vector<unsigned long>
       m_t_barcode;  ///< associated truth particle barcode
+
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
 };
 
 }  // namespace ActsExamples
@@ -66,7 +66,6 @@ class RootPropagationStepsWriter
 
  private:
   Config m_cfg;                    ///< the configuration object
-  std::mutex m_writeMutex;         ///< protect multi-threaded writes
   TFile* m_outputFile;             ///< the output file name
   TTree* m_outputTree;             ///< the output tree
   int m_eventNr;                   ///< the event number of
@@ -63,7 +63,6 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
 
  private:
   Config m_cfg;
-  std::mutex m_writeMutex;
   TFile* m_outputFile = nullptr;
   TTree* m_outputTree = nullptr;
   /// Event identifier.
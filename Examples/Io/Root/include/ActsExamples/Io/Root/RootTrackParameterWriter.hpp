@@ -8,7 +8,12 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <mutex>
@@ -74,8 +79,7 @@ class RootTrackParameterWriter final : public TrackParameterWriter {
       const TrackParametersContainer& trackParams) final override;
 
  private:
-  Config m_cfg;             ///< The config class
-  std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
+  Config m_cfg;                  ///< The config class
   TFile* m_outputFile{nullptr};  ///< The output file
   TTree* m_outputTree{nullptr};  ///< The output tree
   int m_eventNr{0};              ///< the event number of
@@ -98,6 +102,14 @@ class RootTrackParameterWriter final : public TrackParameterWriter {
   float m_t_qop{NaNfloat};      ///< Truth parameter qop
   float m_t_time{NaNfloat};     ///< Truth parameter time
   bool m_truthMatched = false;  ///< Whether the seed is matched with truth
+
+  ReadHandle<ProtoTrackContainer> m_inputProtoTracks{this, "InputProtoTracks"};
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
+  ReadHandle<IndexMultimap<Index>> m_inputMeasurementSimHitsMap{
+      this, "InputMeasurementSimHitsMap"};
 };
 
 }  // namespace ActsExamples
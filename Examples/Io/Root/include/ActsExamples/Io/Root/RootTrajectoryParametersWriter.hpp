@@ -9,7 +9,10 @@
 #pragma once
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <mutex>
@@ -75,8 +78,7 @@ class RootTrajectoryParametersWriter final
                      const TrajectoriesContainer& trajectories) final override;
 
  private:
-  Config m_cfg;             ///< The config class
-  std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
+  Config m_cfg;                   ///< The config class
   TFile* m_outputFile{nullptr};   ///< The output file
   TTree* m_outputTree{nullptr};   ///< The output tree
   unsigned int m_eventNr{0};      ///< the event number
@@ -110,6 +112,10 @@ class RootTrajectoryParametersWriter final
   float m_err_eTHETA_fit{-99.};  ///< fitted parameter eTHETA err
   float m_err_eQOP_fit{-99.};    ///< fitted parameter eQOP err
   float m_err_eT_fit{-99.};      ///< fitted parameter eT err
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
 };
 
 }  // namespace ActsExamples
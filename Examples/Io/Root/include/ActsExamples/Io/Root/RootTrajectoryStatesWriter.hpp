@@ -9,7 +9,11 @@
 #pragma once
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
 
 #include <mutex>
@@ -78,8 +82,7 @@ class RootTrajectoryStatesWriter final : public WriterT<TrajectoriesContainer> {
                      const TrajectoriesContainer& trajectories) final override;
 
  private:
-  Config m_cfg;             ///< The config class
-  std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
+  Config m_cfg;                   ///< The config class
   TFile* m_outputFile{nullptr};   ///< The output file
   TTree* m_outputTree{nullptr};   ///< The output tree
   unsigned int m_eventNr{0};      ///< the event number
@@ -192,6 +195,13 @@ class RootTrajectoryStatesWriter final : public WriterT<TrajectoriesContainer> {
       m_pT;  ///< predicted/filtered/smoothed parameter pT
 
   std::vector<float> m_chi2;  ///< chisq from filtering
+
+  ReadHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
+  ReadHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputMeasurementParticlesMap{
+      this, "InputMeasurementParticlesMap"};
+  ReadHandle<IndexMultimap<Index>> m_inputMeasurementSimHitsMap{
+      this, "InputMeasurementSimHitsMap"};
 };
 
 }  // namespace ActsExamples
@@ -112,7 +112,7 @@ ActsExamples::ProcessCode ActsExamples::RootMaterialTrackWriter::writeT(
     const AlgorithmContext& ctx,
     const std::vector<Acts::RecordedMaterialTrack>& materialTracks) {
   // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   // Loop over the material tracks and write them out
   for (auto& mtrack : materialTracks) {
@@ -88,7 +88,7 @@ ActsExamples::ProcessCode ActsExamples::RootParticleWriter::writeT(
   }
 
   // ensure exclusive access to tree/file while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   m_eventId = ctx.eventNumber;
   for (const auto& particle : particles) {
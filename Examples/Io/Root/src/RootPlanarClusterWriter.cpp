@@ -79,6 +79,8 @@ ActsExamples::RootPlanarClusterWriter::RootPlanarClusterWriter(
   m_outputTree->Branch("truth_l_x", &m_t_lx);
   m_outputTree->Branch("truth_l_y", &m_t_ly);
   m_outputTree->Branch("truth_barcode", &m_t_barcode, "truth_barcode/l");
+
+  m_inputSimHits.initialize(m_cfg.inputSimHits);
 }
 
 ActsExamples::RootPlanarClusterWriter::~RootPlanarClusterWriter() {
@@ -102,10 +104,10 @@ ActsExamples::ProcessCode ActsExamples::RootPlanarClusterWriter::writeT(
     const ActsExamples::GeometryIdMultimap<Acts::PlanarModuleCluster>&
         clusters) {
   // retrieve simulated hits
-  const auto& simHits = ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimHits);
+  const auto& simHits = m_inputSimHits(ctx);
 
   // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
   // Get the event number
   m_eventNr = ctx.eventNumber;
 
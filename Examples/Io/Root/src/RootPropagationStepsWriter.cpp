@@ -88,7 +88,7 @@ ActsExamples::ProcessCode ActsExamples::RootPropagationStepsWriter::writeT(
     const AlgorithmContext& context,
     const std::vector<PropagationSteps>& stepCollection) {
   // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   // we get the event number
   m_eventNr = context.eventNumber;
@@ -86,7 +86,7 @@ ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::writeT(
   }
 
   // ensure exclusive access to tree/file while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   // Get the event number
   m_eventId = ctx.eventNumber;
@@ -99,6 +99,9 @@ ActsExamples::RootTrajectoryParametersWriter::RootTrajectoryParametersWriter(
     m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
     m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
   }
+
+  m_inputParticles.initialize(m_cfg.inputParticles);
+  m_inputMeasurementParticlesMap.initialize(m_cfg.inputMeasurementParticlesMap);
 }
 
 ActsExamples::RootTrajectoryParametersWriter::
@@ -122,22 +125,18 @@ ActsExamples::RootTrajectoryParametersWriter::endRun() {
 
 ActsExamples::ProcessCode ActsExamples::RootTrajectoryParametersWriter::writeT(
     const AlgorithmContext& ctx, const TrajectoriesContainer& trajectories) {
-  using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
-
   if (m_outputFile == nullptr)
     return ProcessCode::SUCCESS;
 
   // Read additional input collections
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputMeasurementParticlesMap);
+  const auto& particles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
 
   // For each particle within a track, how many hits did it contribute
   std::vector<ParticleHitCount> particleHitCounts;
 
   // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::lock_guard<InstrumentedMutex> lock(m_writeMutex);
 
   // Get the event number
   m_eventNr = ctx.eventNumber;
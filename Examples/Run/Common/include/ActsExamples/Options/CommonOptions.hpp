@@ -60,7 +60,8 @@ void addOutputOptions(boost::program_options::options_description& opt,
 
 /// Parse options and return the resulting variables map.
 ///
-/// Automatically prints the help text if requested.
+/// Automatically prints the help text if requested and selects the
+/// asynchronous log output if requested.
 ///
 /// @returns Empty variables map if help text was shown.
 boost::program_options::variables_map parse(
@@ -9,6 +9,7 @@
 #include "ActsExamples/Options/CommonOptions.hpp"
 
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Utilities/Options.hpp"
 
 #include <exception>
@@ -27,6 +28,9 @@ ActsExamples::Options::makeDefaultOptions(std::string caption) {
       "loglevel,l", value<size_t>()->default_value(2),
       "The output log level. Please set the wished number (0 = VERBOSE, 1 = "
       "DEBUG, 2 = INFO, 3 = WARNING, 4 = ERROR, 5 = FATAL).");
+  opt.add_options()("log-async", bool_switch(),
+                    "Write log messages on a background thread instead of "
+                    "synchronously from the logging threads.");
   opt.add_options()(
       "response-file", value<std::string>()->default_value(""),
       "Configuration file (response file) replacing command line options.");
@@ -43,7 +47,32 @@ void ActsExamples::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")(
       "jobs,j", value<int>()->default_value(-1),
-      "Number of parallel jobs, negative for automatic.");
+      "Number of parallel jobs, negative for automatic.")(
+      "dataflow", bool_switch(),
+      "Run independent algorithms and writers of an event concurrently.")(
+      "async-writers", bool_switch(),
+      "Run the writers on dedicated threads decoupled from the event "
+      "processing.")("writer-threads", value<size_t>()->default_value(1),
+                     "Number of dedicated writer threads.")(
+      "writer-queue", value<size_t>()->default_value(16),
+      "Maximum number of events waiting for the asynchronous writers.")(
+      "ordered-writes", bool_switch(),
+      "Write events in order with the asynchronous writers.")(
+      "event-arena-size", value<size_t>()->default_value(0),
+      "Initial size in bytes of the per-event memory arena, 0 for default.")(
+      "events-in-flight", value<size_t>()->default_value(0),
+      "Maximum number of events processed concurrently, 0 for no limit.")(
+      "max-rss-mb", value<size_t>()->default_value(0),
+      "Do not start new events above this resident memory in MiB, 0 to "
+      "disable.")(
+      "reader-threads", value<size_t>()->default_value(0),
+      "Number of I/O threads that read events ahead, 0 to disable.")(
+      "prefetch-events", value<size_t>()->default_value(8),
+      "Maximum number of events read ahead by the I/O threads.")(
+      "profile", bool_switch(),
+      "Write per-event timing distributions and thread utilisation.")(
+      "trace-file", value<std::string>()->default_value(""),
+      "Write a Chrome trace of all executions to the given file.");
 }
 
 void ActsExamples::Options::addRandomNumbersOptions(
@@ -170,6 +199,10 @@ boost::program_options::variables_map ActsExamples::Options::parse(
     std::cout << opt << std::endl;
     vm.clear();
   }
+  // must be selected before any logger is created
+  if (vm.count("log-async") and vm["log-async"].as<bool>()) {
+    Acts::Logging::setDefaultAsyncOutput(true);
+  }
   return vm;
 }
 
@@ -187,6 +220,18 @@ ActsExamples::Sequencer::Config ActsExamples::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.dataflowScheduling = vm["dataflow"].as<bool>();
+  cfg.asyncWriters = vm["async-writers"].as<bool>();
+  cfg.numWriterThreads = vm["writer-threads"].as<size_t>();
+  cfg.writerQueueCapacity = vm["writer-queue"].as<size_t>();
+  cfg.orderedWrites = vm["ordered-writes"].as<bool>();
+  cfg.eventArenaSize = vm["event-arena-size"].as<size_t>();
+  cfg.maxEventsInFlight = vm["events-in-flight"].as<size_t>();
+  cfg.maxResidentMemory = vm["max-rss-mb"].as<size_t>() * 1024u * 1024u;
+  cfg.numReaderThreads = vm["reader-threads"].as<size_t>();
+  cfg.prefetchEvents = vm["prefetch-events"].as<size_t>();
+  cfg.profiling = vm["profile"].as<bool>();
+  cfg.traceFile = vm["trace-file"].as<std::string>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
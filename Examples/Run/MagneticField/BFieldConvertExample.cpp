@@ -0,0 +1,56 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/BFieldMapFile.hpp"
+#include "ActsExamples/MagneticField/MagneticField.hpp"
+#include "ActsExamples/MagneticField/MagneticFieldOptions.hpp"
+#include "ActsExamples/Options/CommonOptions.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+/// The main executable
+///
+/// Reads a magnetic field map from a ROOT or text file and converts it into
+/// the binary field map format that can be memory-mapped directly.
+int main(int argc, char* argv[]) {
+  using boost::program_options::value;
+
+  // setup and parse options
+  auto desc = ActsExamples::Options::makeDefaultOptions();
+  ActsExamples::Options::addMagneticFieldOptions(desc);
+  desc.add_options()("bf-file-out",
+                     value<std::string>()->default_value("BField.bfm"),
+                     "Set this name for the output binary field map file.");
+  auto vm = ActsExamples::Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  auto bField = ActsExamples::Options::readMagneticField(vm);
+  auto out = vm["bf-file-out"].as<std::string>();
+
+  if (auto bField2D = std::dynamic_pointer_cast<
+          const ActsExamples::detail::InterpolatedMagneticField2>(bField);
+      bField2D) {
+    Acts::writeBFieldMapFile(out, bField2D->getMapper());
+  } else if (auto bField3D = std::dynamic_pointer_cast<
+                 const ActsExamples::detail::InterpolatedMagneticField3>(
+                 bField);
+             bField3D) {
+    Acts::writeBFieldMapFile(out, bField3D->getMapper());
+  } else {
+    std::cout << "Bfield map could not be read. Exiting." << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Wrote binary field map to '" << out << "'" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/AdaptiveBFieldMapper.hpp"
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+// Compares the memory footprint and the lookup performance of a large 3D field
+// map for the different storage policies of the grid values and for the map
+// with adaptive cell sizes. The field values are sampled from a solenoid
+// field.
+int main(int argc, char* argv[]) {
+  size_t nBinsXY = 120;
+  size_t nBinsZ = 240;
+  size_t runs = 20;
+  if (argc >= 2) {
+    nBinsXY = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nBinsZ = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    runs = std::stoi(argv[3]);
+  }
+
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  const double xyMax = 1.5 * R;
+  const double zMax = L;
+
+  // the full 3D map is sampled from a coarse r/z map of the solenoid since
+  // evaluating the analytical solenoid field for every grid point is too slow
+  std::cout << "Building r/z field map of solenoid" << std::endl;
+  Acts::SolenoidBField bSolenoidField({R, L, 1154, 2_T});
+  auto solenoidMapper = Acts::solenoidFieldMapper(
+      {0, 1.5 * xyMax}, {-1.5 * zMax, 1.5 * zMax}, {50, 100}, bSolenoidField);
+  using SolenoidMap_t = Acts::InterpolatedBFieldMap<decltype(solenoidMapper)>;
+  SolenoidMap_t solenoidMap(SolenoidMap_t::Config(std::move(solenoidMapper)));
+
+  std::cout << "Building " << nBinsXY << "x" << nBinsXY << "x" << nBinsZ
+            << " field map" << std::endl;
+  using Axis_t = Acts::detail::EquidistantAxis;
+  using Grid_t = Acts::detail::Grid<Acts::Vector3, Axis_t, Axis_t, Axis_t>;
+  Grid_t grid(std::make_tuple(Axis_t(-xyMax, xyMax, nBinsXY),
+                              Axis_t(-xyMax, xyMax, nBinsXY),
+                              Axis_t(-zMax, zMax, nBinsZ)));
+  for (size_t i = 1; i <= nBinsXY; ++i) {
+    for (size_t j = 1; j <= nBinsXY; ++j) {
+      for (size_t k = 1; k <= nBinsZ; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        const auto& ll = grid.lowerLeftBinEdge(indices);
+        grid.atLocalBins(indices) =
+            solenoidMap.getField(Acts::Vector3(ll[0], ll[1], ll[2]));
+      }
+    }
+  }
+  grid.setExteriorBins(Acts::Vector3::Zero());
+
+  Acts::InterpolatedBFieldMapper<Grid_t> mapper(
+      [](const Acts::Vector3& pos) { return pos; },
+      [](const Acts::Vector3& field, const Acts::Vector3& /*pos*/) {
+        return field;
+      },
+      std::move(grid));
+
+  // positions are generated upfront so the benchmarks measure the lookup only.
+  // there are enough random positions to touch most of the map in each run.
+  std::minstd_rand rng;
+  std::uniform_real_distribution<> xyDist(-0.99 * xyMax, 0.99 * xyMax);
+  std::uniform_real_distribution<> zDist(-0.99 * zMax, 0.99 * zMax);
+  std::vector<Acts::Vector3> randomPositions(1 << 20);
+  for (auto& pos : randomPositions) {
+    pos = {xyDist(rng), xyDist(rng), zDist(rng)};
+  }
+  // positions advancing along a straight line from the center
+  std::vector<Acts::Vector3> advancingPositions(1 << 20);
+  {
+    Acts::Vector3 dir(xyDist(rng), xyDist(rng), zDist(rng));
+    dir *= 0.9 / advancingPositions.size();
+    for (size_t i = 0; i < advancingPositions.size(); ++i) {
+      advancingPositions[i] = i * dir;
+    }
+  }
+
+  std::ofstream os{"bfield_storage_bench.csv"};
+  os << "name,bytes,max_deviation,runs,iters,iter_time_average,iter_time_error"
+     << std::endl;
+  Acts::MagneticFieldContext mctx{};
+
+  // the memory of the grid values; the per-region scales of the fixed-point
+  // storage add less than one percent and are not included
+  auto gridBytes = [](const auto& storageMapper) {
+    using Mapper_t = std::decay_t<decltype(storageMapper)>;
+    return storageMapper.getGrid().size() *
+           sizeof(typename Mapper_t::Grid_t::value_type);
+  };
+
+  auto benchmark = [&](const std::string& name, auto storageMapper,
+                       size_t bytes) {
+    using Mapper_t = decltype(storageMapper);
+    using BField_t = Acts::InterpolatedBFieldMap<Mapper_t>;
+    BField_t bField(typename BField_t::Config(std::move(storageMapper)));
+
+    double maxDeviation = 0;
+    for (const auto& pos : randomPositions) {
+      maxDeviation = std::max(
+          maxDeviation, (bField.getField(pos) - mapper.getField(pos)).norm());
+    }
+    std::cout << name << ": " << bytes / 1e6 << " MB, max deviation "
+              << maxDeviation / 1_T << " T" << std::endl;
+
+    auto csv = [&](const std::string& variant, auto res) {
+      os << name << "_" << variant << "," << bytes << "," << maxDeviation << ","
+         << res.run_timings.size() << "," << res.iters_per_run << ","
+         << res.iterTimeAverage().count() << ","
+         << 1.96 * res.iterTimeError().count() << std::endl;
+    };
+
+    std::cout << "Benchmarking random " << name
+              << " field lookup: " << std::flush;
+    const auto random_result = Acts::Test::microBenchmark(
+        [&](const Acts::Vector3& pos) { return bField.getField(pos); },
+        randomPositions, runs);
+    std::cout << random_result << std::endl;
+    csv("random", random_result);
+
+    std::cout << "Benchmarking cached advancing " << name
+              << " field lookup: " << std::flush;
+    auto cache = bField.makeCache(mctx);
+    const auto adv_result = Acts::Test::microBenchmark(
+        [&](const Acts::Vector3& pos) { return bField.getField(pos, cache); },
+        advancingPositions, runs);
+    std::cout << adv_result << std::endl;
+    csv("cache_adv", adv_result);
+  };
+
+  benchmark("double", mapper, gridBytes(mapper));
+  auto floatMapper = mapper.compress<Acts::FloatBFieldStorage<3>>();
+  benchmark("float", floatMapper, gridBytes(floatMapper));
+  auto fixedMapper = mapper.compress<Acts::FixedPointBFieldStorage<3>>();
+  benchmark("fixed16", fixedMapper, gridBytes(fixedMapper));
+
+  for (double tolerance : {1e-3_T, 1e-2_T}) {
+    std::cout << "Building adaptive field map with tolerance "
+              << tolerance / 1_T << " T" << std::endl;
+    Acts::AdaptiveBFieldMapper adaptiveMapper(mapper, tolerance);
+    std::cout << adaptiveMapper.numValues() << " field values" << std::endl;
+    size_t bytes = adaptiveMapper.memoryUsage();
+    benchmark("adaptive_" + std::to_string(tolerance / 1_T),
+              std::move(adaptiveMapper), bytes);
+  }
+}
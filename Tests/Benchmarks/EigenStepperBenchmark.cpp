@@ -11,7 +11,9 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/DormandPrinceStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -24,11 +26,56 @@ namespace po = boost::program_options;
 using namespace Acts;
 using namespace Acts::UnitLiterals;
 
+/// Constant field which counts its evaluations
+class CountingBField final : public MagneticFieldProvider {
+ public:
+  CountingBField(const ConstantBField& field) : m_field(field) {}
+
+  MagneticFieldProvider::Cache makeCache(
+      const MagneticFieldContext& mctx) const override {
+    return m_field.makeCache(mctx);
+  }
+
+  Vector3 getField(const Vector3& position) const override {
+    ++evaluations;
+    return m_field.getField(position);
+  }
+
+  Vector3 getField(const Vector3& position,
+                   MagneticFieldProvider::Cache& cache) const override {
+    ++evaluations;
+    return m_field.getField(position, cache);
+  }
+
+  double homogeneousDistance(
+      const Vector3& position,
+      MagneticFieldProvider::Cache& cache) const override {
+    return m_field.homogeneousDistance(position, cache);
+  }
+
+  Vector3 getFieldGradient(const Vector3& position,
+                           ActsMatrix<3, 3>& derivative) const override {
+    return m_field.getFieldGradient(position, derivative);
+  }
+
+  Vector3 getFieldGradient(
+      const Vector3& position, ActsMatrix<3, 3>& derivative,
+      MagneticFieldProvider::Cache& cache) const override {
+    return m_field.getFieldGradient(position, derivative, cache);
+  }
+
+  mutable size_t evaluations = 0;
+
+ private:
+  ConstantBField m_field;
+};
+
 int main(int argc, char* argv[]) {
   unsigned int toys = 1;
   double ptInGeV = 1;
   double BzInT = 1;
   double maxPathInM = 1;
+  double tolerance = 1e-4;
   unsigned int lvl = Acts::Logging::INFO;
   bool withCov = true;
 
@@ -46,6 +93,7 @@ int main(int argc, char* argv[]) {
       ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
       ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
       ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("tolerance",po::value<double>(&tolerance)->default_value(1e-4),"local error tolerance of the adaptive step size")
       ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
     // clang-format on
     po::variables_map vm;
@@ -69,16 +117,14 @@ int main(int argc, char* argv[]) {
                            << "GeV in a " << BzInT << "T B-field");
 
   using BField_type = ConstantBField;
-  using Stepper_type = EigenStepper<>;
-  using Propagator_type = Propagator<Stepper_type>;
   using Covariance = BoundSymMatrix;
 
   auto bField = std::make_shared<BField_type>(0, 0, BzInT * UnitConstants::T);
-  Stepper_type atlas_stepper(std::move(bField));
-  Propagator_type propagator(std::move(atlas_stepper));
+  auto countingBField = std::make_shared<CountingBField>(*bField);
 
   PropagatorOptions<> options(tgContext, mfContext, getDummyLogger());
   options.pathLimit = maxPathInM * UnitConstants::m;
+  options.tolerance = tolerance;
 
   Vector4 pos4(0, 0, 0, 0);
   Vector3 dir(1, 0, 0);
@@ -98,25 +144,79 @@ int main(int argc, char* argv[]) {
   }
   CurvilinearTrackParameters pars(pos4, dir, ptInGeV, +1, covOpt);
 
-  double totalPathLength = 0;
-  size_t num_iters = 0;
-  const auto propagation_bench_result = Acts::Test::microBenchmark(
-      [&] {
-        auto r = propagator.propagate(pars, options).value();
-        if (totalPathLength == 0.) {
-          ACTS_DEBUG("reached position "
-                     << r.endParameters->position(tgContext).transpose()
-                     << " in " << r.steps << " steps");
-        }
-        totalPathLength += r.pathLength;
-        ++num_iters;
-        return r;
-      },
-      1, toys);
-
-  ACTS_INFO("Execution stats: " << propagation_bench_result);
-  ACTS_INFO("average path length = " << totalPathLength / num_iters / 1_mm
-                                     << "mm");
+  // Analytic end position of the helix in the transverse plane
+  const double omega = BzInT * UnitConstants::T / (ptInGeV * 1_GeV);
+  auto helixPosition = [&](double s) {
+    return Vector3(std::sin(omega * s) / omega,
+                   (std::cos(omega * s) - 1.) / omega, 0.);
+  };
+
+  // The field is either accessed through the MagneticFieldProvider interface
+  // or as the concrete field type known at compile time
+  auto benchmark = [&](auto stepper, const std::string& name) {
+    using Propagator_type = Propagator<decltype(stepper)>;
+    Propagator_type propagator(std::move(stepper));
+
+    double totalPathLength = 0;
+    size_t totalSteps = 0;
+    size_t num_iters = 0;
+    double maxDeviation = 0;
+    countingBField->evaluations = 0;
+    const auto propagation_bench_result = Acts::Test::microBenchmark(
+        [&] {
+          auto r = propagator.propagate(pars, options).value();
+          const Vector3 position = r.endParameters->position(tgContext);
+          if (totalPathLength == 0.) {
+            ACTS_DEBUG("reached position " << position.transpose() << " in "
+                                           << r.steps << " steps");
+          }
+          maxDeviation = std::max(
+              maxDeviation, (position - helixPosition(r.pathLength)).norm());
+          totalPathLength += r.pathLength;
+          totalSteps += r.steps;
+          ++num_iters;
+          return r;
+        },
+        1, toys);
+
+    ACTS_INFO("Execution stats (" << name
+                                  << "): " << propagation_bench_result);
+    ACTS_INFO("average path length = " << totalPathLength / num_iters / 1_mm
+                                       << "mm");
+    ACTS_INFO("average number of steps = "
+              << static_cast<double>(totalSteps) / num_iters);
+    if (countingBField->evaluations != 0) {
+      ACTS_INFO("average number of field evaluations = "
+                << static_cast<double>(countingBField->evaluations) /
+                       num_iters);
+    }
+    ACTS_INFO("deviation from the helix = " << maxDeviation / 1_um << "um");
+  };
+
+  benchmark(EigenStepper<>(countingBField), "MagneticFieldProvider");
+  benchmark(EigenStepper<StepperExtensionList<DefaultExtension>,
+                         detail::VoidAuctioneer, BField_type>(bField),
+            "ConstantBField");
+  // Without covariance transport support the Jacobians are removed at compile
+  // time, compare to the runtime flag with --cov 0
+  using FreeStepper = EigenStepper<StepperExtensionList<DefaultExtension>,
+                                   detail::VoidAuctioneer,
+                                   MagneticFieldProvider, false>;
+  using StaticFreeStepper = EigenStepper<StepperExtensionList<DefaultExtension>,
+                                         detail::VoidAuctioneer, BField_type,
+                                         false>;
+  ACTS_INFO("stepper state size = " << sizeof(EigenStepper<>::State)
+                                    << " bytes, without covariance transport "
+                                    << sizeof(FreeStepper::State) << " bytes");
+  benchmark(FreeStepper(countingBField),
+            "no covariance, MagneticFieldProvider");
+  benchmark(StaticFreeStepper(bField), "no covariance, ConstantBField");
+  benchmark(DormandPrinceStepper<>(countingBField),
+            "DormandPrince, MagneticFieldProvider");
+  benchmark(DormandPrinceStepper<BField_type>(bField),
+            "DormandPrince, ConstantBField");
+  benchmark(HelixStepper<>(countingBField), "Helix, MagneticFieldProvider");
+  benchmark(HelixStepper<BField_type>(bField), "Helix, ConstantBField");
 
   return 0;
 }
@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/NavigatorPolicies.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <iostream>
+#include <random>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  unsigned int toys = 1;
+  unsigned int tracks = 1;
+  double BzInT = 1;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  // Create a test context
+  GeometryContext tgContext = GeometryContext();
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(20),"number of repetitions")
+      ("tracks",po::value<unsigned int>(&tracks)->default_value(1000),"number of tracks to propagate per repetition")
+      ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("Navigator", Acts::Logging::Level(lvl)));
+
+  // print information about profiling setup
+  ACTS_INFO("propagating " << toys << " times " << tracks
+                           << " tracks through the cylindrical geometry in a "
+                           << BzInT << "T B-field");
+
+  Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  auto bField = std::make_shared<ConstantBField>(0, 0, BzInT * 1_T);
+
+  // Random directions and momenta
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<double> ptDist(0.5_GeV, 10_GeV);
+  std::vector<CurvilinearTrackParameters> start;
+  for (unsigned int i = 0; i < tracks; ++i) {
+    const double theta = 2. * std::atan(std::exp(-etaDist(rng)));
+    start.emplace_back(Vector4(0, 0, 0, 0), phiDist(rng), theta,
+                       ptDist(rng) / std::sin(theta),
+                       (i % 2 == 0) ? 1_e : -1_e,
+                       BoundSymMatrix::Identity());
+  }
+
+  auto benchmark = [&](auto navigator, const std::string& name) {
+    using Stepper = EigenStepper<>;
+    Propagator<Stepper, decltype(navigator)> propagator(Stepper{bField},
+                                                        std::move(navigator));
+    PropagatorOptions<> options(tgContext, mfContext, getDummyLogger());
+    size_t totalSteps = 0;
+    const auto result = Acts::Test::microBenchmark(
+        [&] {
+          for (const auto& par : start) {
+            totalSteps += propagator.propagate(par, options).value().steps;
+          }
+          return totalSteps;
+        },
+        1, toys);
+    ACTS_INFO("Execution stats (" << name << "): " << result);
+  };
+  benchmark(Navigator{tGeometry}, "std::vector candidates");
+  benchmark(NavigatorT<SmallBufferNavigatorPolicy<>>{tGeometry},
+            "small buffer candidates");
+
+  return 0;
+}
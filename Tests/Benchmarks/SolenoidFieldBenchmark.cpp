@@ -12,6 +12,7 @@
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iostream>
@@ -90,6 +91,49 @@ int main(int argc, char* argv[]) {
   std::cout << solenoid_result << std::endl;
   csv("solenoid", solenoid_result);
 
+  // The batch lookup evaluates several independent positions with a single
+  // call, e.g. the positions of several tracks propagated together. Each
+  // iteration evaluates `batchSize` positions.
+  const size_t batchSize = 8;
+  Acts::MagneticFieldProvider::BatchMatrix batchPositions(3, batchSize);
+  Acts::MagneticFieldProvider::BatchMatrix batchFields(3, batchSize);
+  {
+    std::cout << "Benchmarking random SolenoidBField batch lookup ("
+              << batchSize << " positions): " << std::flush;
+    auto cache = bSolenoidField.makeCache(mctx);
+    const auto solenoid_batch_result = Acts::Test::microBenchmark(
+        [&] {
+          for (size_t i = 0; i < batchSize; ++i) {
+            batchPositions.col(i) = genPos();
+          }
+          bSolenoidField.getFieldBatch(batchPositions, batchFields, cache);
+          return batchFields(2, batchSize - 1);
+        },
+        iters_solenoid, std::max<size_t>(runs_solenoid / batchSize, 1));
+    std::cout << solenoid_batch_result << std::endl;
+    csv("solenoid_batch", solenoid_batch_result);
+  }
+
+  // The tabulated SolenoidBField interpolates an r/z table that is built from
+  // the analytic solution on first use.
+  {
+    Acts::SolenoidBField bSolenoidTable({R, L, nCoils, bMagCenter},
+                                        Acts::SolenoidBField::TableConfig());
+    std::cout << "Building SolenoidBField table: " << std::flush;
+    const auto start = std::chrono::steady_clock::now();
+    bSolenoidTable.getField(Acts::Vector3(0, 0, 0));
+    const std::chrono::duration<double> buildTime =
+        std::chrono::steady_clock::now() - start;
+    std::cout << buildTime.count() << " s" << std::endl;
+
+    std::cout << "Benchmarking random tabulated SolenoidBField lookup: "
+              << std::flush;
+    const auto solenoid_table_result = Acts::Test::microBenchmark(
+        [&] { return bSolenoidTable.getField(genPos()); }, iters_map);
+    std::cout << solenoid_table_result << std::endl;
+    csv("solenoid_table", solenoid_table_result);
+  }
+
   // ...but for interpolated B-field map, the overhead of a field lookup is
   // comparable to that of generating a random position, so we must be more
   // careful. Hence we do two microbenchmarks which represent a kind of
@@ -187,4 +231,42 @@ int main(int argc, char* argv[]) {
     std::cout << map_adv_result_cache << std::endl;
     csv("interp_cache_adv", map_adv_result_cache);
   }
+
+  // - These variations of the fifth benchmark advance several points in
+  //   parallel along close-by straight lines, as for several tracks propagated
+  //   together. The points are reset regularly to stay within the map. The
+  //   points are either evaluated one by one or with a single batch lookup
+  //   per iteration.
+  for (bool batch : {false, true}) {
+    std::cout << "Benchmarking cached advancing interpolated field "
+              << (batch ? "batch" : "loop") << " lookup (" << batchSize
+              << " positions): " << std::flush;
+    auto cache = bFieldMap.makeCache(mctx);
+    Acts::Vector3 dir{};
+    dir.setRandom();
+    double h = 1e-3;
+    size_t nSteps = 0;
+    const auto map_adv_batch_result_cache = Acts::Test::microBenchmark(
+        [&] {
+          if ((nSteps++ % 1000000) == 0) {
+            for (size_t i = 0; i < batchSize; ++i) {
+              batchPositions.col(i) = Acts::Vector3(0, 0, 1e-2 * i);
+            }
+          }
+          batchPositions.colwise() += dir * h;
+          if (batch) {
+            bFieldMap.getFieldBatch(batchPositions, batchFields, cache);
+          } else {
+            for (size_t i = 0; i < batchSize; ++i) {
+              batchFields.col(i) =
+                  bFieldMap.getField(batchPositions.col(i), cache);
+            }
+          }
+          return batchFields(2, batchSize - 1);
+        },
+        iters_map);
+    std::cout << map_adv_batch_result_cache << std::endl;
+    csv(batch ? "interp_cache_adv_batch" : "interp_cache_adv_loop",
+        map_adv_batch_result_cache);
+  }
 }
@@ -0,0 +1,122 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/BoundaryNavigationTable.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <random>
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(BoundaryNavigationTableCandidates) {
+  auto volume = TrackingVolume::create(
+      Transform3::Identity(),
+      std::make_shared<CuboidVolumeBounds>(10_mm, 20_mm, 30_mm));
+  BOOST_CHECK(volume->boundaryNavigationTable() == nullptr);
+  volume->createBoundaryNavigationTables(tgContext, 4);
+  const auto* table = volume->boundaryNavigationTable();
+  BOOST_REQUIRE(table != nullptr);
+  BOOST_CHECK_EQUAL(table->nBins(), 4u);
+
+  // Only the faces in front can be reached
+  for (const Vector3& direction :
+       {Vector3(1., 0.1, 0.2), Vector3(-1., -1., -1.), Vector3(0., 0., 1.)}) {
+    const auto& candidates = table->candidates(direction);
+    BOOST_CHECK_EQUAL(candidates.size(), 3u);
+    for (const auto* bs : candidates) {
+      const Vector3 center = bs->surfaceRepresentation().center(tgContext);
+      BOOST_CHECK_GE(center.dot(direction), 0.);
+    }
+  }
+
+  // Replacing a boundary drops the table
+  volume->updateBoundarySurface(negativeFaceXY,
+                                volume->boundarySurfaces()[negativeFaceXY]);
+  BOOST_CHECK(volume->boundaryNavigationTable() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(BoundaryNavigationTableCompatibleBoundaries) {
+  Transform3 transform(AngleAxis3(0.3, Vector3(1., 2., 3.).normalized()));
+  transform.translation() = Vector3(20_mm, -10_mm, 50_mm);
+  const std::vector<MutableTrackingVolumePtr> volumes = {
+      TrackingVolume::create(
+          transform, std::make_shared<CuboidVolumeBounds>(10_mm, 20_mm, 30_mm)),
+      TrackingVolume::create(transform, std::make_shared<CylinderVolumeBounds>(
+                                            10_mm, 50_mm, 80_mm)),
+      TrackingVolume::create(transform,
+                             std::make_shared<CylinderVolumeBounds>(
+                                 10_mm, 50_mm, 80_mm, 0.5 * M_PI, 0.2))};
+
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+
+  for (const auto& volume : volumes) {
+    // Random positions inside the volume and random directions
+    std::vector<std::pair<Vector3, Vector3>> rays;
+    while (rays.size() < 1000) {
+      const Vector3 position =
+          transform * Vector3(uniform(rng) * 50_mm, uniform(rng) * 50_mm,
+                              uniform(rng) * 80_mm);
+      if (volume->inside(position)) {
+        rays.emplace_back(
+            position,
+            Vector3(uniform(rng), uniform(rng), uniform(rng)).normalized());
+      }
+    }
+    // The boundaries in both navigation directions, without table
+    auto intersect = [&](const std::pair<Vector3, Vector3>& ray,
+                         NavigationDirection navDir) {
+      NavigationOptions<Surface> options(navDir, true);
+      return volume->compatibleBoundaries(tgContext, ray.first, ray.second,
+                                          options);
+    };
+    std::vector<std::vector<BoundaryIntersection>> expected;
+    for (const auto& ray : rays) {
+      for (auto navDir : {forward, backward}) {
+        expected.push_back(intersect(ray, navDir));
+      }
+    }
+
+    // The table gives the same closest boundary
+    volume->createBoundaryNavigationTables(tgContext, 3);
+    auto iExpected = expected.begin();
+    for (const auto& ray : rays) {
+      for (auto navDir : {forward, backward}) {
+        auto intersections = intersect(ray, navDir);
+        BOOST_REQUIRE_EQUAL(intersections.empty(), iExpected->empty());
+        if (!intersections.empty()) {
+          BOOST_CHECK_EQUAL(intersections.front().object,
+                            iExpected->front().object);
+          CHECK_CLOSE_ABS(intersections.front().intersection.pathLength,
+                          iExpected->front().intersection.pathLength, 1e-12);
+        }
+        ++iExpected;
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -10,13 +10,21 @@
 #include <boost/test/tools/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/CuboidVolumeBounds.hpp"
 #include "Acts/Geometry/GenericApproachDescriptor.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/LayerCreator.hpp"
+#include "Acts/Geometry/ProtoLayer.hpp"
 #include "Acts/Geometry/SurfaceArrayCreator.hpp"
+#include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <algorithm>
+#include <random>
 
 #include "LayerStub.hpp"
 
@@ -97,6 +105,77 @@ BOOST_AUTO_TEST_CASE(LayerProperties, *utf::expected_failures(1)) {
   BOOST_CHECK_EQUAL(layerStub.layerType(), LayerType::passive);
 }
 
+/// Unit test for the sensitive surface hierarchy
+BOOST_AUTO_TEST_CASE(LayerSurfaceHierarchy) {
+  using namespace Acts::UnitLiterals;
+
+  // A cylinder layer with a binning which does not match the modules
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto surfaces = cGeometry.surfacesCylinder(cGeometry.detectorStore, 8.4,
+                                             36., 0.15, 0.145, 116., 2_mm,
+                                             5_mm, {52, 14});
+  std::vector<std::shared_ptr<const Surface>> surfacePtrs;
+  for (const auto* sf : surfaces) {
+    surfacePtrs.push_back(sf->getSharedPtr());
+  }
+  ProtoLayer protoLayer(tgContext, surfaces);
+  protoLayer.envelope[binR] = {0.5, 0.5};
+  LayerCreator::Config lcConfig;
+  lcConfig.surfaceArrayCreator = std::make_shared<const SurfaceArrayCreator>();
+  LayerCreator layerCreator(lcConfig);
+  auto layer = layerCreator.cylinderLayer(tgContext, surfacePtrs, 13, 3,
+                                          protoLayer);
+  BOOST_CHECK(layer->surfaceHierarchy() == nullptr);
+
+  // Rays from the module centers into random directions
+  std::mt19937 rng(4321);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  std::uniform_int_distribution<size_t> module(0, surfaces.size() - 1);
+  std::vector<std::pair<Vector3, Vector3>> rays;
+  for (size_t i = 0; i < 500; ++i) {
+    rays.emplace_back(
+        surfaces[module(rng)]->center(tgContext),
+        Vector3(uniform(rng), uniform(rng), uniform(rng)).normalized());
+  }
+  NavigationOptions<Surface> options(forward, true, true, false, false);
+  auto sensitive = [&](const std::pair<Vector3, Vector3>& ray) {
+    std::vector<const Surface*> found;
+    for (const auto& sfi : layer->compatibleSurfaces(tgContext, ray.first,
+                                                     ray.second, options)) {
+      if (sfi.object != &layer->surfaceRepresentation()) {
+        found.push_back(sfi.object);
+      }
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+  };
+  std::vector<std::vector<const Surface*>> neighbours;
+  for (const auto& ray : rays) {
+    neighbours.push_back(sensitive(ray));
+  }
+
+  // An envelope larger than the layer tests all modules
+  layer->createSurfaceHierarchy(tgContext, 3, 1_m);
+  BOOST_CHECK(layer->surfaceHierarchy() != nullptr);
+  std::vector<std::vector<const Surface*>> all;
+  for (const auto& ray : rays) {
+    all.push_back(sensitive(ray));
+  }
+
+  // The hierarchy finds the same modules as testing all of them, which
+  // includes the ones from the neighbour lookup
+  layer->createSurfaceHierarchy(tgContext);
+  size_t nFound = 0;
+  for (size_t i = 0; i < rays.size(); ++i) {
+    const auto found = sensitive(rays[i]);
+    BOOST_CHECK(found == all[i]);
+    BOOST_CHECK(std::includes(found.begin(), found.end(),
+                              neighbours[i].begin(), neighbours[i].end()));
+    nFound += found.size();
+  }
+  BOOST_CHECK_GE(nFound, rays.size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Layers
 }  // namespace Test
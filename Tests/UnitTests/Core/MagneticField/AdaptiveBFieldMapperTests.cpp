@@ -0,0 +1,150 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/AdaptiveBFieldMapper.hpp"
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using Acts::VectorHelpers::perp;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+// uniform field dropping to zero between |z| = 1.5m and |z| = 2.5m, sampled
+// on 65x129 points
+auto stepFieldMapper() {
+  std::vector<double> rPos;
+  std::vector<double> zPos;
+  for (size_t i = 0; i < 65; ++i) {
+    rPos.push_back(i * 2_m / 64);
+  }
+  for (size_t i = 0; i < 129; ++i) {
+    zPos.push_back(-4_m + i * 8_m / 128);
+  }
+  std::vector<Vector2> bField;
+  for (double z : zPos) {
+    for (double r : rPos) {
+      double t = std::clamp((std::abs(z) - 1.5_m) / 1_m, 0., 1.);
+      double bz = 2_T * std::pow(std::cos(0.5 * M_PI * t), 2);
+      bField.emplace_back(r * bz / 2_m, bz);
+    }
+  }
+  return fieldMapperRZ(
+      [](std::array<size_t, 2> bins, std::array<size_t, 2> sizes) {
+        return (bins[1] * sizes[0] + bins[0]);
+      },
+      rPos, zPos, bField, 1., 1.);
+}
+
+std::vector<Vector3> testPositions() {
+  std::vector<Vector3> positions;
+  for (double t = 0.; t < 1.; t += 1. / 1024) {
+    double r = 2_m * t;
+    double phi = 7 * t;
+    positions.emplace_back(r * std::cos(phi), r * std::sin(phi),
+                           -4_m + 8_m * std::fmod(13 * t, 1.));
+  }
+  return positions;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(AdaptiveBFieldMapper_rz) {
+  auto source = stepFieldMapper();
+  size_t sourceBins = source.getNBins()[0] * source.getNBins()[1];
+
+  const double tolerance = 0.001_T;
+  AdaptiveBFieldMapper mapper(source, tolerance);
+  BOOST_CHECK_LT(mapper.numValues(), sourceBins / 2);
+  BOOST_CHECK(mapper.getMin() == source.getMin());
+  BOOST_CHECK(mapper.getMax() == source.getMax());
+
+  // the cached field cells of the adaptive map are used by the field provider.
+  // the cell corners are rotated at the first position in the cell, i.e. only
+  // the transverse and longitudinal components agree with the direct lookup
+  using BField_t = InterpolatedBFieldMap<decltype(mapper)>;
+  BField_t bField(BField_t::Config{mapper});
+  auto cache = bField.makeCache(MagneticFieldContext());
+  for (const auto& pos : testPositions()) {
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      BOOST_CHECK(mapper.isInside(pos));
+      BOOST_CHECK_LE((mapper.getField(pos) - source.getField(pos)).norm(),
+                     tolerance * (1 + 1e-9));
+      CHECK_CLOSE_ABS(bField.getField(pos), mapper.getField(pos), 1e-12);
+      Vector3 cached = bField.getField(pos, cache);
+      CHECK_CLOSE_ABS(perp(cached), perp(mapper.getField(pos)), 1e-12);
+      CHECK_CLOSE_ABS(cached.z(), mapper.getField(pos).z(), 1e-12);
+      auto cell = mapper.getFieldCell(pos);
+      BOOST_CHECK(cell.isInside(pos));
+      CHECK_CLOSE_ABS(cell.getField(pos), mapper.getField(pos), 1e-12);
+    }
+  }
+  BOOST_CHECK(not mapper.isInside(Vector3(0., 0., 10_m)));
+
+  // without tolerance the source map is reproduced
+  AdaptiveBFieldMapper exact(source, 0.);
+
+  for (const auto& pos : testPositions()) {
+    CHECK_CLOSE_ABS(exact.getField(pos), source.getField(pos), 1e-12);
+  }
+
+  BOOST_CHECK_THROW(AdaptiveBFieldMapper(source, -1.), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveBFieldMapper_xyz) {
+  std::vector<double> pos;
+  for (size_t i = 0; i < 17; ++i) {
+    pos.push_back(-2. + 0.25 * i);
+  }
+  std::vector<Vector3> bField;
+  for (double x : pos) {
+    for (double y : pos) {
+      for (double z : pos) {
+        bField.emplace_back(x + 2 * y, 1., z);
+      }
+    }
+  }
+  auto source = fieldMapperXYZ(
+      [](std::array<size_t, 3> bins, std::array<size_t, 3> sizes) {
+        return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] +
+                bins[2]);
+      },
+      pos, pos, pos, bField, 1., 1.);
+
+  // the field is linear except towards the zero field at the upper edges of
+  // the map, i.e. the blocks in the interior have a single cell
+  auto check = [&](const auto& mapper) {
+    BOOST_CHECK_LT(mapper.numValues(), 17u * 17u * 17u / 2);
+    for (double t = 0.; t < 1.; t += 1. / 64) {
+      Vector3 p(-2. + 4.2 * t, 2.2 - 4.2 * t, -2. + 4.2 * std::fmod(5 * t, 1.));
+      CHECK_CLOSE_ABS(mapper.getField(p), source.getField(p), 1e-5);
+    }
+  };
+  check(AdaptiveBFieldMapper(source, 1e-9, 4));
+  check(AdaptiveBFieldMapper(source.compress<FloatBFieldStorage<3>>(), 1e-6,
+                             4));
+
+  BOOST_CHECK_THROW(AdaptiveBFieldMapper(source, 1e-9, 6),
+                    std::invalid_argument);
+}
+
+}  // namespace Test
+}  // namespace Acts
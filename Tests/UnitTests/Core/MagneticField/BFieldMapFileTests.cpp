@@ -0,0 +1,217 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/MagneticField/BFieldMapFile.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+// positions inside the maps below in both r/z and x/y/z
+std::vector<Vector3> testPositions() {
+  std::vector<Vector3> positions;
+  for (double t = 0.; t < 1.; t += 0.0625) {
+    positions.emplace_back(0.1 + 1.3 * t, 1.4 - 1.3 * t, -1.9 + 3.8 * t);
+  }
+  return positions;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BFieldMapFile_rz) {
+  std::vector<double> rPos = {0., 1., 2., 3.};
+  std::vector<double> zPos = {-2., -1., 0., 1., 2.};
+  std::vector<Vector2> bField;
+  for (double z : zPos) {
+    for (double r : rPos) {
+      bField.emplace_back(r * z, 2 + z * z);
+    }
+  }
+  auto mapper = fieldMapperRZ(
+      [](std::array<size_t, 2> bins, std::array<size_t, 2> sizes) {
+        return (bins[1] * sizes[0] + bins[0]);
+      },
+      rPos, zPos, bField);
+
+  const std::string path = "BFieldMapFile_rz.bfm";
+  writeBFieldMapFile(path, mapper);
+  auto file = std::make_shared<const BFieldMapFile>(path);
+  BOOST_CHECK(file->type() == BFieldMapFile::Type::RZ);
+  BOOST_CHECK_EQUAL(file->axes().size(), 2u);
+  BOOST_CHECK_THROW(mappedFieldMapperXYZ(file), std::invalid_argument);
+
+  auto mapped = mappedFieldMapperRZ(file);
+  // the mapper keeps the file alive
+  file.reset();
+  BOOST_CHECK(mapped.getNBins() == mapper.getNBins());
+  BOOST_CHECK(mapped.getMin() == mapper.getMin());
+  BOOST_CHECK(mapped.getMax() == mapper.getMax());
+
+  // the cached lookup rotates the field cell corners at the first position
+  // in the cell, i.e. it must be compared to the cached lookup of the source
+  using BField_t = InterpolatedBFieldMap<MappedBFieldMapperRZ>;
+  using Source_t = InterpolatedBFieldMap<decltype(mapper)>;
+  BField_t bFieldMap(BField_t::Config(std::move(mapped)));
+  Source_t sourceMap(Source_t::Config(std::move(mapper)));
+  auto cache = bFieldMap.makeCache(MagneticFieldContext());
+  auto sourceCache = sourceMap.makeCache(MagneticFieldContext());
+  for (const auto& pos : testPositions()) {
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      CHECK_CLOSE_ABS(bFieldMap.getField(pos), sourceMap.getField(pos), 1e-12);
+      CHECK_CLOSE_ABS(bFieldMap.getField(pos, cache),
+                      sourceMap.getField(pos, sourceCache), 1e-12);
+    }
+  }
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(BFieldMapFile_xyz) {
+  std::vector<double> xPos = {-2., -1., 0., 1., 2.};
+  std::vector<double> yPos = {-2., 0., 2.};
+  std::vector<double> zPos = {-2., -1., 0., 1., 2., 3.};
+  std::vector<Vector3> bField;
+  for (double x : xPos) {
+    for (double y : yPos) {
+      for (double z : zPos) {
+        bField.emplace_back(x * y, y + z, 1 + x * z);
+      }
+    }
+  }
+  auto mapper = fieldMapperXYZ(
+      [](std::array<size_t, 3> bins, std::array<size_t, 3> sizes) {
+        return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] +
+                bins[2]);
+      },
+      xPos, yPos, zPos, bField);
+
+  const std::string path = "BFieldMapFile_xyz.bfm";
+  writeBFieldMapFile(path, mapper);
+  auto file = std::make_shared<const BFieldMapFile>(path);
+  BOOST_CHECK(file->type() == BFieldMapFile::Type::XYZ);
+  BOOST_CHECK_EQUAL(file->axes().size(), 3u);
+  BOOST_CHECK_THROW(mappedFieldMapperRZ(file), std::invalid_argument);
+
+  using BField_t = InterpolatedBFieldMap<MappedBFieldMapperXYZ>;
+  BField_t bFieldMap(BField_t::Config(mappedFieldMapperXYZ(file)));
+  auto cache = bFieldMap.makeCache(MagneticFieldContext());
+  for (const auto& pos : testPositions()) {
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      CHECK_CLOSE_ABS(bFieldMap.getField(pos), mapper.getField(pos), 1e-12);
+      CHECK_CLOSE_ABS(bFieldMap.getField(pos, cache), mapper.getField(pos),
+                      1e-12);
+    }
+  }
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(BFieldMapFile_invalid) {
+  BOOST_CHECK_THROW(BFieldMapFile("does-not-exist.bfm"), std::runtime_error);
+
+  const std::string path = "BFieldMapFile_invalid.bfm";
+  {
+    std::ofstream os(path, std::ios::binary);
+    os << std::string(256, 'x');
+  }
+  BOOST_CHECK_THROW(BFieldMapFile{path}, std::runtime_error);
+
+  // a valid file that is truncated
+  BFieldMapFile::Axis axis;
+  axis.nBins = 4;
+  axis.min = 0.;
+  axis.max = 1.;
+  std::vector<BFieldMapFile::Axis> axes = {axis, axis};
+  BOOST_CHECK_THROW(BFieldMapFile::write(path, BFieldMapFile::Type::XYZ, axes,
+                                         std::vector<double>(72, 1.)),
+                    std::invalid_argument);
+  BFieldMapFile::write(path, BFieldMapFile::Type::RZ, axes,
+                       std::vector<double>(72, 1.));
+  BOOST_CHECK_NO_THROW(BFieldMapFile{path});
+  {
+    std::ifstream is(path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(is)),
+                        std::istreambuf_iterator<char>());
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    os << content.substr(0, content.size() - 8);
+  }
+  BOOST_CHECK_THROW(BFieldMapFile{path}, std::runtime_error);
+
+  // a corrupt number of bins whose number of values overflows and wraps to
+  // the number of values in the file
+  BFieldMapFile::write(path, BFieldMapFile::Type::RZ, axes,
+                       std::vector<double>(72, 1.));
+  {
+    std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+    // the first axis follows the fixed-size header fields
+    uint64_t nBins = (uint64_t(1) << 62) + 4u;
+    fs.seekp(40);
+    fs.write(reinterpret_cast<const char*>(&nBins), sizeof(nBins));
+  }
+  BOOST_CHECK_THROW(BFieldMapFile{path}, std::runtime_error);
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(BFieldMapFile_replace) {
+  const std::string path = "BFieldMapFile_replace.bfm";
+  BFieldMapFile::Axis axis;
+  axis.nBins = 4;
+  axis.min = 0.;
+  axis.max = 1.;
+  std::vector<BFieldMapFile::Axis> axes = {axis, axis};
+  BFieldMapFile::write(path, BFieldMapFile::Type::RZ, axes,
+                       std::vector<double>(72, 1.));
+  BFieldMapFile first(path);
+
+  // replacing the file does not change the content of existing mappings
+  BFieldMapFile::write(path, BFieldMapFile::Type::RZ, axes,
+                       std::vector<double>(72, 2.));
+  BFieldMapFile second(path);
+  for (size_t i = 0; i < 72u; ++i) {
+    BOOST_CHECK_EQUAL(first.values()[i], 1.);
+    BOOST_CHECK_EQUAL(second.values()[i], 2.);
+  }
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(BFieldMapFile_permissions) {
+  const std::string path = "BFieldMapFile_permissions.bfm";
+  BFieldMapFile::Axis axis;
+  axis.nBins = 4;
+  axis.min = 0.;
+  axis.max = 1.;
+  std::vector<BFieldMapFile::Axis> axes = {axis, axis};
+
+  // the file permissions respect the umask of the process
+  for (mode_t mask : {mode_t(022), mode_t(077)}) {
+    mode_t previous = ::umask(mask);
+    BFieldMapFile::write(path, BFieldMapFile::Type::RZ, axes,
+                         std::vector<double>(72, 1.));
+    ::umask(previous);
+    struct stat status;
+    BOOST_REQUIRE_EQUAL(::stat(path.c_str(), &status), 0);
+    BOOST_CHECK_EQUAL(status.st_mode & 0777, 0666 & ~mask);
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace Test
+}  // namespace Acts
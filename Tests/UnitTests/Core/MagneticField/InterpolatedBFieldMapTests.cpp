@@ -10,6 +10,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -115,6 +116,83 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(not c.isInside((pos << -2, 3, 4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 0, 2, -4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 5, 2, 14.).finished()));
+
+  // batch lookup along a line crossing several cells, in both directions so
+  // consecutive points are partially in the same cell
+  size_t nPoints = 27;
+  BField_t::BatchMatrix positions(3, 2 * nPoints);
+  for (size_t i = 0; i < nPoints; ++i) {
+    double f = static_cast<double>(i) / nPoints;
+    positions.col(i) << -2.5 + 4 * f, 1 - f, -4.5 + 9 * f;
+    positions.col(2 * nPoints - 1 - i) = positions.col(i);
+  }
+  BField_t::BatchMatrix fields(3, positions.cols());
+  bCacheAny = b.makeCache(mfContext);
+  b.getFieldBatch(positions, fields, bCacheAny);
+  for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+    Vector3 p = positions.col(i);
+    BOOST_TEST_CONTEXT("position=" << p.transpose()) {
+      CHECK_CLOSE_OR_SMALL(Vector3(fields.col(i)),
+                           BField::value({{perp(p), p.z()}}), 1e-6, 1e-9);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_storage) {
+  // smooth field with components of different magnitude
+  auto value = [](const std::array<double, 3>& xyz) {
+    return Vector3(std::sin(xyz[0]), 10 * std::cos(xyz[1] * xyz[2]),
+                   0.1 * xyz[2]);
+  };
+
+  detail::EquidistantAxis x(-2, 2, 8u);
+  detail::EquidistantAxis y(-2, 2, 8u);
+  detail::EquidistantAxis z(-4, 4, 16u);
+
+  using Grid_t = detail::Grid<Vector3, detail::EquidistantAxis,
+                              detail::EquidistantAxis, detail::EquidistantAxis>;
+  Grid_t g(std::make_tuple(std::move(x), std::move(y), std::move(z)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        g.atLocalBins(indices) = value(g.lowerLeftBinEdge(indices));
+      }
+    }
+  }
+
+  InterpolatedBFieldMapper<Grid_t> mapper(
+      [](const Vector3& pos) { return pos; },
+      [](const Vector3& field, const Vector3&) { return field; },
+      std::move(g));
+  auto floatMapper = mapper.compress<FloatBFieldStorage<3>>();
+  auto fixedMapper = mapper.compress<FixedPointBFieldStorage<3>>();
+
+  BOOST_CHECK_EQUAL(sizeof(decltype(floatMapper)::Grid_t::value_type),
+                    sizeof(Grid_t::value_type) / 2);
+  BOOST_CHECK_EQUAL(sizeof(decltype(fixedMapper)::Grid_t::value_type),
+                    sizeof(Grid_t::value_type) / 4);
+  BOOST_CHECK(floatMapper.getNBins() == mapper.getNBins());
+  BOOST_CHECK(fixedMapper.getNBins() == mapper.getNBins());
+
+  using FloatBField_t = InterpolatedBFieldMap<decltype(floatMapper)>;
+  using FixedBField_t = InterpolatedBFieldMap<decltype(fixedMapper)>;
+  FloatBField_t floatField(FloatBField_t::Config(std::move(floatMapper)));
+  FixedBField_t fixedField(FixedBField_t::Config(std::move(fixedMapper)));
+  auto floatCache = floatField.makeCache(mfContext);
+  auto fixedCache = fixedField.makeCache(mfContext);
+
+  // fixed-point values are precise to about 1.5e-5 of the largest component
+  for (double t = 0; t < 1; t += 0.01) {
+    Vector3 pos(-1.9 + 3.8 * t, 1.5 - 3 * t, -3.9 + 7.8 * t);
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      Vector3 expected = mapper.getField(pos);
+      CHECK_CLOSE_ABS(floatField.getField(pos), expected, 1e-5);
+      CHECK_CLOSE_ABS(floatField.getField(pos, floatCache), expected, 1e-5);
+      CHECK_CLOSE_ABS(fixedField.getField(pos), expected, 1e-3);
+      CHECK_CLOSE_ABS(fixedField.getField(pos, fixedCache), expected, 1e-3);
+    }
+  }
 }
 }  // namespace Test
 
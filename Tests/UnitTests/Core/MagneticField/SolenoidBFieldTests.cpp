@@ -17,7 +17,9 @@
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 
+#include <cstdio>
 #include <fstream>
+#include <random>
 
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
@@ -111,5 +113,131 @@ BOOST_AUTO_TEST_CASE(TestSolenoidBField) {
   // outf.close();
 }
 
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldBatch) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg;
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+  auto cache = bField.makeCache(mfContext);
+
+  // includes points on the axis and a number of points that is not a
+  // multiple of the internal batch width
+  size_t steps = 13;
+  SolenoidBField::BatchMatrix positions(3, steps * steps);
+  for (size_t i = 0; i < steps; i++) {
+    for (size_t j = 0; j < steps; j++) {
+      double r = 1.5 * cfg.radius / steps * i;
+      double phi = 2 * M_PI / steps * j;
+      double z = 1.5 * cfg.length / steps * j - 0.75 * cfg.length;
+      positions.col(i * steps + j) << r * std::cos(phi), r * std::sin(phi), z;
+    }
+  }
+  SolenoidBField::BatchMatrix fields(3, positions.cols());
+  bField.getFieldBatch(positions, fields, cache);
+
+  for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+    BOOST_TEST_CONTEXT("position=" << positions.col(i).transpose()) {
+      Vector3 expected = bField.getField(Vector3(positions.col(i)), cache);
+      CHECK_CLOSE_OR_SMALL(Vector3(fields.col(i)), expected, 1e-9, 1e-12_T);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldTable) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg;
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 100;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+  SolenoidBField::TableConfig tableCfg;
+  tableCfg.tolerance = 1e-3;
+  SolenoidBField bFieldTable(cfg, tableCfg);
+  auto cache = bFieldTable.makeCache(mfContext);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> rDist(0, 2 * cfg.radius);
+  std::uniform_real_distribution<double> zDist(-cfg.length, cfg.length);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  for (size_t i = 0; i < 1000; i++) {
+    double r = rDist(rng);
+    double z = zDist(rng);
+    double phi = phiDist(rng);
+    // the error is not controlled close to the coils
+    if ((std::abs(r - cfg.radius) < tableCfg.coilMargin) and
+        (std::abs(z) < 0.5 * cfg.length + tableCfg.coilMargin)) {
+      continue;
+    }
+    Vector3 pos(r * std::cos(phi), r * std::sin(phi), z);
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      CHECK_CLOSE_ABS(bFieldTable.getField(pos, cache), bField.getField(pos),
+                      tableCfg.tolerance * cfg.bMagCenter);
+    }
+  }
+
+  // on the axis and outside of the table the field is evaluated analytically
+  for (const Vector3& pos :
+       {Vector3(0, 0, 1_m), Vector3(1_m, 0, 1.5 * cfg.length),
+        Vector3(3 * cfg.radius, 0, 0)}) {
+    BOOST_TEST_CONTEXT("position=" << pos.transpose()) {
+      CHECK_CLOSE_OR_SMALL(bFieldTable.getField(pos), bField.getField(pos),
+                           1e-12, 1e-12_T);
+    }
+  }
+
+  SolenoidBField::BatchMatrix positions(3, 3);
+  positions << 0, 1_m, 2_m, 0, 0.5_m, -1_m, 0, 2_m, -3_m;
+  SolenoidBField::BatchMatrix fields(3, positions.cols());
+  bFieldTable.getFieldBatch(positions, fields, cache);
+  for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+    CHECK_CLOSE_OR_SMALL(Vector3(fields.col(i)),
+                         bFieldTable.getField(Vector3(positions.col(i))),
+                         1e-12, 1e-12_T);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldTableFile) {
+  const std::string path = "SolenoidBFieldTable.bfm";
+  std::remove(path.c_str());
+
+  SolenoidBField::Config cfg;
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 100;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField::TableConfig tableCfg;
+  tableCfg.tolerance = 1e-2;
+  tableCfg.file = path;
+  const Vector3 pos(0.5_m, 0.2_m, 2_m);
+
+  // the table is written on first use
+  SolenoidBField bFieldWrite(cfg, tableCfg);
+  BOOST_CHECK(not std::ifstream(path).good());
+  Vector3 field = bFieldWrite.getField(pos);
+  BOOST_CHECK(std::ifstream(path).good());
+
+  // and read by another field with the same configuration
+  SolenoidBField bFieldRead(cfg, tableCfg);
+  BOOST_CHECK_EQUAL(bFieldRead.getField(pos), field);
+
+  // a different configuration replaces the table
+  cfg.bMagCenter = 1_T;
+  SolenoidBField bFieldOther(cfg, tableCfg);
+  CHECK_CLOSE_OR_SMALL(bFieldOther.getField(pos), Vector3(0.5 * field), 1e-12,
+                       1e-12_T);
+  CHECK_CLOSE_ABS(bFieldOther.getField(pos), SolenoidBField(cfg).getField(pos),
+                  1e-2 * cfg.bMagCenter);
+  // without changing the table mapped by the existing field
+  BOOST_CHECK_EQUAL(bFieldRead.getField(pos), field);
+
+  std::remove(path.c_str());
+}
+
 }  // namespace Test
 }  // namespace Acts
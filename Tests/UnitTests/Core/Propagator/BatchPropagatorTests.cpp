@@ -0,0 +1,179 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/Volume.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/BatchPropagator.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+
+// context objects
+static const GeometryContext geoCtx;
+static const MagneticFieldContext magCtx;
+
+static auto bField =
+    std::make_shared<ConstantBField>(Vector3(0.1_T, -0.2_T, 2_T));
+
+/// Tracks in different directions with different momenta and charges, some
+/// without covariance
+static std::vector<CurvilinearTrackParameters> makeTracks(size_t n) {
+  std::vector<CurvilinearTrackParameters> tracks;
+  for (size_t i = 0; i < n; ++i) {
+    BoundSymMatrix cov = BoundSymMatrix::Identity();
+    cov(eBoundQOverP, eBoundQOverP) = 1e-4 / (1_GeV * 1_GeV);
+    const double phi = 0.5 * i;
+    const double theta = 0.5 + 0.2 * i;
+    const double charge = (i % 3 == 0) ? -1_e : ((i % 3 == 1) ? 1_e : 0.);
+    std::optional<BoundSymMatrix> optCov;
+    if (i % 4 != 3) {
+      optCov = cov;
+    }
+    tracks.emplace_back(Vector4(i * 1_mm, -1_mm, 2_mm, 2_ns), phi, theta,
+                        (0.5 + 0.25 * i) * 1_GeV, charge, optCov);
+  }
+  return tracks;
+}
+
+BOOST_AUTO_TEST_SUITE(BatchPropagator)
+
+// test the batched propagation against the single track propagation
+BOOST_AUTO_TEST_CASE(CompareToPropagator) {
+  const auto tracks = makeTracks(11);
+
+  BatchPropagatorOptions batchOptions(geoCtx, magCtx);
+  batchOptions.pathLimit = 1_m;
+  batchOptions.maxStepSize = 20_cm;
+  Acts::BatchPropagator<4> batchPropagator(BatchedEigenStepper<4>{bField});
+  auto results = batchPropagator.propagate(tracks, batchOptions);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  PropagatorOptions<> options(geoCtx, magCtx, getDummyLogger());
+  options.pathLimit = 1_m;
+  options.maxStepSize = 20_cm;
+  Propagator<EigenStepper<>> propagator(EigenStepper<>{bField});
+
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_TEST_CONTEXT("track " << i) {
+      auto res = propagator.propagate(tracks[i], options);
+      BOOST_REQUIRE(res.ok());
+      BOOST_REQUIRE(results[i].ok());
+      const auto& batchRes = results[i].value();
+      BOOST_CHECK(!batchRes.leftVolume);
+      CHECK_CLOSE_ABS(batchRes.pathLength, res.value().pathLength, 1e-9);
+
+      const auto& end = *res.value().endParameters;
+      const auto& batchEnd = *batchRes.endParameters;
+      CHECK_CLOSE_ABS(batchEnd.position(geoCtx), end.position(geoCtx), 1e-9);
+      CHECK_CLOSE_ABS(batchEnd.unitDirection(), end.unitDirection(), 1e-12);
+      CHECK_CLOSE_ABS(batchEnd.time(), end.time(), 1e-9);
+      BOOST_CHECK_EQUAL(batchEnd.charge(), end.charge());
+      BOOST_REQUIRE_EQUAL(batchEnd.covariance().has_value(),
+                          end.covariance().has_value());
+      BOOST_REQUIRE_EQUAL(batchRes.transportJacobian != nullptr,
+                          res.value().transportJacobian != nullptr);
+      if (end.covariance()) {
+        CHECK_CLOSE_COVARIANCE(*batchEnd.covariance(), *end.covariance(),
+                               1e-9);
+        CHECK_CLOSE_ABS(*batchRes.transportJacobian,
+                        *res.value().transportJacobian, 1e-9);
+      }
+    }
+  }
+}
+
+// test the stopping conditions of the lanes
+BOOST_AUTO_TEST_CASE(StoppingConditions) {
+  const auto tracks = makeTracks(7);
+  Acts::BatchPropagator<4> batchPropagator(BatchedEigenStepper<4>{bField});
+
+  // tracks leave the volume
+  Volume volume(Transform3::Identity(),
+                std::make_shared<CylinderVolumeBounds>(0., 10_cm, 20_cm));
+  BatchPropagatorOptions options(geoCtx, magCtx);
+  options.pathLimit = 2_m;
+  options.maxStepSize = 1_cm;
+  options.volume = &volume;
+  auto results = batchPropagator.propagate(tracks, options);
+  for (auto& res : results) {
+    BOOST_REQUIRE(res.ok());
+    BOOST_CHECK(res.value().leftVolume);
+    BOOST_CHECK_LT(res.value().pathLength, 2_m);
+    BOOST_CHECK(!volume.inside(res.value().endParameters->position(geoCtx)));
+  }
+
+  // the number of steps is limited
+  options.volume = nullptr;
+  options.maxSteps = 3;
+  results = batchPropagator.propagate(tracks, options);
+  for (auto& res : results) {
+    BOOST_REQUIRE(!res.ok());
+    BOOST_CHECK_EQUAL(res.error(), PropagatorError::StepCountLimitReached);
+  }
+
+  // the step size adaption fails
+  options.maxSteps = 1000;
+  options.tolerance = 1e-30;
+  options.stepSizeCutOff = 1_mm;
+  results = batchPropagator.propagate(tracks, options);
+  for (auto& res : results) {
+    BOOST_REQUIRE(!res.ok());
+    BOOST_CHECK_EQUAL(res.error(), EigenStepperError::StepSizeStalled);
+  }
+}
+
+// test that lanes without a performed step do not move
+BOOST_AUTO_TEST_CASE(FailedLanesStay) {
+  BatchedEigenStepper<4> stepper(bField);
+  auto state = stepper.makeState(geoCtx, magCtx);
+  BatchPropagatorOptions options(geoCtx, magCtx);
+
+  // no active lanes
+  auto h = stepper.step(state, options);
+  BOOST_CHECK((h == 0.).all());
+  BOOST_CHECK((state.pos == 0.).all());
+
+  // all lanes fail after the second trial
+  const auto tracks = makeTracks(4);
+  for (unsigned int lane = 0; lane < 4u; ++lane) {
+    stepper.loadTrack(state, lane, tracks[lane], 10_cm);
+  }
+  const auto start = state.pos;
+  options.tolerance = 1e-30;
+  options.maxRungeKuttaStepTrials = 0;
+  h = stepper.step(state, options);
+  for (unsigned int lane = 0; lane < 4u; ++lane) {
+    BOOST_TEST_CONTEXT("lane " << lane) {
+      BOOST_CHECK_EQUAL(state.error[lane],
+                        EigenStepperError::StepSizeAdjustmentFailed);
+      BOOST_CHECK_EQUAL(h[lane], 0.);
+      BOOST_CHECK((state.pos.row(lane) == start.row(lane)).all());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
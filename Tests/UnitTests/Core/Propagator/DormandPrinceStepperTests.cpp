@@ -0,0 +1,169 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/DormandPrinceStepper.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+using Stepper = DormandPrinceStepper<>;
+
+static_assert(StepperConcept<Stepper>,
+              "DormandPrinceStepper does not fulfill the stepper concept.");
+static_assert(StepperConcept<DormandPrinceStepper<ConstantBField>>,
+              "DormandPrinceStepper does not fulfill the stepper concept.");
+
+/// Simplified propagator state.
+struct MockPropagatorState {
+  MockPropagatorState(Stepper::State stepperState)
+      : stepping(std::move(stepperState)) {}
+
+  /// Stepper state.
+  Stepper::State stepping;
+  /// Propagator options with only the relevant components.
+  struct {
+    double mass = 1_GeV;
+    double tolerance = 1e-4;
+    double stepSizeCutOff = 0.;
+    unsigned int maxRungeKuttaStepTrials = 10000;
+  } options;
+};
+
+// context objects
+static const GeometryContext geoCtx;
+static const MagneticFieldContext magCtx;
+
+static constexpr auto absMom = 1_GeV;
+static constexpr auto bz = 2_T;
+static auto magneticField = std::make_shared<ConstantBField>(0, 0, bz);
+
+BOOST_AUTO_TEST_SUITE(DormandPrinceStepper)
+
+// test steps along a helix in a constant field
+BOOST_AUTO_TEST_CASE(StepHelix) {
+  Stepper stepper(magneticField);
+  MockPropagatorState state(stepper.makeState(
+      std::cref(geoCtx), std::cref(magCtx),
+      CurvilinearTrackParameters(Vector4(0, 0, 0, 0), Vector3(1, 0, 0),
+                                 absMom, 1_e)));
+
+  // analytic helix in the transverse plane
+  const double omega = bz / absMom;
+  auto helixPosition = [&](double s) {
+    return Vector3(std::sin(omega * s) / omega,
+                   (std::cos(omega * s) - 1.) / omega, 0.);
+  };
+
+  // the first step starts without limit and has to be reduced
+  BOOST_CHECK(stepper.step(state).ok());
+  const double accuracy =
+      state.stepping.stepSize.value(ConstrainedStep::accuracy);
+  BOOST_CHECK_LT(accuracy, 1_m);
+  BOOST_CHECK_GT(state.stepping.pathAccumulated, 0.);
+
+  for (unsigned int i = 0; i < 20; ++i) {
+    BOOST_CHECK(stepper.step(state).ok());
+    // the field of the last stage is reused for the next step
+    BOOST_CHECK(state.stepping.stepData.lastValid);
+    BOOST_CHECK_EQUAL(state.stepping.stepData.lastPosition,
+                      stepper.position(state.stepping));
+  }
+  CHECK_CLOSE_ABS(stepper.position(state.stepping),
+                  helixPosition(state.stepping.pathAccumulated), 1_um);
+  CHECK_CLOSE_ABS(stepper.direction(state.stepping).norm(), 1., 1e-12);
+  BOOST_CHECK_GT(stepper.time(state.stepping), 0.);
+}
+
+// test the adaptation of the step size
+BOOST_AUTO_TEST_CASE(StepSizeControl) {
+  Stepper stepper(magneticField);
+  MockPropagatorState state(stepper.makeState(
+      std::cref(geoCtx), std::cref(magCtx),
+      CurvilinearTrackParameters(Vector4(0, 0, 0, 0), Vector3(1, 0, 0),
+                                 absMom, 1_e)));
+
+  // a navigation limited step leaves the accuracy unconstrained
+  stepper.setStepSize(state.stepping, 1_mm);
+  auto res = stepper.step(state);
+  BOOST_CHECK(res.ok());
+  BOOST_CHECK_EQUAL(res.value(), 1_mm);
+  BOOST_CHECK_EQUAL(state.stepping.stepSize.value(ConstrainedStep::accuracy),
+                    std::numeric_limits<double>::max());
+
+  // a too large step is rejected and reduced
+  stepper.releaseStepSize(state.stepping);
+  stepper.setStepSize(state.stepping, 10_m);
+  res = stepper.step(state);
+  BOOST_CHECK(res.ok());
+  BOOST_CHECK_LT(res.value(), 10_m);
+  double accuracy = state.stepping.stepSize.value(ConstrainedStep::accuracy);
+  BOOST_CHECK_LE(accuracy, res.value());
+
+  // the step size grows again with a tolerance that is not exhausted
+  state.options.tolerance = 1e-2;
+  res = stepper.step(state);
+  BOOST_CHECK(res.ok());
+  BOOST_CHECK_EQUAL(res.value(), accuracy);
+  BOOST_CHECK_GT(state.stepping.stepSize.value(ConstrainedStep::accuracy),
+                 accuracy);
+  BOOST_CHECK_LE(state.stepping.stepSize.value(ConstrainedStep::accuracy),
+                 10 * accuracy);
+
+  // and the minimal step size is respected
+  state.options.tolerance = 1e-30;
+  state.options.stepSizeCutOff = 1_mm;
+  res = stepper.step(state);
+  BOOST_CHECK(!res.ok());
+  BOOST_CHECK_EQUAL(res.error(), EigenStepperError::StepSizeStalled);
+}
+
+// test the transported covariance against the EigenStepper
+BOOST_AUTO_TEST_CASE(CovarianceTransport) {
+  auto tiltedField =
+      std::make_shared<ConstantBField>(Vector3(0.1_T, -0.2_T, 2_T));
+  BoundSymMatrix cov = BoundSymMatrix::Identity();
+  cov(eBoundQOverP, eBoundQOverP) = 1e-4 / (1_GeV * 1_GeV);
+  CurvilinearTrackParameters start(Vector4(1_mm, -1_mm, 2_mm, 2_ns),
+                                   Vector3(-2, 2, 1).normalized(), 2_GeV, -1_e,
+                                   cov);
+
+  PropagatorOptions<> options(geoCtx, magCtx, getDummyLogger());
+  options.pathLimit = 1_m;
+  options.tolerance = 1e-7;
+
+  Propagator<Stepper> propagator(Stepper{tiltedField});
+  Propagator<EigenStepper<>> eigenPropagator(EigenStepper<>{tiltedField});
+  auto res = propagator.propagate(start, options);
+  auto eigenRes = eigenPropagator.propagate(start, options);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(eigenRes.ok());
+  BOOST_CHECK_LT(res.value().steps, eigenRes.value().steps);
+
+  const auto& end = *res.value().endParameters;
+  const auto& eigenEnd = *eigenRes.value().endParameters;
+  CHECK_CLOSE_ABS(end.position(geoCtx), eigenEnd.position(geoCtx), 1_um);
+  CHECK_CLOSE_ABS(end.unitDirection(), eigenEnd.unitDirection(), 1e-6);
+  CHECK_CLOSE_ABS(end.time(), eigenEnd.time(), 1e-6);
+  CHECK_CLOSE_COVARIANCE(*end.covariance(), *eigenEnd.covariance(), 1e-6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
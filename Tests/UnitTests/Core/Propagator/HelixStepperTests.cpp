@@ -0,0 +1,198 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/NeutralTrackParameters.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+
+static_assert(StepperConcept<HelixStepper<>>,
+              "HelixStepper does not fulfill the stepper concept.");
+static_assert(StepperConcept<HelixStepper<ConstantBField>>,
+              "HelixStepper does not fulfill the stepper concept.");
+static_assert(StepperConcept<HelixStepper<SolenoidBField>>,
+              "HelixStepper does not fulfill the stepper concept.");
+
+/// Field which is homogeneous for |z| < 1m and decreases outside
+class BarrelBField final : public MagneticFieldProvider {
+ public:
+  struct Cache {
+    Cache(const MagneticFieldContext& /*mctx*/) {}
+  };
+
+  MagneticFieldProvider::Cache makeCache(
+      const MagneticFieldContext& mctx) const override {
+    return MagneticFieldProvider::Cache::make<Cache>(mctx);
+  }
+
+  Vector3 getField(const Vector3& position) const override {
+    const double dz = std::max(std::abs(position.z()) - 1_m, 0.);
+    return Vector3(0.1_T, -0.2_T, 2_T * (1. - 0.2 * dz / 1_m));
+  }
+
+  Vector3 getField(const Vector3& position,
+                   MagneticFieldProvider::Cache& /*cache*/) const override {
+    return getField(position);
+  }
+
+  Vector3 getField(const Vector3& position, Cache& /*cache*/) const {
+    return getField(position);
+  }
+
+  double homogeneousDistance(
+      const Vector3& position,
+      MagneticFieldProvider::Cache& /*cache*/) const override {
+    return std::max(1_m - std::abs(position.z()), 0.);
+  }
+
+  double homogeneousDistance(const Vector3& position, Cache& /*cache*/) const {
+    return std::max(1_m - std::abs(position.z()), 0.);
+  }
+
+  Vector3 getFieldGradient(const Vector3& position,
+                           ActsMatrix<3, 3>& /*derivative*/) const override {
+    return getField(position);
+  }
+
+  Vector3 getFieldGradient(
+      const Vector3& position, ActsMatrix<3, 3>& /*derivative*/,
+      MagneticFieldProvider::Cache& /*cache*/) const override {
+    return getField(position);
+  }
+};
+
+// context objects
+static const GeometryContext geoCtx;
+static const MagneticFieldContext magCtx;
+
+static auto makeParameters() {
+  BoundSymMatrix cov = BoundSymMatrix::Identity();
+  cov(eBoundQOverP, eBoundQOverP) = 1e-4 / (1_GeV * 1_GeV);
+  return CurvilinearTrackParameters(Vector4(1_mm, -1_mm, 2_mm, 2_ns),
+                                    Vector3(-1, 1, 2).normalized(), 2_GeV,
+                                    -1_e, cov);
+}
+
+template <typename stepper_t>
+static auto propagate(stepper_t stepper, double pathLimit) {
+  PropagatorOptions<> options(geoCtx, magCtx, getDummyLogger());
+  options.pathLimit = pathLimit;
+  options.tolerance = 1e-7;
+  options.maxSteps = 10000;
+  Propagator<stepper_t> propagator(std::move(stepper));
+  return propagator.propagate(makeParameters(), options);
+}
+
+BOOST_AUTO_TEST_SUITE(HelixStepper)
+
+// test the helix against the numerical integration in a constant field
+BOOST_AUTO_TEST_CASE(ConstantField) {
+  auto field = std::make_shared<ConstantBField>(Vector3(0.1_T, -0.2_T, 2_T));
+
+  auto res = propagate(Acts::HelixStepper<ConstantBField>(field), 2_m);
+  auto eigenRes = propagate(EigenStepper<>(field), 2_m);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(eigenRes.ok());
+  BOOST_CHECK_LT(res.value().steps, eigenRes.value().steps);
+
+  const auto& end = *res.value().endParameters;
+  const auto& eigenEnd = *eigenRes.value().endParameters;
+  CHECK_CLOSE_ABS(end.position(geoCtx), eigenEnd.position(geoCtx), 1_um);
+  CHECK_CLOSE_ABS(end.unitDirection(), eigenEnd.unitDirection(), 1e-6);
+  CHECK_CLOSE_ABS(end.time(), eigenEnd.time(), 1e-6);
+  CHECK_CLOSE_COVARIANCE(*end.covariance(), *eigenEnd.covariance(), 1e-6);
+
+  // a neutral particle follows a straight line
+  Acts::HelixStepper<> stepper(field);
+  PropagatorOptions<> options(geoCtx, magCtx, getDummyLogger());
+  options.pathLimit = 1_m;
+  Propagator<Acts::HelixStepper<>> propagator(std::move(stepper));
+  NeutralCurvilinearTrackParameters neutral(
+      Vector4(0, 0, 0, 0), Vector3(1, 1, 0).normalized(), 1 / 1_GeV,
+      BoundSymMatrix::Identity());
+  auto neutralRes = propagator.propagate(neutral, options);
+  BOOST_REQUIRE(neutralRes.ok());
+  CHECK_CLOSE_ABS(neutralRes.value().endParameters->position(geoCtx),
+                  Vector3(1, 1, 0).normalized() * 1_m, 1e-9);
+}
+
+// test the hand over to the numerical integration
+BOOST_AUTO_TEST_CASE(HandOver) {
+  auto field = std::make_shared<BarrelBField>();
+
+  auto res = propagate(Acts::HelixStepper<>(field), 3_m);
+  auto eigenRes = propagate(EigenStepper<>(field), 3_m);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(eigenRes.ok());
+  BOOST_CHECK_GT(res.value().steps, 1u);
+  BOOST_CHECK_LT(res.value().steps, eigenRes.value().steps);
+
+  const auto& end = *res.value().endParameters;
+  const auto& eigenEnd = *eigenRes.value().endParameters;
+  BOOST_CHECK_GT(std::abs(end.position(geoCtx).z()), 1_m);
+  CHECK_CLOSE_ABS(end.position(geoCtx), eigenEnd.position(geoCtx), 1_um);
+  CHECK_CLOSE_ABS(end.unitDirection(), eigenEnd.unitDirection(), 1e-6);
+  CHECK_CLOSE_COVARIANCE(*end.covariance(), *eigenEnd.covariance(), 1e-6);
+}
+
+// test the hand over with the concrete field type
+BOOST_AUTO_TEST_CASE(HandOverConcreteField) {
+  auto field = std::make_shared<BarrelBField>();
+
+  auto res = propagate(Acts::HelixStepper<BarrelBField>(field), 3_m);
+  auto virtualRes = propagate(Acts::HelixStepper<>(field), 3_m);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(virtualRes.ok());
+  BOOST_CHECK_EQUAL(res.value().steps, virtualRes.value().steps);
+
+  const auto& end = *res.value().endParameters;
+  const auto& virtualEnd = *virtualRes.value().endParameters;
+  BOOST_CHECK_GT(std::abs(end.position(geoCtx).z()), 1_m);
+  CHECK_CLOSE_ABS(end.position(geoCtx), virtualEnd.position(geoCtx), 1e-9);
+  CHECK_CLOSE_ABS(end.unitDirection(), virtualEnd.unitDirection(), 1e-12);
+  CHECK_CLOSE_COVARIANCE(*end.covariance(), *virtualEnd.covariance(), 1e-9);
+}
+
+// test a concrete field type without homogeneous region
+BOOST_AUTO_TEST_CASE(InhomogeneousConcreteField) {
+  SolenoidBField::Config cfg;
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  auto field = std::make_shared<SolenoidBField>(cfg);
+
+  // all steps are numerical
+  using Stepper = Acts::HelixStepper<SolenoidBField>;
+  auto res = propagate(Stepper(field), 2_m);
+  auto eigenRes = propagate(Stepper::NumericalStepper(field), 2_m);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(eigenRes.ok());
+  BOOST_CHECK_EQUAL(res.value().steps, eigenRes.value().steps);
+  CHECK_CLOSE_ABS(res.value().endParameters->position(geoCtx),
+                  eigenRes.value().endParameters->position(geoCtx), 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,98 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/NavigationProfile.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <sstream>
+#include <string>
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+// This test is only built with the ACTS_ENABLE_NAVIGATION_PROFILE option
+BOOST_AUTO_TEST_CASE(navigation_profile) {
+  BOOST_REQUIRE(s_navigationProfile);
+
+  auto bField = std::make_shared<ConstantBField>(0, 0, 2_T);
+  using Stepper = EigenStepper<>;
+  Propagator<Stepper, Navigator> propagator(Stepper{bField},
+                                            Navigator{tGeometry});
+  using Options = PropagatorOptions<ActionList<NavigationProfiler>,
+                                    AbortList<EndOfWorldReached>>;
+  Options options(tgContext, mfContext, getDummyLogger());
+
+  NavigationProfile profile;
+  size_t steps = 0;
+  for (size_t i = 0; i < 20; ++i) {
+    const double phi = -M_PI + 0.314 * i;
+    const double theta = 0.4 + 0.12 * i;
+    CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), phi, theta,
+                                     1_e / (0.5_GeV + 0.2_GeV * i));
+    auto result = propagator.propagate(start, options);
+    BOOST_REQUIRE(result.ok());
+    const auto& trackProfile =
+        result.value().get<NavigationProfiler::result_type>().profile;
+
+    // Every accepted step is counted once, in a known volume, the
+    // propagator does not count the step after which it was aborted
+    const auto total = trackProfile.total();
+    BOOST_CHECK_EQUAL(total.steps, result.value().steps + 1);
+    BOOST_CHECK_GT(total.intersectionsTried, total.steps);
+    BOOST_CHECK_LE(total.intersectionsRejected, total.intersectionsTried);
+    // The target call after the status call reuses the surface status
+    BOOST_CHECK_GT(total.intersectionsReused, 0u);
+    BOOST_CHECK_GT(total.boundaryResolutions, 0u);
+    BOOST_CHECK_GT(total.stepSizeClamps, 0u);
+    BOOST_CHECK_GT(trackProfile.volumes.size(), 1u);
+    for (const auto& [volumeId, counters] : trackProfile.volumes) {
+      BOOST_CHECK_NE(volumeId.volume(), 0u);
+    }
+
+    profile.merge(trackProfile);
+    steps += total.steps;
+  }
+  BOOST_CHECK_EQUAL(profile.total().steps, steps);
+
+  // One header line and one line per volume
+  std::stringstream csv;
+  profile.writeCsv(csv);
+  std::string line;
+  std::getline(csv, line);
+  BOOST_CHECK_EQUAL(line.substr(0, 16), "volume_id,steps,");
+  size_t nLines = 0;
+  while (std::getline(csv, line)) {
+    ++nLines;
+  }
+  BOOST_CHECK_EQUAL(nLines, profile.volumes.size());
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -14,10 +14,18 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/NavigatorPolicies.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/StepperConcept.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Tests/CommonHelpers/CubicBVHTrackingGeometry.hpp"
@@ -684,5 +692,53 @@ BOOST_AUTO_TEST_CASE(Navigator_target_methods) {
   BOOST_CHECK_EQUAL(BVHState.navigation.navSurfaces.size(), 42u);
 }
 
+BOOST_AUTO_TEST_CASE(Navigator_small_buffer_policy) {
+  MagneticFieldContext mfContext;
+  auto bField = std::make_shared<ConstantBField>(0, 0, 2_T);
+
+  using Stepper = EigenStepper<>;
+  using SmallBufferNavigator = NavigatorT<SmallBufferNavigatorPolicy<>>;
+  Propagator<Stepper, Navigator> vPropagator(Stepper{bField},
+                                             Navigator{tGeometry});
+  Propagator<Stepper, SmallBufferNavigator> sPropagator(
+      Stepper{bField}, SmallBufferNavigator{tGeometry});
+
+  using Options = PropagatorOptions<ActionList<SurfaceCollector<>>,
+                                    AbortList<EndOfWorldReached>>;
+  Options options(tgContext, mfContext, getDummyLogger());
+  auto& sCollector = options.actionList.get<SurfaceCollector<>>();
+  sCollector.selector.selectSensitive = true;
+  sCollector.selector.selectMaterial = true;
+  sCollector.selector.selectPassive = true;
+
+  // Both policies have to find the same surfaces in both directions
+  for (size_t i = 0; i < 40; ++i) {
+    const double phi = -M_PI + 0.157 * i;
+    const double theta = 0.3 + 0.06 * i;
+    const double charge = (i % 2 == 0) ? 1_e : -1_e;
+    CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), phi, theta,
+                                     charge / (0.5_GeV + 0.1_GeV * i));
+    options.direction = (i % 4 < 2) ? forward : backward;
+
+    auto vResult = vPropagator.propagate(start, options);
+    auto sResult = sPropagator.propagate(start, options);
+    BOOST_REQUIRE(vResult.ok());
+    BOOST_REQUIRE(sResult.ok());
+    BOOST_CHECK_EQUAL(sResult.value().steps, vResult.value().steps);
+
+    const auto& vSurfaces =
+        vResult.value().template get<SurfaceCollector<>::result_type>();
+    const auto& sSurfaces =
+        sResult.value().template get<SurfaceCollector<>::result_type>();
+    BOOST_CHECK_GT(vSurfaces.collected.size(), 0u);
+    BOOST_REQUIRE_EQUAL(sSurfaces.collected.size(),
+                        vSurfaces.collected.size());
+    for (size_t j = 0; j < vSurfaces.collected.size(); ++j) {
+      BOOST_CHECK_EQUAL(sSurfaces.collected[j].surface,
+                        vSurfaces.collected[j].surface);
+    }
+  }
+}
+
 }  // namespace Test
-}  // namespace Acts
\ No newline at end of file
+}  // namespace Acts
@@ -18,6 +18,7 @@
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Material/HomogeneousVolumeMaterial.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
@@ -496,6 +497,46 @@ BOOST_AUTO_TEST_CASE(eigen_stepper_test) {
   BOOST_CHECK_EQUAL(res.error(), EigenStepperError::StepSizeAdjustmentFailed);
 }
 
+/// The statically dispatched field lookup must give the same steps as the
+/// lookup through the MagneticFieldProvider interface
+template <typename field_t>
+void testStaticFieldStepper(std::shared_ptr<const field_t> bField) {
+  using VirtualStepper = EigenStepper<>;
+  using StaticStepper = EigenStepper<StepperExtensionList<DefaultExtension>,
+                                     detail::VoidAuctioneer, field_t>;
+  static_assert(std::is_same_v<decltype(StaticStepper::State::fieldCache),
+                               typename field_t::Cache>);
+
+  Covariance cov = 8. * Covariance::Identity();
+  CurvilinearTrackParameters cp(makeVector4(Vector3(10., 20., 30.), 0.),
+                                Vector3(4., 5., 6.).normalized(), -1. / 1_GeV,
+                                cov);
+
+  VirtualStepper virtualStepper(bField);
+  StaticStepper staticStepper(bField);
+  PropState virtualState(virtualStepper.makeState(
+      std::cref(tgContext), std::cref(mfContext), cp, forward, 10_cm));
+  PropState staticState(staticStepper.makeState(
+      std::cref(tgContext), std::cref(mfContext), cp, forward, 10_cm));
+
+  for (size_t i = 0; i < 10; ++i) {
+    double hVirtual = virtualStepper.step(virtualState).value();
+    double hStatic = staticStepper.step(staticState).value();
+    BOOST_CHECK_EQUAL(hStatic, hVirtual);
+  }
+  BOOST_CHECK_EQUAL(staticState.stepping.pars, virtualState.stepping.pars);
+  BOOST_CHECK_EQUAL(staticState.stepping.jacTransport,
+                    virtualState.stepping.jacTransport);
+}
+
+BOOST_AUTO_TEST_CASE(eigen_stepper_static_field_test) {
+  testStaticFieldStepper<ConstantBField>(
+      std::make_shared<ConstantBField>(Vector3(0.1_T, 0.2_T, 2_T)));
+  testStaticFieldStepper<SolenoidBField>(
+      std::make_shared<SolenoidBField>(SolenoidBField::Config{1_m, 5_m, 20,
+                                                              2_T}));
+}
+
 /// @brief This function tests the EigenStepper with the DefaultExtension and
 /// the DenseEnvironmentExtension. The focus of this tests lies in the
 /// choosing of the right extension for the individual use case. This is
@@ -1115,5 +1156,82 @@ BOOST_AUTO_TEST_CASE(step_extension_trackercalomdt_test) {
     }
   }
 }
+
+/// Without covariance transport support the state carries no Jacobians and the
+/// steps must be identical to the ones of the covariance transporting stepper
+BOOST_AUTO_TEST_CASE(eigen_stepper_covariance_free_test) {
+  using Extensions =
+      StepperExtensionList<DefaultExtension, DenseEnvironmentExtension>;
+  using Auctioneer = detail::HighestValidAuctioneer;
+  using CovStepper = EigenStepper<Extensions, Auctioneer>;
+  using FreeStepper =
+      EigenStepper<Extensions, Auctioneer, MagneticFieldProvider, false>;
+  static_assert(sizeof(FreeStepper::State) < sizeof(CovStepper::State));
+  static_assert(detail::hasTransportJacobians<CovStepper::State>);
+  static_assert(!detail::hasTransportJacobians<FreeStepper::State>);
+
+  // Build a detector filled with material to run both extensions
+  CuboidVolumeBuilder cvb;
+  CuboidVolumeBuilder::VolumeConfig vConf;
+  vConf.position = {0.5_m, 0., 0.};
+  vConf.length = {1_m, 1_m, 1_m};
+  vConf.volumeMaterial =
+      std::make_shared<HomogeneousVolumeMaterial>(makeBeryllium());
+  CuboidVolumeBuilder::Config conf;
+  conf.volumeCfg.push_back(vConf);
+  conf.position = {0.5_m, 0., 0.};
+  conf.length = {1_m, 1_m, 1_m};
+  cvb.setConfig(conf);
+  TrackingGeometryBuilder::Config tgbCfg;
+  tgbCfg.trackingVolumeBuilders.push_back(
+      [=](const auto& context, const auto& inner, const auto& vb) {
+        return cvb.trackingVolume(context, inner, vb);
+      });
+  TrackingGeometryBuilder tgb(tgbCfg);
+  std::shared_ptr<const TrackingGeometry> material =
+      tgb.trackingGeometry(tgContext);
+  Navigator navigator(material);
+
+  auto bField = std::make_shared<ConstantBField>(Vector3(0.1_T, 0.2_T, 2_T));
+  Covariance cov = 8. * Covariance::Identity();
+  CurvilinearTrackParameters cp(Vector4::Zero(),
+                                Vector3(1., 0.1, 0.1).normalized(),
+                                1_GeV, 1_e, cov);
+
+  DenseStepperPropagatorOptions<ActionList<>, AbortList<EndOfWorld>> options(
+      tgContext, mfContext, getDummyLogger());
+  options.maxSteps = 10000;
+  Propagator<CovStepper, Navigator> covPropagator(CovStepper{bField},
+                                                  navigator);
+  Propagator<FreeStepper, Navigator> freePropagator(FreeStepper{bField},
+                                                    navigator);
+  auto covRes = covPropagator.propagate(cp, options);
+  auto freeRes = freePropagator.propagate(cp, options);
+  BOOST_REQUIRE(covRes.ok());
+  BOOST_REQUIRE(freeRes.ok());
+  BOOST_CHECK_EQUAL(freeRes.value().steps, covRes.value().steps);
+  BOOST_CHECK_EQUAL(freeRes.value().pathLength, covRes.value().pathLength);
+
+  const auto& covEnd = *covRes.value().endParameters;
+  const auto& freeEnd = *freeRes.value().endParameters;
+  BOOST_CHECK_EQUAL(freeEnd.parameters(), covEnd.parameters());
+  BOOST_CHECK_LT(freeEnd.absoluteMomentum(), 1_GeV);
+  BOOST_CHECK(covEnd.covariance().has_value());
+  BOOST_CHECK(!freeEnd.covariance().has_value());
+  BOOST_CHECK(covRes.value().transportJacobian != nullptr);
+  BOOST_CHECK(freeRes.value().transportJacobian == nullptr);
+
+  // the bound state on a surface carries no covariance either
+  FreeStepper stepper(bField);
+  auto state = stepper.makeState(std::cref(tgContext), std::cref(mfContext),
+                                 cp, forward, 10_cm);
+  BOOST_CHECK(!state.covTransport);
+  auto bs = stepper.boundState(state, cp.referenceSurface());
+  BOOST_REQUIRE(bs.ok());
+  const auto& bound = std::get<BoundTrackParameters>(*bs);
+  BOOST_CHECK(!bound.covariance().has_value());
+  CHECK_CLOSE_ABS(bound.position(tgContext), cp.position(tgContext), eps);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -12,8 +12,12 @@
 
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace Acts {
 namespace Test {
@@ -85,7 +89,10 @@ void debug_level_test(const char* output_file, Logging::Level lvl) {
                                  "TestLogger     INFO      info level",
                                  "TestLogger     DEBUG     debug level",
                                  "TestLogger     VERBOSE   verbose level"};
-  lines.resize(static_cast<int>(Logging::Level::MAX) - static_cast<int>(lvl));
+  // messages below the minimum level are removed at compile time
+  Logging::Level effective = std::max(lvl, Logging::MINIMUM_LEVEL);
+  lines.resize(static_cast<int>(Logging::Level::MAX) -
+               static_cast<int>(effective));
 
   // Check output
   std::ifstream infile(output_file, std::ios::in);
@@ -124,5 +131,63 @@ BOOST_AUTO_TEST_CASE(DEBUG_test) {
 BOOST_AUTO_TEST_CASE(VERBOSE_test) {
   debug_level_test("verbose_log.txt", VERBOSE);
 }
+
+/// @brief unit test for the asynchronous print policy
+///
+/// Every thread logs more messages than fit into its buffer. All messages
+/// must be written and the messages of each thread must keep their order.
+BOOST_AUTO_TEST_CASE(async_output_test) {
+  if (INFO >= Logging::FAILURE_THRESHOLD) {
+    return;
+  }
+  constexpr size_t nThreads = 4;
+  constexpr size_t nMessages = 5000;
+
+  std::ostringstream os;
+  Logger log(std::make_unique<NamedOutputDecorator>(
+                 std::make_unique<AsyncPrintPolicy>(&os), "AsyncLogger"),
+             std::make_unique<DefaultFilterPolicy>(INFO));
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < nMessages; ++i) {
+        log.log(INFO, std::to_string(t) + " " + std::to_string(i));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  flushAsyncOutput();
+
+  std::vector<size_t> next(nThreads, 0);
+  std::istringstream is(os.str());
+  std::string name;
+  size_t t = 0;
+  size_t i = 0;
+  while (is >> name >> t >> i) {
+    BOOST_CHECK_EQUAL(name, "AsyncLogger");
+    BOOST_REQUIRE_LT(t, nThreads);
+    BOOST_CHECK_EQUAL(i, next[t]);
+    next[t] = i + 1;
+  }
+  for (size_t n : next) {
+    BOOST_CHECK_EQUAL(n, nMessages);
+  }
+}
+
+/// @brief unit test for selecting the asynchronous output by default
+BOOST_AUTO_TEST_CASE(async_default_logger_test) {
+  if (INFO >= Logging::FAILURE_THRESHOLD) {
+    return;
+  }
+  std::ostringstream os;
+  setDefaultAsyncOutput(true);
+  auto log = getDefaultLogger("AsyncLogger", INFO, &os);
+  setDefaultAsyncOutput(false);
+  log->log(INFO, "async message");
+  flushAsyncOutput();
+  BOOST_CHECK_NE(os.str().find("async message"), std::string::npos);
+}
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,201 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include "EventPrefetcher.hpp"
+#include "EventProfiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace ActsExamples;
+
+namespace {
+
+// Stores the event number; some events take much longer than the others
+class UnevenReader final : public IReader {
+ public:
+  std::string name() const final { return "UnevenReader"; }
+  std::pair<size_t, size_t> availableEvents() const final {
+    return {0u, std::numeric_limits<size_t>::max()};
+  }
+  ProcessCode read(const AlgorithmContext& context) final {
+    if (context.eventNumber % 5 == 1) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    if (context.eventNumber == failingEvent) {
+      throw std::runtime_error("Unreadable event");
+    }
+    context.eventStore.add("number", size_t(context.eventNumber));
+    return ProcessCode::SUCCESS;
+  }
+
+  size_t failingEvent = std::numeric_limits<size_t>::max();
+};
+
+EventPrefetcher::Config makeConfig(std::shared_ptr<IReader> reader,
+                                   size_t numThreads, size_t numEvents) {
+  EventPrefetcher::Config cfg;
+  cfg.readers = {std::move(reader)};
+  cfg.makeStore = [](size_t) { return std::make_unique<WhiteBoard>(); };
+  cfg.numThreads = numThreads;
+  cfg.depth = 4;
+  cfg.firstEvent = 0;
+  cfg.lastEvent = numEvents;
+  return cfg;
+}
+
+// Read the busy time column of the thread table
+std::vector<double> readBusyTimes(const std::string& path) {
+  std::ifstream is(path);
+  std::string header;
+  std::getline(is, header);
+  std::vector<double> busyTimes;
+  size_t thread = 0;
+  size_t numExecutions = 0;
+  double busy = 0;
+  double utilisation = 0;
+  while (is >> thread >> numExecutions >> busy >> utilisation) {
+    busyTimes.push_back(busy);
+  }
+  return busyTimes;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventPrefetcherTests)
+
+BOOST_AUTO_TEST_CASE(EventsAreHandedOutByNumber) {
+  auto logger = Acts::getDefaultLogger("EventPrefetcher", Acts::Logging::INFO);
+  std::vector<EventPrefetcher::Duration> clocks(1u);
+
+  for (size_t numThreads : {2u, 3u, 8u}) {
+    EventPrefetcher prefetcher(
+        makeConfig(std::make_shared<UnevenReader>(), numThreads, 30u),
+        *logger);
+    // reads finish out of order, but every request gets its own event
+    for (size_t event = 0; event < 30u; ++event) {
+      auto staged = prefetcher.next(event, clocks);
+      BOOST_REQUIRE(staged);
+      BOOST_CHECK_EQUAL(staged->context.eventNumber, event);
+      BOOST_CHECK_EQUAL(staged->store->get<size_t>("number"), event);
+    }
+    prefetcher.finish();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentRequestsGetTheirEvents) {
+  auto logger = Acts::getDefaultLogger("EventPrefetcher", Acts::Logging::INFO);
+  EventPrefetcher prefetcher(
+      makeConfig(std::make_shared<UnevenReader>(), 2u, 40u), *logger);
+
+  // consumers take interleaved events, as the runners of the sequencer do
+  std::vector<size_t> mismatches(4u, 0u);
+  std::vector<std::thread> consumers;
+  for (size_t i = 0; i < mismatches.size(); ++i) {
+    consumers.emplace_back([&, i]() {
+      std::vector<EventPrefetcher::Duration> clocks(1u);
+      for (size_t event = i; event < 40u; event += mismatches.size()) {
+        auto staged = prefetcher.next(event, clocks);
+        if (staged->store->get<size_t>("number") != event) {
+          ++mismatches[i];
+        }
+      }
+    });
+  }
+  for (auto& consumer : consumers) {
+    consumer.join();
+  }
+  prefetcher.finish();
+  for (size_t count : mismatches) {
+    BOOST_CHECK_EQUAL(count, 0u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TryNextDoesNotWaitForTheRead) {
+  auto logger = Acts::getDefaultLogger("EventPrefetcher", Acts::Logging::INFO);
+  std::vector<EventPrefetcher::Duration> clocks(1u);
+  std::atomic<size_t> numStaged = 0;
+  auto cfg = makeConfig(std::make_shared<UnevenReader>(), 1u, 10u);
+  cfg.onStaged = [&]() { ++numStaged; };
+
+  EventPrefetcher prefetcher(cfg, *logger);
+  size_t numMisses = 0;
+  for (size_t event = 0; event < 10u; ++event) {
+    // requests are repeated until the event has been staged
+    std::unique_ptr<EventPrefetcher::Event> staged;
+    while (not(staged = prefetcher.tryNext(event, clocks))) {
+      ++numMisses;
+      std::this_thread::yield();
+    }
+    BOOST_CHECK_EQUAL(staged->store->get<size_t>("number"), event);
+  }
+  prefetcher.finish();
+  // the slow events can not have been staged on the first request
+  BOOST_CHECK_LT(0u, numMisses);
+  BOOST_CHECK_EQUAL(numStaged, 10u);
+}
+
+BOOST_AUTO_TEST_CASE(ReadErrorIsHandedOut) {
+  auto logger = Acts::getDefaultLogger("EventPrefetcher", Acts::Logging::FATAL);
+  auto reader = std::make_shared<UnevenReader>();
+  reader->failingEvent = 6;
+  std::vector<EventPrefetcher::Duration> clocks(1u);
+
+  EventPrefetcher prefetcher(makeConfig(reader, 2u, 20u), *logger);
+  auto readAll = [&]() {
+    for (size_t event = 0; event < 20u; ++event) {
+      prefetcher.next(event, clocks);
+    }
+  };
+  BOOST_CHECK_THROW(readAll(), std::runtime_error);
+  prefetcher.finish();
+}
+
+BOOST_AUTO_TEST_CASE(FailedReadIsProfiled) {
+  auto logger = Acts::getDefaultLogger("EventPrefetcher", Acts::Logging::FATAL);
+  auto reader = std::make_shared<UnevenReader>();
+  reader->failingEvent = 0;
+  std::vector<EventPrefetcher::Duration> clocks(1u);
+  EventProfiler::Config profilerCfg;
+  profilerCfg.names = {"Reader:UnevenReader"};
+  profilerCfg.numEvents = 2;
+  EventProfiler profiler(profilerCfg);
+  auto cfg = makeConfig(reader, 0u, 2u);
+  cfg.profiler = &profiler;
+
+  // the failed read on this thread must not hide later executions
+  EventPrefetcher prefetcher(cfg, *logger);
+  BOOST_CHECK_THROW(prefetcher.next(0u, clocks), std::runtime_error);
+  profiler.begin();
+  auto start = EventProfiler::Clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  profiler.record(0, 1, start, EventProfiler::Clock::now());
+  profiler.stop();
+
+  std::string path = "EventPrefetcherTests_failed.tsv";
+  profiler.writeThreads(path);
+  auto busyTimes = readBusyTimes(path);
+  std::remove(path.c_str());
+  BOOST_REQUIRE_EQUAL(busyTimes.size(), 1u);
+  BOOST_CHECK_GE(busyTimes[0], 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "EventProfiler.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+using namespace ActsExamples;
+
+namespace {
+
+using Clock = EventProfiler::Clock;
+
+// Read the utilisation column of the thread table
+std::vector<double> readUtilisations(const std::string& path) {
+  std::ifstream is(path);
+  std::string header;
+  std::getline(is, header);
+  std::vector<double> utilisations;
+  size_t thread = 0;
+  size_t numExecutions = 0;
+  double busy = 0;
+  double utilisation = 0;
+  while (is >> thread >> numExecutions >> busy >> utilisation) {
+    utilisations.push_back(utilisation);
+  }
+  return utilisations;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventProfilerTests)
+
+BOOST_AUTO_TEST_CASE(NestedExecutionsAreCountedOnce) {
+  EventProfiler::Config cfg;
+  cfg.names = {"outer", "inner"};
+  cfg.numEvents = 2;
+  EventProfiler profiler(cfg);
+
+  // an execution of another event runs within the outer execution on the
+  // same thread, as for stolen work within a nested parallel algorithm
+  profiler.begin();
+  auto outerStart = Clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  profiler.begin();
+  auto innerStart = Clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  profiler.record(1, 1, innerStart, Clock::now());
+  profiler.record(0, 0, outerStart, Clock::now());
+  profiler.stop();
+
+  std::string path = "EventProfilerTests_nested.tsv";
+  profiler.writeThreads(path);
+  auto utilisations = readUtilisations(path);
+  std::remove(path.c_str());
+  BOOST_REQUIRE_EQUAL(utilisations.size(), 1u);
+  BOOST_CHECK_GT(utilisations[0], 0.5);
+  BOOST_CHECK_LE(utilisations[0], 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(NestedParallelUtilisation) {
+  size_t numEvents = 16;
+  size_t numChunks = 8;
+  EventProfiler::Config cfg;
+  cfg.names = {"event"};
+  for (size_t i = 0; i < numChunks; ++i) {
+    cfg.names.push_back("chunk" + std::to_string(i));
+  }
+  cfg.numEvents = numEvents;
+  EventProfiler profiler(cfg);
+
+  auto execute = [&](size_t element, size_t event, auto&& body) {
+    profiler.begin();
+    auto start = Clock::now();
+    body();
+    profiler.record(element, event, start, Clock::now());
+  };
+  // every event runs a nested parallel loop whose chunks are also recorded;
+  // waiting threads execute chunks and events of others within their own
+  tbb::task_arena arena(4);
+  arena.execute([&]() {
+    tbb::parallel_for(size_t(0), numEvents, [&](size_t event) {
+      execute(0, event, [&]() {
+        tbb::parallel_for(size_t(0), numChunks, [&](size_t i) {
+          execute(1 + i, event, [&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          });
+        });
+      });
+    });
+  });
+  profiler.stop();
+
+  std::string path = "EventProfilerTests_parallel.tsv";
+  profiler.writeThreads(path);
+  auto utilisations = readUtilisations(path);
+  std::remove(path.c_str());
+  BOOST_CHECK(not utilisations.empty());
+  for (double utilisation : utilisations) {
+    BOOST_CHECK_LE(utilisation, 1.0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,271 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+
+using namespace ActsExamples;
+
+namespace {
+
+// Checks whether an object exists when it runs, after some delay
+class ProbeAlgorithm final : public BareAlgorithm {
+ public:
+  ProbeAlgorithm(std::string key)
+      : BareAlgorithm("ProbeAlgorithm"), m_key(std::move(key)) {}
+
+  ProcessCode execute(const AlgorithmContext& context) const final {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    try {
+      context.eventStore.get<int>(m_key);
+      ++found;
+    } catch (const std::out_of_range&) {
+    }
+    return ProcessCode::SUCCESS;
+  }
+  std::vector<std::string> inputs() const final { return {m_key}; }
+  std::vector<std::string> outputs() const final { return {}; }
+
+  mutable std::atomic<size_t> found = 0;
+
+ private:
+  std::string m_key;
+};
+
+// Stores an object immediately
+class ProducerAlgorithm final : public BareAlgorithm {
+ public:
+  ProducerAlgorithm(std::string key)
+      : BareAlgorithm("ProducerAlgorithm"), m_key(std::move(key)) {}
+
+  ProcessCode execute(const AlgorithmContext& context) const final {
+    context.eventStore.add(m_key, int(1));
+    return ProcessCode::SUCCESS;
+  }
+  std::vector<std::string> inputs() const final { return {}; }
+  std::vector<std::string> outputs() const final { return {m_key}; }
+
+ private:
+  std::string m_key;
+};
+
+// Sums up numbers in a nested parallel loop
+class NestedAlgorithm final : public BareAlgorithm {
+ public:
+  NestedAlgorithm() : BareAlgorithm("NestedAlgorithm") {}
+
+  ProcessCode execute(const AlgorithmContext& /*context*/) const final {
+    std::atomic<size_t> sum = 0;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0u, 64u),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        for (size_t i = r.begin(); i != r.end(); ++i) {
+                          std::this_thread::sleep_for(
+                              std::chrono::microseconds(100));
+                          sum += i;
+                        }
+                      });
+    if (sum == 2016u) {
+      ++executed;
+    }
+    return ProcessCode::SUCCESS;
+  }
+  std::vector<std::string> inputs() const final { return {}; }
+  std::vector<std::string> outputs() const final { return {}; }
+
+  mutable std::atomic<size_t> executed = 0;
+};
+
+// Records the threads that create its scratch state
+class ScratchAlgorithm final : public BareAlgorithm {
+ public:
+  ScratchAlgorithm() : BareAlgorithm("ScratchAlgorithm") {}
+
+  ProcessCode execute(const AlgorithmContext& context) const final {
+    scratch<AlgorithmScratch>(context);
+    return ProcessCode::SUCCESS;
+  }
+  std::unique_ptr<AlgorithmScratch> makeScratch() const final {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    threads.push_back(std::this_thread::get_id());
+    return std::make_unique<AlgorithmScratch>();
+  }
+
+  mutable std::vector<std::thread::id> threads;
+
+ private:
+  mutable std::mutex m_mutex;
+};
+
+// Reads an object through a handle but declares a different input
+class MisdeclaredAlgorithm final : public BareAlgorithm {
+ public:
+  MisdeclaredAlgorithm() : BareAlgorithm("MisdeclaredAlgorithm") {
+    m_input.initialize("object");
+  }
+
+  ProcessCode execute(const AlgorithmContext& context) const final {
+    m_input(context);
+    return ProcessCode::SUCCESS;
+  }
+  std::vector<std::string> inputs() const final { return {"other"}; }
+
+ private:
+  ReadHandle<int> m_input{this, "Input"};
+};
+
+// Reads events slower than they are processed
+class SlowReader final : public IReader {
+ public:
+  std::string name() const final { return "SlowReader"; }
+  std::pair<size_t, size_t> availableEvents() const final {
+    return {0u, std::numeric_limits<size_t>::max()};
+  }
+  ProcessCode read(const AlgorithmContext& /*context*/) final {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return ProcessCode::SUCCESS;
+  }
+};
+
+// Counts the written events, slower than the event processing
+class SlowWriter final : public IWriter {
+ public:
+  std::string name() const final { return "SlowWriter"; }
+  ProcessCode write(const AlgorithmContext& /*context*/) final {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    ++written;
+    return ProcessCode::SUCCESS;
+  }
+  ProcessCode endRun() final { return ProcessCode::SUCCESS; }
+
+  std::atomic<size_t> written = 0;
+};
+
+Sequencer::Config makeConfig(size_t numEvents) {
+  Sequencer::Config cfg;
+  cfg.events = numEvents;
+  cfg.numThreads = 2;
+  cfg.outputDir = std::filesystem::temp_directory_path().string();
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SequencerTests)
+
+BOOST_AUTO_TEST_CASE(DataflowKeepsWriteAfterRead) {
+  auto cfg = makeConfig(8u);
+  cfg.dataflowScheduling = true;
+  auto probe = std::make_shared<ProbeAlgorithm>("object");
+
+  // the object is only written after it has been read in sequence order
+  Sequencer sequencer(cfg);
+  sequencer.addAlgorithm(probe);
+  sequencer.addAlgorithm(std::make_shared<ProducerAlgorithm>("object"));
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK_EQUAL(probe->found, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncWritersHoldBackEvents) {
+  auto cfg = makeConfig(40u);
+  cfg.asyncWriters = true;
+  cfg.writerQueueCapacity = 1;
+  cfg.maxEventsInFlight = 4;
+  auto writer = std::make_shared<SlowWriter>();
+
+  // runners wait for the writer without blocking the worker threads
+  Sequencer sequencer(cfg);
+  sequencer.addAlgorithm(std::make_shared<ProducerAlgorithm>("object"));
+  sequencer.addWriter(writer);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK_EQUAL(writer->written, 40u);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryLimitBelowResidentMemory) {
+  // ensure concurrent events even on machines with a single core
+  tbb::global_control parallelism(
+      tbb::global_control::max_allowed_parallelism, 3u);
+  auto cfg = makeConfig(20u);
+  // the limit is always exceeded and more events can be in flight than
+  // there are threads
+  cfg.maxResidentMemory = 1u;
+  cfg.maxEventsInFlight = 4;
+  auto nested = std::make_shared<NestedAlgorithm>();
+
+  // throttled events are started one at a time and all of them finish
+  Sequencer sequencer(cfg);
+  sequencer.addAlgorithm(nested);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK_EQUAL(nested->executed, 20u);
+}
+
+BOOST_AUTO_TEST_CASE(ReadAheadWithNestedParallelism) {
+  tbb::global_control parallelism(
+      tbb::global_control::max_allowed_parallelism, 3u);
+  auto cfg = makeConfig(20u);
+  cfg.numReaderThreads = 1;
+  cfg.prefetchEvents = 2;
+  cfg.maxEventsInFlight = 4;
+  auto nested = std::make_shared<NestedAlgorithm>();
+
+  // runners waiting for the reader do not block the worker threads
+  Sequencer sequencer(cfg);
+  sequencer.addReader(std::make_shared<SlowReader>());
+  sequencer.addAlgorithm(nested);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK_EQUAL(nested->executed, 20u);
+}
+
+BOOST_AUTO_TEST_CASE(ScratchIsCreatedByTheWorkers) {
+  auto cfg = makeConfig(8u);
+  cfg.maxEventsInFlight = 2;
+  auto algorithm = std::make_shared<ScratchAlgorithm>();
+
+  // the main thread only waits for the event runners and never executes an
+  // algorithm, i.e. it must not create scratch state either
+  Sequencer sequencer(cfg);
+  sequencer.addAlgorithm(algorithm);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK(not algorithm->threads.empty());
+  for (auto id : algorithm->threads) {
+    BOOST_CHECK(id != std::this_thread::get_id());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeclaredInputsMustMatchHandles) {
+  auto cfg = makeConfig(1u);
+
+  // the scheduling would not see the object read through the handle
+  Sequencer sequencer(cfg);
+  sequencer.addAlgorithm(std::make_shared<ProducerAlgorithm>("object"));
+  sequencer.addAlgorithm(std::make_shared<MisdeclaredAlgorithm>());
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,75 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+// Keeps track of the memory that is currently allocated through it
+class CountingResource final : public std::pmr::memory_resource {
+ public:
+  size_t allocated = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) final {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t alignment) final {
+    allocated -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept final {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(WhiteBoardTests)
+
+BOOST_AUTO_TEST_CASE(EventDataIsReleasedWithTheEvent) {
+  CountingResource upstream;
+  auto store = std::make_unique<WhiteBoard>(
+      Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO), 1024u,
+      nullptr, &upstream);
+  AlgorithmContext context(0, 0, *store, &store->arena());
+  BOOST_CHECK_EQUAL(context.eventMemory, &store->arena());
+  size_t empty = upstream.allocated;
+
+  // event data much larger than the initial arena block
+  std::pmr::vector<double> data(context.eventMemory);
+  data.resize(100000u, 1.0);
+  BOOST_CHECK_LE(empty + data.size() * sizeof(double), upstream.allocated);
+  context.eventStore.add("data", std::move(data));
+  BOOST_CHECK_EQUAL(store->get<std::pmr::vector<double>>("data").size(),
+                    100000u);
+
+  // objects that are freed early still keep their memory until the end
+  size_t full = upstream.allocated;
+  {
+    std::pmr::vector<double> temporary(1000000u, 2.0, context.eventMemory);
+  }
+  BOOST_CHECK_LT(full, upstream.allocated);
+
+  // the end of the event releases everything
+  store.reset();
+  BOOST_CHECK_EQUAL(upstream.allocated, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()